@@ -1,11 +1,16 @@
 /* This application calculates the moves of the horse on a chess table based on an initial position. The horse should
    cover all positions and each position only once. It is also possible that no solution exists.
+
+   When launched with the -s argument (after the table size and start position), a solver is used instead of the single
+   Warnsdorff traversal: multiple tie-break strategies are tried concurrently, each one with backtracking (see
+   knighttoursolver.h). The solver statistics are displayed too.
 */
 #include <iostream>
 #include <map>
 
 #include "chesstable.h"
 #include "commandargumentsparser.h"
+#include "knighttoursolver.h"
 #include "utils.h"
 
 static const std::map<ResultType, std::string> c_ErrorMessages{
@@ -17,7 +22,10 @@ static const std::map<ResultType, std::string> c_ErrorMessages{
      "The starting position is invalid (should be between 1 and rows/columns count).\n"},
 };
 
-void displayTraversingOutcome(const ChessTable& chessTable);
+static const std::string c_SolverModeOption{"-s"};
+
+void displayTraversingOutcome(bool isFullyTraversed, const IntMatrix& traversedPositions);
+void displaySolverStatistics(const KnightTourSolver::Statistics& statistics);
 
 int main(int argc, char** argv)
 {
@@ -27,12 +35,26 @@ int main(int argc, char** argv)
 
     if (resultType == ResultType::SUCCESS)
     {
-        if (applicationInput.has_value())
+        const bool c_IsSolverMode{argc > 5 && c_SolverModeOption == argv[5]};
+
+        if (applicationInput.has_value() && c_IsSolverMode)
+        {
+            KnightTourSolver solver;
+
+            // user coordinates to be mapped to Matrix coordinates
+            solver.solve(applicationInput->m_TableLength, applicationInput->m_TableWidth,
+                         KnightTourSolver::StartPosition{applicationInput->m_StartPositionX - 1,
+                                                         applicationInput->m_StartPositionY - 1});
+
+            displayTraversingOutcome(solver.getStatistics().m_IsSolved, solver.getTraversedPositions());
+            displaySolverStatistics(solver.getStatistics());
+        }
+        else if (applicationInput.has_value())
         {
             ChessTable chessTable{applicationInput->m_TableLength, applicationInput->m_TableWidth};
             chessTable.traverse(applicationInput->m_StartPositionX, applicationInput->m_StartPositionY);
 
-            displayTraversingOutcome(chessTable);
+            displayTraversingOutcome(chessTable.isFullyTraversed(), chessTable.getTraversedPositions());
         }
         else
         {
@@ -49,17 +71,16 @@ int main(int argc, char** argv)
     return 0;
 }
 
-void displayTraversingOutcome(const ChessTable& chessTable)
+void displayTraversingOutcome(bool isFullyTraversed, const IntMatrix& traversedPositions)
 {
-    if (chessTable.isFullyTraversed())
+    if (isFullyTraversed)
     {
-        const IntMatrix& c_TraversedPositions{chessTable.getTraversedPositions()};
         std::cout << "The resulting chess table traversing is:\n\n";
 
-        for (matrix_size_t row{0}; row < c_TraversedPositions.getNrOfRows(); ++row)
+        for (matrix_size_t row{0}; row < traversedPositions.getNrOfRows(); ++row)
         {
-            for (Matrix<int>::ConstZIterator it{c_TraversedPositions.constZRowBegin(row)};
-                 it != c_TraversedPositions.constZRowEnd(row); ++it)
+            for (Matrix<int>::ConstZIterator it{traversedPositions.constZRowBegin(row)};
+                 it != traversedPositions.constZRowEnd(row); ++it)
             {
                 std::cout << *it << " ";
             }
@@ -72,3 +93,24 @@ void displayTraversingOutcome(const ChessTable& chessTable)
         std::cout << "No table traversing solution found!\n";
     }
 }
+
+void displaySolverStatistics(const KnightTourSolver::Statistics& statistics)
+{
+    static const std::map<TieBreakRule, std::string> c_TieBreakRuleNames{
+        {TieBreakRule::MOVE_ORDER, "move order"},
+        {TieBreakRule::SUCCESSORS_DEGREES, "successors degrees"},
+        {TieBreakRule::RANDOM, "random"},
+    };
+
+    std::cout << "\nSolver statistics:\n\n";
+    std::cout << "Attempts: " << statistics.m_AttemptsCount << "\n";
+    std::cout << "Backtracks: " << statistics.m_BacktracksCount << "\n";
+    std::cout << (statistics.m_IsSolved ? "Time to solution: " : "Search time: ") << statistics.m_Duration.count()
+              << " us\n";
+
+    if (statistics.m_WinningStrategy.has_value())
+    {
+        std::cout << "Winning strategy: " << c_TieBreakRuleNames.at(statistics.m_WinningStrategy->m_TieBreakRule)
+                  << " tie-break (parameter: " << statistics.m_WinningStrategy->m_Parameter << ")\n";
+    }
+}
@@ -1,8 +1,7 @@
 #pragma once
 
-#include <vector>
-
 #include "matrix.h"
+#include "warnsdorffengine.h"
 
 using IntMatrix = Matrix<int>;
 
@@ -17,21 +16,9 @@ public:
     const IntMatrix& getTraversedPositions() const;
 
 private:
-    struct Point
-    {
-        matrix_diff_t m_X;
-        matrix_diff_t m_Y;
-
-        Point(matrix_diff_t x, matrix_diff_t y);
-    };
-
     void _resetTable();
 
-    bool _getBestSuccessor(const Point& currentPosition, Point& bestSuccessor) const;
-    std::vector<Point> _getSuccessors(const Point& currentPosition) const;
-    bool _isValidMovePosition(const Point& position) const;
-    bool _isValidTablePosition(matrix_diff_t x, matrix_diff_t y) const;
-
+    WarnsdorffEngine m_Engine;
     IntMatrix m_Table;
     bool m_IsFullyTraversed;
 };
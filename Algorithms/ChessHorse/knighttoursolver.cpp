@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "knighttoursolver.h"
+
+static constexpr uint32_t c_MoveOrderRotationsCount{8};
+
+KnightTourSolver::KnightTourSolver(size_t threadsCount, size_t maxAttemptsCount, size_t maxBacktracksCount)
+    : m_ThreadsCount{std::max<size_t>(threadsCount, 1)}
+    , m_MaxAttemptsCount{maxAttemptsCount}
+    , m_MaxBacktracksCount{maxBacktracksCount}
+    , m_NextAttemptIndex{0}
+    , m_BacktracksCount{0}
+    , m_IsSolved{false}
+{
+}
+
+bool KnightTourSolver::solve(matrix_size_t nrOfRows, matrix_size_t nrOfColumns,
+                             std::optional<StartPosition> startPosition)
+{
+    m_TraversedPositions.clear();
+    m_Statistics = Statistics{};
+
+    do
+    {
+        if (nrOfRows == 0 || nrOfColumns == 0)
+        {
+            assert(false && "Invalid chess table dimensions provided");
+            break;
+        }
+
+        if (startPosition.has_value() && (startPosition->first >= nrOfRows || startPosition->second >= nrOfColumns))
+        {
+            assert(false && "Invalid starting position on table!");
+            break;
+        }
+
+        m_NextAttemptIndex = 0;
+        m_BacktracksCount = 0;
+        m_IsSolved = false;
+        m_StartTime = std::chrono::steady_clock::now();
+
+        const size_t c_ThreadsCount{std::min(m_ThreadsCount, std::max<size_t>(m_MaxAttemptsCount, 1))};
+        std::vector<std::thread> threads;
+
+        for (size_t threadIndex{1}; threadIndex < c_ThreadsCount; ++threadIndex)
+        {
+            threads.emplace_back(&KnightTourSolver::_runAttempts, this, nrOfRows, nrOfColumns, startPosition);
+        }
+
+        _runAttempts(nrOfRows, nrOfColumns, startPosition);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        m_Statistics.m_IsSolved = m_IsSolved;
+        m_Statistics.m_AttemptsCount = std::min(m_NextAttemptIndex.load(), m_MaxAttemptsCount);
+        m_Statistics.m_BacktracksCount = m_BacktracksCount;
+
+        if (!m_IsSolved)
+        {
+            m_Statistics.m_Duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_StartTime);
+        }
+    } while (false);
+
+    return m_Statistics.m_IsSolved;
+}
+
+const IntMatrix& KnightTourSolver::getTraversedPositions() const
+{
+    return m_TraversedPositions;
+}
+
+const KnightTourSolver::Statistics& KnightTourSolver::getStatistics() const
+{
+    return m_Statistics;
+}
+
+void KnightTourSolver::_runAttempts(matrix_size_t nrOfRows, matrix_size_t nrOfColumns,
+                                    const std::optional<StartPosition>& startPosition)
+{
+    WarnsdorffEngine engine{nrOfRows, nrOfColumns};
+
+    while (!m_IsSolved.load(std::memory_order_relaxed))
+    {
+        const size_t c_AttemptIndex{m_NextAttemptIndex.fetch_add(1)};
+
+        if (c_AttemptIndex >= m_MaxAttemptsCount)
+        {
+            break;
+        }
+
+        const TraversalStrategy c_Strategy{_getStrategy(c_AttemptIndex, nrOfRows, nrOfColumns, startPosition)};
+        const bool c_IsFullyTraversed{engine.search(c_Strategy, m_MaxBacktracksCount, &m_IsSolved)};
+
+        m_BacktracksCount += engine.getBacktracksCount();
+
+        if (c_IsFullyTraversed)
+        {
+            std::lock_guard lock{m_ResultMutex};
+
+            // another thread might have found a solution in the meantime
+            if (!m_IsSolved)
+            {
+                m_Statistics.m_Duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - m_StartTime);
+                m_Statistics.m_WinningStrategy = c_Strategy;
+
+                m_TraversedPositions.resize(nrOfRows, nrOfColumns, 0);
+
+                for (IntMatrix::ZIterator it{m_TraversedPositions.zBegin()}; it != m_TraversedPositions.zEnd(); ++it)
+                {
+                    *it = static_cast<int>(engine.getMoveNumber(*it.getRowNr(), *it.getColumnNr()));
+                }
+
+                m_IsSolved = true;
+            }
+
+            break;
+        }
+    }
+}
+
+TraversalStrategy KnightTourSolver::_getStrategy(size_t attemptIndex, matrix_size_t nrOfRows,
+                                                 matrix_size_t nrOfColumns,
+                                                 const std::optional<StartPosition>& startPosition)
+{
+    TraversalStrategy strategy{0, 0, TieBreakRule::MOVE_ORDER, 0};
+    size_t variantIndex{attemptIndex};
+
+    if (startPosition.has_value())
+    {
+        strategy.m_StartRow = startPosition->first;
+        strategy.m_StartColumn = startPosition->second;
+    }
+    else
+    {
+        const size_t c_PositionsCount{static_cast<size_t>(nrOfRows) * nrOfColumns};
+        const size_t c_PositionIndex{attemptIndex % c_PositionsCount};
+
+        strategy.m_StartRow = static_cast<matrix_size_t>(c_PositionIndex / nrOfColumns);
+        strategy.m_StartColumn = static_cast<matrix_size_t>(c_PositionIndex % nrOfColumns);
+        variantIndex = attemptIndex / c_PositionsCount;
+    }
+
+    if (variantIndex < c_MoveOrderRotationsCount)
+    {
+        strategy.m_Parameter = static_cast<uint32_t>(variantIndex);
+    }
+    else if (variantIndex == c_MoveOrderRotationsCount)
+    {
+        strategy.m_TieBreakRule = TieBreakRule::SUCCESSORS_DEGREES;
+    }
+    else
+    {
+        strategy.m_TieBreakRule = TieBreakRule::RANDOM;
+        strategy.m_Parameter = static_cast<uint32_t>(variantIndex);
+    }
+
+    return strategy;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "chesstable.h"
+#include "warnsdorffengine.h"
+
+/* Searches a full horse traversal of the chess table by running multiple attempts concurrently:
+   - each attempt is a Warnsdorff traversal with bounded backtracking (see WarnsdorffEngine::search()), the attempts
+   differing by tie-break strategy: rotated move orders first, then successors degrees, then random tie-breaking
+   (different seed for each attempt)
+   - if a start position is provided all attempts start from it, otherwise the start positions are varied too (each
+   position gets an attempt before trying the next strategy)
+   - the attempts are claimed dynamically by the threads, each thread using its own engine
+   - as soon as an attempt succeeds the other ones are cancelled (cooperatively, the engines check a stop flag)
+*/
+class KnightTourSolver
+{
+public:
+    using StartPosition = std::pair<matrix_size_t, matrix_size_t>;
+
+    struct Statistics
+    {
+        bool m_IsSolved{false};
+        size_t m_AttemptsCount{0};               // started attempts (including cancelled ones)
+        size_t m_BacktracksCount{0};             // sum for all started attempts
+        std::chrono::microseconds m_Duration{0}; // time to solution (or until all attempts failed)
+        std::optional<TraversalStrategy> m_WinningStrategy;
+    };
+
+    static constexpr size_t c_DefaultMaxAttemptsCount{64};
+    static constexpr size_t c_DefaultMaxBacktracksCount{100000};
+
+    explicit KnightTourSolver(size_t threadsCount = std::thread::hardware_concurrency(),
+                              size_t maxAttemptsCount = c_DefaultMaxAttemptsCount,
+                              size_t maxBacktracksCount = c_DefaultMaxBacktracksCount);
+
+    // start position in table coordinates (starting from 0), returns true if a full traversal has been found
+    bool solve(matrix_size_t nrOfRows, matrix_size_t nrOfColumns,
+               std::optional<StartPosition> startPosition = std::nullopt);
+
+    // move number of each position (empty if no solution found)
+    const IntMatrix& getTraversedPositions() const;
+    const Statistics& getStatistics() const;
+
+private:
+    void _runAttempts(matrix_size_t nrOfRows, matrix_size_t nrOfColumns,
+                      const std::optional<StartPosition>& startPosition);
+
+    static TraversalStrategy _getStrategy(size_t attemptIndex, matrix_size_t nrOfRows, matrix_size_t nrOfColumns,
+                                          const std::optional<StartPosition>& startPosition);
+
+    size_t m_ThreadsCount;
+    size_t m_MaxAttemptsCount;
+    size_t m_MaxBacktracksCount;
+
+    IntMatrix m_TraversedPositions;
+    Statistics m_Statistics;
+
+    std::atomic<size_t> m_NextAttemptIndex;
+    std::atomic<size_t> m_BacktracksCount;
+    std::atomic<bool> m_IsSolved;
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::mutex m_ResultMutex;
+};
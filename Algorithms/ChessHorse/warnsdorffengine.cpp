@@ -0,0 +1,319 @@
+#include <algorithm>
+#include <cassert>
+
+#include "warnsdorffengine.h"
+
+static constexpr size_t c_StopCheckInterval{1024};
+
+// possible horse moves (row, column offsets), same order as for ChessTable
+static constexpr std::array<std::pair<int, int>, 8> c_HorseMoves{
+    {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}}};
+
+WarnsdorffEngine::WarnsdorffEngine(matrix_size_t nrOfRows, matrix_size_t nrOfColumns)
+    : m_NrOfRows{nrOfRows}
+    , m_NrOfColumns{nrOfColumns}
+    , m_PaddedNrOfColumns{nrOfColumns + 2 * c_BorderWidth}
+    , m_MoveOffsets{}
+    , m_TraversedPositionsCount{0}
+    , m_BacktracksCount{0}
+    , m_RandomState{1}
+{
+    assert(nrOfRows > 0 && nrOfColumns > 0 && "Invalid chess table dimensions provided");
+
+    const size_t c_PaddedNrOfRows{nrOfRows + 2 * c_BorderWidth};
+
+    for (size_t moveIndex{0}; moveIndex < c_MovesCount; ++moveIndex)
+    {
+        m_MoveOffsets[moveIndex] = c_HorseMoves[moveIndex].first * static_cast<Position>(m_PaddedNrOfColumns) +
+                                   c_HorseMoves[moveIndex].second;
+    }
+
+    m_MoveNumbers.resize(c_PaddedNrOfRows * m_PaddedNrOfColumns);
+    m_InitialDegrees.assign(m_MoveNumbers.size(), 0);
+
+    _reset();
+
+    // the border positions are not taken into account when calculating the degrees
+    for (matrix_size_t row{0}; row < m_NrOfRows; ++row)
+    {
+        for (matrix_size_t column{0}; column < m_NrOfColumns; ++column)
+        {
+            const Position c_Position{_getPosition(row, column)};
+
+            m_InitialDegrees[c_Position] = static_cast<uint8_t>(
+                std::count_if(m_MoveOffsets.cbegin(), m_MoveOffsets.cend(), [this, c_Position](Position offset) {
+                    return m_MoveNumbers[c_Position + offset] == 0;
+                }));
+        }
+    }
+
+    m_Degrees = m_InitialDegrees;
+}
+
+bool WarnsdorffEngine::traverse(matrix_size_t startRow, matrix_size_t startColumn)
+{
+    if (startRow < m_NrOfRows && startColumn < m_NrOfColumns)
+    {
+        // ensure any previous traversal is cleared for a fresh new start
+        _reset();
+
+        Position currentPosition{_getPosition(startRow, startColumn)};
+        uint32_t moveNumber{1};
+
+        _traversePosition(currentPosition, moveNumber);
+
+        for (;;)
+        {
+            Position bestSuccessor{0}; // 0 is a border position so it can be used for marking "no successor"
+            uint8_t minDegree{c_MovesCount};
+
+            for (const Position offset : m_MoveOffsets)
+            {
+                const Position c_Successor{currentPosition + offset};
+
+                // border positions are never eligible (marked as traversed)
+                if (m_MoveNumbers[c_Successor] == 0 && m_Degrees[c_Successor] < minDegree)
+                {
+                    minDegree = m_Degrees[c_Successor];
+                    bestSuccessor = c_Successor;
+                }
+            }
+
+            if (bestSuccessor == 0)
+            {
+                break;
+            }
+
+            currentPosition = bestSuccessor;
+            ++moveNumber;
+            _traversePosition(currentPosition, moveNumber);
+        }
+
+        m_TraversedPositionsCount = moveNumber;
+    }
+    else
+    {
+        assert(false && "Invalid starting position on table!");
+    }
+
+    return isFullyTraversed();
+}
+
+bool WarnsdorffEngine::search(const TraversalStrategy& strategy, size_t maxBacktracksCount,
+                              const std::atomic<bool>* shouldStop)
+{
+    if (strategy.m_StartRow < m_NrOfRows && strategy.m_StartColumn < m_NrOfColumns)
+    {
+        const size_t c_PositionsCount{static_cast<size_t>(m_NrOfRows) * m_NrOfColumns};
+
+        _reset();
+
+        m_Path.resize(c_PositionsCount);
+        m_SearchSteps.resize(c_PositionsCount);
+        m_BacktracksCount = 0;
+        m_RandomState = strategy.m_Parameter | 1u; // xorshift state should not be 0
+
+        m_Path[0] = _getPosition(strategy.m_StartRow, strategy.m_StartColumn);
+        _traversePosition(m_Path[0], 1);
+        _retrieveOrderedMoves(m_Path[0], strategy, m_SearchSteps[0]);
+
+        size_t depth{1}; // number of positions on the search path
+        size_t stepsCount{0};
+
+        while (depth < c_PositionsCount)
+        {
+            if (shouldStop && ++stepsCount % c_StopCheckInterval == 0 && shouldStop->load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            SearchStep& currentStep{m_SearchSteps[depth - 1]};
+
+            if (currentStep.m_NextMoveIndex < currentStep.m_MovesCount)
+            {
+                const Position c_Successor{m_Path[depth - 1] +
+                                           m_MoveOffsets[currentStep.m_Moves[currentStep.m_NextMoveIndex]]};
+                ++currentStep.m_NextMoveIndex;
+
+                m_Path[depth] = c_Successor;
+                _traversePosition(c_Successor, static_cast<uint32_t>(depth + 1));
+                _retrieveOrderedMoves(c_Successor, strategy, m_SearchSteps[depth]);
+                ++depth;
+            }
+            else
+            {
+                // dead end: undo the last move (unless no more backtracking allowed or nothing left to undo)
+                if (depth == 1 || m_BacktracksCount == maxBacktracksCount)
+                {
+                    break;
+                }
+
+                ++m_BacktracksCount;
+                --depth;
+                _untraversePosition(m_Path[depth]);
+            }
+        }
+
+        m_TraversedPositionsCount = depth;
+    }
+    else
+    {
+        assert(false && "Invalid starting position on table!");
+    }
+
+    return isFullyTraversed();
+}
+
+bool WarnsdorffEngine::isFullyTraversed() const
+{
+    return m_TraversedPositionsCount == static_cast<size_t>(m_NrOfRows) * m_NrOfColumns;
+}
+
+size_t WarnsdorffEngine::getTraversedPositionsCount() const
+{
+    return m_TraversedPositionsCount;
+}
+
+size_t WarnsdorffEngine::getBacktracksCount() const
+{
+    return m_BacktracksCount;
+}
+
+uint32_t WarnsdorffEngine::getMoveNumber(matrix_size_t row, matrix_size_t column) const
+{
+    uint32_t result{0};
+
+    if (row < m_NrOfRows && column < m_NrOfColumns)
+    {
+        result = m_MoveNumbers[_getPosition(row, column)];
+    }
+    else
+    {
+        assert(false);
+    }
+
+    return result;
+}
+
+matrix_size_t WarnsdorffEngine::getNrOfRows() const
+{
+    return m_NrOfRows;
+}
+
+matrix_size_t WarnsdorffEngine::getNrOfColumns() const
+{
+    return m_NrOfColumns;
+}
+
+void WarnsdorffEngine::_reset()
+{
+    m_TraversedPositionsCount = 0;
+
+    // border positions are marked as traversed so they never get chosen as successors
+    std::fill(m_MoveNumbers.begin(), m_MoveNumbers.end(), c_BorderPosition);
+
+    for (matrix_size_t row{0}; row < m_NrOfRows; ++row)
+    {
+        const auto c_RowBeginIt{m_MoveNumbers.begin() + _getPosition(row, 0)};
+        std::fill(c_RowBeginIt, c_RowBeginIt + m_NrOfColumns, 0);
+    }
+
+    m_Degrees = m_InitialDegrees;
+}
+
+void WarnsdorffEngine::_traversePosition(Position position, uint32_t moveNumber)
+{
+    m_MoveNumbers[position] = moveNumber;
+
+    for (const Position offset : m_MoveOffsets)
+    {
+        if (m_MoveNumbers[position + offset] == 0)
+        {
+            --m_Degrees[position + offset];
+        }
+    }
+}
+
+void WarnsdorffEngine::_untraversePosition(Position position)
+{
+    m_MoveNumbers[position] = 0;
+
+    // the successors that are currently untraversed were also untraversed when the position got traversed
+    for (const Position offset : m_MoveOffsets)
+    {
+        if (m_MoveNumbers[position + offset] == 0)
+        {
+            ++m_Degrees[position + offset];
+        }
+    }
+}
+
+/* The successors are ordered by a key consisting of (most significant first):
+   - the number of untraversed successors (Warnsdorff rule)
+   - the tie-break value (depends on strategy)
+   - the index of the move within the (rotated) move order
+*/
+void WarnsdorffEngine::_retrieveOrderedMoves(Position position, const TraversalStrategy& strategy,
+                                             SearchStep& searchStep)
+{
+    std::array<uint32_t, c_MovesCount> keys;
+
+    searchStep.m_MovesCount = 0;
+    searchStep.m_NextMoveIndex = 0;
+
+    for (size_t orderIndex{0}; orderIndex < c_MovesCount; ++orderIndex)
+    {
+        const size_t c_MoveIndex{strategy.m_TieBreakRule == TieBreakRule::MOVE_ORDER
+                                     ? (orderIndex + strategy.m_Parameter) % c_MovesCount
+                                     : orderIndex};
+        const Position c_Successor{position + m_MoveOffsets[c_MoveIndex]};
+
+        if (m_MoveNumbers[c_Successor] != 0)
+        {
+            continue;
+        }
+
+        uint32_t tieBreakValue{0};
+
+        if (strategy.m_TieBreakRule == TieBreakRule::SUCCESSORS_DEGREES)
+        {
+            for (const Position offset : m_MoveOffsets)
+            {
+                if (m_MoveNumbers[c_Successor + offset] == 0)
+                {
+                    tieBreakValue += m_Degrees[c_Successor + offset];
+                }
+            }
+        }
+        else if (strategy.m_TieBreakRule == TieBreakRule::RANDOM)
+        {
+            // xorshift32
+            m_RandomState ^= m_RandomState << 13;
+            m_RandomState ^= m_RandomState >> 17;
+            m_RandomState ^= m_RandomState << 5;
+            tieBreakValue = m_RandomState & 0xFFFFu;
+        }
+
+        const uint32_t c_Key{(static_cast<uint32_t>(m_Degrees[c_Successor]) << 24) | (tieBreakValue << 4) |
+                             static_cast<uint32_t>(orderIndex)};
+
+        // insertion sort (at most 8 moves)
+        size_t insertionIndex{searchStep.m_MovesCount};
+
+        while (insertionIndex > 0 && keys[insertionIndex - 1] > c_Key)
+        {
+            keys[insertionIndex] = keys[insertionIndex - 1];
+            searchStep.m_Moves[insertionIndex] = searchStep.m_Moves[insertionIndex - 1];
+            --insertionIndex;
+        }
+
+        keys[insertionIndex] = c_Key;
+        searchStep.m_Moves[insertionIndex] = static_cast<uint8_t>(c_MoveIndex);
+        ++searchStep.m_MovesCount;
+    }
+}
+
+WarnsdorffEngine::Position WarnsdorffEngine::_getPosition(matrix_size_t row, matrix_size_t column) const
+{
+    return static_cast<Position>((row + c_BorderWidth) * m_PaddedNrOfColumns + column + c_BorderWidth);
+}
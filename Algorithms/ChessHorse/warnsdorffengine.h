@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "matrix.h"
+
+/* Traverses the chess table with the horse by using the Warnsdorff heuristic (the next position is the one with the
+   least untraversed successors, first one in move order if multiple such positions exist):
+   - the table is stored as a flat array surrounded by a border of (already "traversed") sentinel positions, which is
+   wide enough for any horse move, so the successors never need to be checked for being within table
+   - the moves are precomputed as offsets within the flat array
+   - the number of untraversed successors of each position (degree) is maintained incrementally: when a position is
+   traversed the degrees of its successors are decremented, so the best successor is found by checking at most 8
+   positions
+   - no memory is allocated while traversing, the tables being allocated once at construction (the search path on first
+   search)
+   - the result is identical to the one of the ChessTable algorithm
+*/
+
+// rule for choosing between successors with the same (minimum) number of untraversed successors
+enum class TieBreakRule
+{
+    MOVE_ORDER,         // first successor in move order, the order being rotated by the strategy parameter
+    SUCCESSORS_DEGREES, // successor having the lowest sum of untraversed successors counts of its own successors
+    RANDOM              // random choice, the strategy parameter being used as seed
+};
+
+struct TraversalStrategy
+{
+    matrix_size_t m_StartRow;
+    matrix_size_t m_StartColumn;
+    TieBreakRule m_TieBreakRule;
+    uint32_t m_Parameter;
+};
+
+class WarnsdorffEngine
+{
+public:
+    explicit WarnsdorffEngine(matrix_size_t nrOfRows, matrix_size_t nrOfColumns);
+
+    // start position in table coordinates (starting from 0), returns true if the table has been fully traversed
+    bool traverse(matrix_size_t startRow, matrix_size_t startColumn);
+
+    /* Same as traverse(), however:
+       - ties are broken according to the strategy
+       - when reaching a dead end the previous moves are undone and the next best successors tried instead
+       (backtracking), until the table is fully traversed or the maximum backtracks count is exceeded
+       - the search is abandoned (false returned) when the stop flag is set (checked periodically)
+    */
+    bool search(const TraversalStrategy& strategy, size_t maxBacktracksCount,
+                const std::atomic<bool>* shouldStop = nullptr);
+
+    bool isFullyTraversed() const;
+    size_t getTraversedPositionsCount() const;
+    size_t getBacktracksCount() const;
+
+    // returns the number of the move that reached the given position (0 if not traversed)
+    uint32_t getMoveNumber(matrix_size_t row, matrix_size_t column) const;
+
+    matrix_size_t getNrOfRows() const;
+    matrix_size_t getNrOfColumns() const;
+
+private:
+    using Position = std::ptrdiff_t;
+
+    static constexpr size_t c_MovesCount{8};
+    static constexpr size_t c_BorderWidth{2};
+    static constexpr uint32_t c_BorderPosition{UINT32_MAX};
+
+    // successors of a position on the search path, ordered from best to worst
+    struct SearchStep
+    {
+        std::array<uint8_t, c_MovesCount> m_Moves;
+        uint8_t m_MovesCount;
+        uint8_t m_NextMoveIndex;
+    };
+
+    void _reset();
+    void _traversePosition(Position position, uint32_t moveNumber);
+    void _untraversePosition(Position position);
+    void _retrieveOrderedMoves(Position position, const TraversalStrategy& strategy, SearchStep& searchStep);
+    Position _getPosition(matrix_size_t row, matrix_size_t column) const;
+
+    matrix_size_t m_NrOfRows;
+    matrix_size_t m_NrOfColumns;
+    size_t m_PaddedNrOfColumns;
+    std::array<Position, c_MovesCount> m_MoveOffsets;
+    std::vector<uint32_t> m_MoveNumbers;
+    std::vector<uint8_t> m_Degrees;
+    std::vector<uint8_t> m_InitialDegrees;
+    size_t m_TraversedPositionsCount;
+
+    // only allocated when searching with backtracking
+    std::vector<Position> m_Path;
+    std::vector<SearchStep> m_SearchSteps;
+    size_t m_BacktracksCount;
+    uint32_t m_RandomState;
+};
@@ -0,0 +1,675 @@
+// clang-format off
+#include <QTest>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "dataorderingengine.h"
+
+class DataOrderingEngineTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testExactMin();
+    void testExactMinUsingInversion();
+    void testParallelExactMin();
+    void testExactMinNotPerformed();
+    void testAddWords();
+    void testAddWordsNotPerformed();
+    void testRemoveWords();
+    void testSegmentedInversion();
+    void testSegmentedInversionNotPerformed();
+    void testSegmentedInversionUpdates();
+
+    void testExactMin_data();
+    void testExactMinUsingInversion_data();
+    void testExactMinNotPerformed_data();
+    void testAddWords_data();
+    void testAddWordsNotPerformed_data();
+    void testRemoveWords_data();
+    void testSegmentedInversion_data();
+    void testSegmentedInversionNotPerformed_data();
+    void testSegmentedInversionUpdates_data();
+
+private:
+    void _buildExactMinTestTable();
+};
+
+static DataSet generateDataSet(size_t wordsCount, size_t wordSize, std::mt19937& generator)
+{
+    std::bernoulli_distribution bitDistribution;
+    DataSet dataSet(wordsCount, DataWord(wordSize));
+
+    for (auto& word : dataSet)
+    {
+        std::generate(word.begin(), word.end(), [&bitDistribution, &generator]() {return bitDistribution(generator);});
+    }
+
+    return dataSet;
+}
+
+static size_t getHammingDistance(const DataWord& firstWord, const DataWord& secondWord)
+{
+    size_t hammingDistance{0};
+
+    for (size_t bitIndex{0}; bitIndex < firstWord.size(); ++bitIndex)
+    {
+        hammingDistance += firstWord[bitIndex] != secondWord[bitIndex] ? 1 : 0;
+    }
+
+    return hammingDistance;
+}
+
+// the transitions are counted on the ordered words (inversion applied), independently from the engine
+static size_t getTransitionsCount(const DataSet& orderedDataSet)
+{
+    size_t transitionsCount{0};
+
+    for (size_t wordIndex{1}; wordIndex < orderedDataSet.size(); ++wordIndex)
+    {
+        transitionsCount += getHammingDistance(orderedDataSet[wordIndex - 1], orderedDataSet[wordIndex]);
+    }
+
+    return transitionsCount;
+}
+
+// all orderings are tried (if inversion allowed each transition costs min(distance, word size - distance))
+static size_t getMinTransitionsCountByExhaustiveSearch(const DataSet& dataSet, bool inversionAllowed)
+{
+    const size_t c_WordsCount{dataSet.size()};
+    const size_t c_WordSize{dataSet.front().size()};
+    std::vector<size_t> distances(c_WordsCount * c_WordsCount);
+
+    for (size_t firstWordIndex{0}; firstWordIndex < c_WordsCount; ++firstWordIndex)
+    {
+        for (size_t secondWordIndex{0}; secondWordIndex < c_WordsCount; ++secondWordIndex)
+        {
+            const size_t c_HammingDistance{getHammingDistance(dataSet[firstWordIndex], dataSet[secondWordIndex])};
+            distances[firstWordIndex * c_WordsCount + secondWordIndex] = inversionAllowed ? std::min(c_HammingDistance, c_WordSize - c_HammingDistance) : c_HammingDistance;
+        }
+    }
+
+    size_t minTransitionsCount{std::numeric_limits<size_t>::max()};
+    std::vector<size_t> ordering(c_WordsCount);
+
+    std::iota(ordering.begin(), ordering.end(), 0);
+
+    do
+    {
+        size_t transitionsCount{0};
+
+        for (size_t orderingPosition{1}; orderingPosition < c_WordsCount; ++orderingPosition)
+        {
+            transitionsCount += distances[ordering[orderingPosition - 1] * c_WordsCount + ordering[orderingPosition]];
+        }
+
+        minTransitionsCount = std::min(minTransitionsCount, transitionsCount);
+    }
+    while (std::next_permutation(ordering.begin(), ordering.end()));
+
+    return minTransitionsCount;
+}
+
+static bool isPermutation(const OrderingIndexes& orderingIndexes, size_t wordsCount)
+{
+    OrderingIndexes sortedIndexes{orderingIndexes};
+    std::sort(sortedIndexes.begin(), sortedIndexes.end());
+
+    bool isPermutation{sortedIndexes.size() == wordsCount};
+
+    for (size_t index{0}; isPermutation && index < wordsCount; ++index)
+    {
+        isPermutation = sortedIndexes[index] == index;
+    }
+
+    return isPermutation;
+}
+
+// each ordered word should be the data set word referenced by the ordering index (inverted if the flag is set)
+static bool isOrderingConsistent(const DataOrderingEngine& engine, const DataSet& dataSet)
+{
+    const OrderingIndexes& c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags& c_InversionFlags{engine.getInversionFlags()};
+    const DataSet c_OrderedDataSet{engine.getOrderedDataSet()};
+
+    bool isConsistent{isPermutation(c_OrderingIndexes, dataSet.size()) && c_InversionFlags.size() == dataSet.size() && c_OrderedDataSet.size() == dataSet.size()};
+
+    for (size_t orderingPosition{0}; isConsistent && orderingPosition < dataSet.size(); ++orderingPosition)
+    {
+        const DataWord& c_Word{dataSet[c_OrderingIndexes[orderingPosition]]};
+        isConsistent = c_OrderedDataSet[orderingPosition] == (c_InversionFlags[orderingPosition] ? Utilities::invertDataWord(c_Word) : c_Word);
+    }
+
+    // the total transitions count is computed by the engine from the adjacency matrix
+    return isConsistent && engine.getTotalTransitionsCount() == getTransitionsCount(c_OrderedDataSet);
+}
+
+/* The orderings only depend on the adjacency matrix, so an incrementally updated engine should produce the same
+   orderings as an engine whose matrix has been built from scratch for the same data set (the engine is re-ordered).
+*/
+static bool isEquivalentToRebuiltEngine(DataOrderingEngine& engine, const DataSet& dataSet)
+{
+    DataOrderingEngine rebuiltEngine{dataSet};
+    bool isEquivalent{true};
+
+    engine.performGreedyMinSimplified();
+    rebuiltEngine.performGreedyMinSimplified();
+    isEquivalent = isEquivalent && engine.getOrderingIndexes() == rebuiltEngine.getOrderingIndexes();
+
+    engine.performGreedyMinSimplifiedUsingInversion();
+    rebuiltEngine.performGreedyMinSimplifiedUsingInversion();
+    isEquivalent = isEquivalent && engine.getOrderingIndexes() == rebuiltEngine.getOrderingIndexes() && engine.getInversionFlags() == rebuiltEngine.getInversionFlags();
+
+    // all distances are taken into account by the exact ordering
+    if (dataSet.size() > 1 && dataSet.size() <= 10)
+    {
+        isEquivalent = isEquivalent && engine.performExactMin(1) && rebuiltEngine.performExactMin(1) && engine.getOrderingIndexes() == rebuiltEngine.getOrderingIndexes();
+    }
+
+    return isEquivalent && engine.getTotalTransitionsCount() == rebuiltEngine.getTotalTransitionsCount();
+}
+
+// minimum transitions count resulting from inserting a word at any position of an ordered data set (possibly inverted)
+static size_t getMinTransitionsCountAfterInsertion(const DataSet& orderedDataSet, const DataWord& word, bool inversionAllowed)
+{
+    size_t minTransitionsCount{std::numeric_limits<size_t>::max()};
+
+    for (size_t position{0}; position <= orderedDataSet.size(); ++position)
+    {
+        for (const bool c_IsInverted : {false, true})
+        {
+            if (!c_IsInverted || inversionAllowed)
+            {
+                DataSet dataSet{orderedDataSet};
+                dataSet.insert(dataSet.begin() + position, c_IsInverted ? Utilities::invertDataWord(word) : word);
+                minTransitionsCount = std::min(minTransitionsCount, getTransitionsCount(dataSet));
+            }
+        }
+    }
+
+    return minTransitionsCount;
+}
+
+// each segment of each ordered word should be inverted according to its own flag, both when copied and when viewed
+static bool isSegmentedOrderingConsistent(const DataOrderingEngine& engine, const DataSet& dataSet, size_t segmentsCount)
+{
+    const OrderingIndexes& c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags& c_InversionFlags{engine.getInversionFlags()};
+    const DataSet c_OrderedDataSet{engine.getOrderedDataSet()};
+    const OrderedDataSetView c_OrderedDataSetView{engine.getOrderedDataSetView()};
+
+    bool isConsistent{engine.getInversionSegmentsCount() == segmentsCount && isPermutation(c_OrderingIndexes, dataSet.size()) && c_InversionFlags.size() == dataSet.size() * segmentsCount &&
+                      c_OrderedDataSet.size() == dataSet.size() && c_OrderedDataSetView.size() == dataSet.size()};
+
+    for (size_t orderingPosition{0}; isConsistent && orderingPosition < dataSet.size(); ++orderingPosition)
+    {
+        DataWord expectedWord{dataSet[c_OrderingIndexes[orderingPosition]]};
+
+        for (size_t bitIndex{0}; bitIndex < expectedWord.size(); ++bitIndex)
+        {
+            const size_t c_SegmentIndex{Utilities::getSegmentIndex(expectedWord.size(), segmentsCount, bitIndex)};
+            expectedWord[bitIndex] = expectedWord[bitIndex] != c_InversionFlags[orderingPosition * segmentsCount + c_SegmentIndex];
+        }
+
+        isConsistent = c_OrderedDataSet[orderingPosition] == expectedWord && c_OrderedDataSetView[orderingPosition].toDataWord() == expectedWord;
+    }
+
+    return isConsistent && engine.getTotalTransitionsCount() == getTransitionsCount(c_OrderedDataSet);
+}
+
+void DataOrderingEngineTests::testExactMin()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(size_t, threadsCount);
+
+    DataOrderingEngine engine{dataSet};
+
+    QVERIFY(engine.performExactMin(threadsCount));
+    QVERIFY(isPermutation(engine.getOrderingIndexes(), dataSet.size()));
+
+    const InversionFlags& c_InversionFlags{engine.getInversionFlags()};
+    const size_t c_MinTransitionsCount{getMinTransitionsCountByExhaustiveSearch(dataSet, false)};
+
+    QVERIFY(std::none_of(c_InversionFlags.cbegin(), c_InversionFlags.cend(), [](bool isInverted) {return isInverted;}));
+    QVERIFY(engine.getTotalTransitionsCount() == c_MinTransitionsCount);
+    QVERIFY(getTransitionsCount(engine.getOrderedDataSet()) == c_MinTransitionsCount);
+}
+
+void DataOrderingEngineTests::testExactMinUsingInversion()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(size_t, threadsCount);
+
+    DataOrderingEngine engine{dataSet};
+
+    QVERIFY(engine.performExactMinUsingInversion(threadsCount));
+    QVERIFY(isPermutation(engine.getOrderingIndexes(), dataSet.size()));
+    QVERIFY(engine.getInversionFlags().size() == dataSet.size());
+
+    const size_t c_MinTransitionsCount{getMinTransitionsCountByExhaustiveSearch(dataSet, true)};
+
+    QVERIFY(engine.getTotalTransitionsCount() == c_MinTransitionsCount);
+    QVERIFY(getTransitionsCount(engine.getOrderedDataSet()) == c_MinTransitionsCount);
+}
+
+// too many words for an exhaustive search, the parallel ordering is compared to the single threaded one instead
+void DataOrderingEngineTests::testParallelExactMin()
+{
+    std::mt19937 generator{17};
+    const DataSet c_DataSet{generateDataSet(16, 24, generator)};
+
+    DataOrderingEngine singleThreadedEngine{c_DataSet};
+    DataOrderingEngine multiThreadedEngine{c_DataSet};
+
+    QVERIFY(singleThreadedEngine.performExactMin(1));
+    QVERIFY(multiThreadedEngine.performExactMin(4));
+    QVERIFY(isPermutation(multiThreadedEngine.getOrderingIndexes(), c_DataSet.size()));
+    QVERIFY(multiThreadedEngine.getTotalTransitionsCount() == singleThreadedEngine.getTotalTransitionsCount());
+    QVERIFY(getTransitionsCount(multiThreadedEngine.getOrderedDataSet()) == *singleThreadedEngine.getTotalTransitionsCount());
+
+    QVERIFY(singleThreadedEngine.performExactMinUsingInversion(1));
+    QVERIFY(multiThreadedEngine.performExactMinUsingInversion(4));
+    QVERIFY(isPermutation(multiThreadedEngine.getOrderingIndexes(), c_DataSet.size()));
+    QVERIFY(multiThreadedEngine.getTotalTransitionsCount() == singleThreadedEngine.getTotalTransitionsCount());
+    QVERIFY(getTransitionsCount(multiThreadedEngine.getOrderedDataSet()) == *singleThreadedEngine.getTotalTransitionsCount());
+}
+
+void DataOrderingEngineTests::testExactMinNotPerformed()
+{
+    QFETCH(DataSet, dataSet);
+
+    DataOrderingEngine engine{dataSet};
+    engine.performGreedyMinSimplifiedUsingInversion();
+
+    const OrderingIndexes c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags c_InversionFlags{engine.getInversionFlags()};
+
+    QVERIFY(!engine.performExactMin(1));
+    QVERIFY(!engine.performExactMinUsingInversion(1));
+    QVERIFY(engine.getOrderingIndexes() == c_OrderingIndexes);
+    QVERIFY(engine.getInversionFlags() == c_InversionFlags);
+}
+
+void DataOrderingEngineTests::testAddWords()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(DataSet, words);
+    QFETCH(bool, inversionAllowed);
+
+    DataOrderingEngine engine{dataSet};
+    inversionAllowed ? engine.performGreedyMinSimplifiedUsingInversion() : engine.performGreedyMinSimplified();
+
+    DataSet resultingDataSet{dataSet};
+    resultingDataSet.insert(resultingDataSet.end(), words.cbegin(), words.cend());
+
+    // a single word is inserted where the transitions count increases the least
+    const size_t c_MinTransitionsCount{getMinTransitionsCountAfterInsertion(engine.getOrderedDataSet(), words.front(), inversionAllowed)};
+
+    QVERIFY(engine.addWords(words, inversionAllowed));
+    QVERIFY(isOrderingConsistent(engine, resultingDataSet));
+
+    if (1 == words.size() && !dataSet.empty())
+    {
+        QVERIFY(engine.getTotalTransitionsCount() == c_MinTransitionsCount);
+    }
+
+    QVERIFY(isEquivalentToRebuiltEngine(engine, resultingDataSet));
+}
+
+void DataOrderingEngineTests::testAddWordsNotPerformed()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(DataSet, words);
+
+    DataOrderingEngine engine{dataSet};
+    engine.performGreedyMinSimplified();
+
+    const OrderingIndexes c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags c_InversionFlags{engine.getInversionFlags()};
+    const DataSet c_OrderedDataSet{engine.getOrderedDataSet()};
+
+    QVERIFY(!engine.addWords(words));
+    QVERIFY(!engine.addWords(words, true));
+    QVERIFY(engine.getOrderingIndexes() == c_OrderingIndexes);
+    QVERIFY(engine.getInversionFlags() == c_InversionFlags);
+    QVERIFY(engine.getOrderedDataSet() == c_OrderedDataSet);
+}
+
+void DataOrderingEngineTests::testRemoveWords()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(std::vector<OrderingIndex>, wordIndexes);
+    QFETCH(bool, expectedResult);
+
+    DataOrderingEngine engine{dataSet};
+    engine.performGreedyMinSimplifiedUsingInversion();
+
+    const OrderingIndexes c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags c_InversionFlags{engine.getInversionFlags()};
+    const DataSet c_OrderedDataSet{engine.getOrderedDataSet()};
+
+    QVERIFY(engine.removeWords(wordIndexes) == expectedResult);
+
+    if (expectedResult)
+    {
+        DataSet resultingDataSet;
+        DataSet resultingOrderedDataSet;
+
+        for (size_t wordIndex{0}; wordIndex < dataSet.size(); ++wordIndex)
+        {
+            if (std::find(wordIndexes.cbegin(), wordIndexes.cend(), wordIndex) == wordIndexes.cend())
+            {
+                resultingDataSet.push_back(dataSet[wordIndex]);
+            }
+        }
+
+        // the remaining words keep their order and inversion
+        for (size_t orderingPosition{0}; orderingPosition < dataSet.size(); ++orderingPosition)
+        {
+            if (std::find(wordIndexes.cbegin(), wordIndexes.cend(), c_OrderingIndexes[orderingPosition]) == wordIndexes.cend())
+            {
+                resultingOrderedDataSet.push_back(c_OrderedDataSet[orderingPosition]);
+            }
+        }
+
+        QVERIFY(engine.getOrderedDataSet() == resultingOrderedDataSet);
+        QVERIFY(isOrderingConsistent(engine, resultingDataSet));
+        QVERIFY(isEquivalentToRebuiltEngine(engine, resultingDataSet));
+    }
+    else
+    {
+        QVERIFY(engine.getOrderingIndexes() == c_OrderingIndexes);
+        QVERIFY(engine.getInversionFlags() == c_InversionFlags);
+        QVERIFY(engine.getOrderedDataSet() == c_OrderedDataSet);
+    }
+}
+
+void DataOrderingEngineTests::testSegmentedInversion()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(size_t, segmentsCount);
+
+    DataOrderingEngine engine{dataSet};
+
+    QVERIFY(engine.performGreedyMinSimplifiedUsingSegmentedInversion(segmentsCount));
+    QVERIFY(isSegmentedOrderingConsistent(engine, dataSet, segmentsCount));
+
+    DataOrderingEngine wholeWordsEngine{dataSet};
+    wholeWordsEngine.performGreedyMinSimplifiedUsingInversion();
+
+    // a single segment is the whole word
+    if (1 == segmentsCount)
+    {
+        QVERIFY(engine.getOrderingIndexes() == wholeWordsEngine.getOrderingIndexes());
+        QVERIFY(engine.getInversionFlags() == wholeWordsEngine.getInversionFlags());
+        QVERIFY(engine.getTotalTransitionsCount() == wholeWordsEngine.getTotalTransitionsCount());
+    }
+
+    // the other modes should use a single segment again
+    engine.performGreedyMinSimplifiedUsingInversion();
+
+    QVERIFY(1 == engine.getInversionSegmentsCount());
+    QVERIFY(engine.getOrderingIndexes() == wholeWordsEngine.getOrderingIndexes());
+    QVERIFY(engine.getInversionFlags() == wholeWordsEngine.getInversionFlags());
+    QVERIFY(isOrderingConsistent(engine, dataSet));
+}
+
+void DataOrderingEngineTests::testSegmentedInversionNotPerformed()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(size_t, segmentsCount);
+
+    // the current segmented ordering (if any) should be kept
+    DataOrderingEngine engine{dataSet};
+    engine.performGreedyMinSimplifiedUsingSegmentedInversion(2);
+
+    const OrderingIndexes c_OrderingIndexes{engine.getOrderingIndexes()};
+    const InversionFlags c_InversionFlags{engine.getInversionFlags()};
+    const size_t c_SegmentsCount{engine.getInversionSegmentsCount()};
+
+    QVERIFY(!engine.performGreedyMinSimplifiedUsingSegmentedInversion(segmentsCount));
+    QVERIFY(engine.getOrderingIndexes() == c_OrderingIndexes);
+    QVERIFY(engine.getInversionFlags() == c_InversionFlags);
+    QVERIFY(engine.getInversionSegmentsCount() == c_SegmentsCount);
+}
+
+void DataOrderingEngineTests::testSegmentedInversionUpdates()
+{
+    QFETCH(DataSet, dataSet);
+    QFETCH(size_t, segmentsCount);
+    QFETCH(DataSet, words);
+    QFETCH(std::vector<OrderingIndex>, wordIndexes);
+
+    DataOrderingEngine engine{dataSet};
+    QVERIFY(engine.performGreedyMinSimplifiedUsingSegmentedInversion(segmentsCount));
+
+    // the added words get their own segment flags, the segments count is kept
+    DataSet resultingDataSet{dataSet};
+    resultingDataSet.insert(resultingDataSet.end(), words.cbegin(), words.cend());
+
+    QVERIFY(engine.addWords(words, true));
+    QVERIFY(isSegmentedOrderingConsistent(engine, resultingDataSet, segmentsCount));
+
+    const OrderingIndexes c_OrderingIndexes{engine.getOrderingIndexes()};
+    const DataSet c_OrderedDataSet{engine.getOrderedDataSet()};
+    DataSet remainingDataSet;
+    DataSet remainingOrderedDataSet;
+
+    for (size_t wordIndex{0}; wordIndex < resultingDataSet.size(); ++wordIndex)
+    {
+        if (std::find(wordIndexes.cbegin(), wordIndexes.cend(), wordIndex) == wordIndexes.cend())
+        {
+            remainingDataSet.push_back(resultingDataSet[wordIndex]);
+        }
+    }
+
+    for (size_t orderingPosition{0}; orderingPosition < resultingDataSet.size(); ++orderingPosition)
+    {
+        if (std::find(wordIndexes.cbegin(), wordIndexes.cend(), c_OrderingIndexes[orderingPosition]) == wordIndexes.cend())
+        {
+            remainingOrderedDataSet.push_back(c_OrderedDataSet[orderingPosition]);
+        }
+    }
+
+    QVERIFY(engine.removeWords(wordIndexes));
+    QVERIFY(engine.getOrderedDataSet() == remainingOrderedDataSet);
+    QVERIFY(isSegmentedOrderingConsistent(engine, remainingDataSet, segmentsCount));
+
+    // the incrementally updated words should be used when ordering again
+    DataOrderingEngine rebuiltEngine{remainingDataSet};
+
+    QVERIFY(engine.performGreedyMinSimplifiedUsingSegmentedInversion(segmentsCount));
+    QVERIFY(rebuiltEngine.performGreedyMinSimplifiedUsingSegmentedInversion(segmentsCount));
+    QVERIFY(engine.getOrderingIndexes() == rebuiltEngine.getOrderingIndexes());
+    QVERIFY(engine.getInversionFlags() == rebuiltEngine.getInversionFlags());
+    QVERIFY(isSegmentedOrderingConsistent(engine, remainingDataSet, segmentsCount));
+}
+
+void DataOrderingEngineTests::testExactMin_data()
+{
+    _buildExactMinTestTable();
+}
+
+void DataOrderingEngineTests::testExactMinUsingInversion_data()
+{
+    _buildExactMinTestTable();
+}
+
+void DataOrderingEngineTests::testExactMinNotPerformed_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+
+    std::mt19937 generator{5};
+
+    QTest::newRow("empty data set") << DataSet{};
+    QTest::newRow("words of different sizes") << DataSet{{true, false}, {true}, {false, false}};
+    QTest::newRow("too many words") << generateDataSet(DataOrderingEngine::c_MaxExactOrderingWordsCount + 1, 4, generator);
+
+    // the distance of a path should stay below 65535 (16 bit distances, maximum value reserved)
+    QTest::newRow("distance overflow: 2 words") << generateDataSet(2, 65535, generator);
+    QTest::newRow("distance overflow: 4 words") << generateDataSet(4, 21845, generator);
+    QTest::newRow("distance overflow: 8 words") << generateDataSet(8, 9363, generator);
+}
+
+void DataOrderingEngineTests::testAddWords_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<DataSet>("words");
+    QTest::addColumn<bool>("inversionAllowed");
+
+    std::mt19937 generator{7};
+
+    QTest::newRow("empty data set, 1 word") << DataSet{} << DataSet{{true, false, true}} << false;
+    QTest::newRow("empty data set, 5 words") << DataSet{} << generateDataSet(5, 6, generator) << true;
+    QTest::newRow("1 word, 1 word") << DataSet{{true, false, true}} << DataSet{{false, false, true}} << false;
+    QTest::newRow("complementary word") << DataSet{{true, true, false, false}, {true, true, true, false}} << DataSet{{false, false, true, true}} << true;
+
+    for (const bool c_InversionAllowed : {false, true})
+    {
+        const std::string c_Suffix{c_InversionAllowed ? ", inversion" : ""};
+
+        for (const size_t c_AddedWordsCount : {1u, 3u})
+        {
+            for (const size_t c_WordSize : {8u, 70u})
+            {
+                const std::string c_RowName{"6 words, " + std::to_string(c_AddedWordsCount) + " added words, " + std::to_string(c_WordSize) + " bits" + c_Suffix};
+                QTest::newRow(c_RowName.c_str()) << generateDataSet(6, c_WordSize, generator) << generateDataSet(c_AddedWordsCount, c_WordSize, generator) << c_InversionAllowed;
+            }
+        }
+
+        QTest::newRow(("40 words, 10 added words" + c_Suffix).c_str()) << generateDataSet(40, 16, generator) << generateDataSet(10, 16, generator) << c_InversionAllowed;
+    }
+}
+
+void DataOrderingEngineTests::testAddWordsNotPerformed_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<DataSet>("words");
+
+    QTest::newRow("no words") << DataSet{{true, false}, {false, false}} << DataSet{};
+    QTest::newRow("different word size") << DataSet{{true, false}, {false, false}} << DataSet{{true, false, true}};
+    QTest::newRow("different word sizes") << DataSet{{true, false}, {false, false}} << DataSet{{true, false}, {true}};
+    QTest::newRow("empty data set, different word sizes") << DataSet{} << DataSet{{true, false}, {true}};
+    QTest::newRow("empty word") << DataSet{} << DataSet{{}};
+
+    // the words of the data set should not be discarded
+    QTest::newRow("invalid data set") << DataSet{{true, false}, {true}, {false, false}} << DataSet{{true, true}};
+}
+
+void DataOrderingEngineTests::testRemoveWords_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<std::vector<OrderingIndex>>("wordIndexes");
+    QTest::addColumn<bool>("expectedResult");
+
+    std::mt19937 generator{11};
+    const DataSet c_DataSet{generateDataSet(8, 12, generator)};
+
+    QTest::newRow("first word") << c_DataSet << std::vector<OrderingIndex>{0} << true;
+    QTest::newRow("last word") << c_DataSet << std::vector<OrderingIndex>{7} << true;
+    QTest::newRow("multiple words") << c_DataSet << std::vector<OrderingIndex>{6, 1, 3} << true;
+    QTest::newRow("duplicate indexes") << c_DataSet << std::vector<OrderingIndex>{2, 5, 2, 5, 5} << true;
+    QTest::newRow("all but one") << c_DataSet << std::vector<OrderingIndex>{0, 1, 2, 3, 5, 6, 7} << true;
+    QTest::newRow("all words") << c_DataSet << std::vector<OrderingIndex>{7, 6, 5, 4, 3, 2, 1, 0} << true;
+    QTest::newRow("40 words") << generateDataSet(40, 70, generator) << std::vector<OrderingIndex>{39, 0, 17, 18, 25, 4} << true;
+    QTest::newRow("no indexes") << c_DataSet << std::vector<OrderingIndex>{} << false;
+    QTest::newRow("out of range index") << c_DataSet << std::vector<OrderingIndex>{8} << false;
+    QTest::newRow("valid and out of range indexes") << c_DataSet << std::vector<OrderingIndex>{1, 3, 12} << false;
+    QTest::newRow("duplicate out of range indexes") << c_DataSet << std::vector<OrderingIndex>{2, 9, 9} << false;
+    QTest::newRow("empty data set") << DataSet{} << std::vector<OrderingIndex>{0} << false;
+}
+
+void DataOrderingEngineTests::testSegmentedInversion_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<size_t>("segmentsCount");
+
+    std::mt19937 generator{13};
+
+    QTest::newRow("1 word") << DataSet{{true, false, true, true}} << size_t{2};
+    QTest::newRow("2 words") << DataSet{{true, false, true, true}, {false, true, true, true}} << size_t{2};
+    QTest::newRow("complementary halves") << DataSet{{true, true, false, false}, {false, false, false, false}, {true, true, true, true}} << size_t{2};
+    QTest::newRow("single bit segments") << generateDataSet(6, 5, generator) << size_t{5};
+    QTest::newRow("uneven segments") << generateDataSet(10, 70, generator) << size_t{3};
+    QTest::newRow("segments across blocks") << generateDataSet(10, 200, generator) << size_t{7};
+
+    for (const size_t c_WordSize : {8u, 64u, 70u})
+    {
+        for (const size_t c_WordsCount : {5u, 40u})
+        {
+            const std::string c_RowName{std::to_string(c_WordsCount) + " words, " + std::to_string(c_WordSize) + " bits, 1 segment"};
+            QTest::newRow(c_RowName.c_str()) << generateDataSet(c_WordsCount, c_WordSize, generator) << size_t{1};
+        }
+    }
+
+    QTest::newRow("100 words, 32 bits, 1 segment") << generateDataSet(100, 32, generator) << size_t{1};
+    QTest::newRow("100 words, 32 bits, 4 segments") << generateDataSet(100, 32, generator) << size_t{4};
+}
+
+void DataOrderingEngineTests::testSegmentedInversionNotPerformed_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<size_t>("segmentsCount");
+
+    std::mt19937 generator{19};
+    const DataSet c_DataSet{generateDataSet(6, 10, generator)};
+
+    QTest::newRow("no segments") << c_DataSet << size_t{0};
+    QTest::newRow("more segments than bits") << c_DataSet << size_t{11};
+    QTest::newRow("more segments than bits (large)") << c_DataSet << size_t{1000};
+    QTest::newRow("empty data set") << DataSet{} << size_t{1};
+    QTest::newRow("words of different sizes") << DataSet{{true, false}, {true}, {false, false}} << size_t{1};
+}
+
+void DataOrderingEngineTests::testSegmentedInversionUpdates_data()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<size_t>("segmentsCount");
+    QTest::addColumn<DataSet>("words");
+    QTest::addColumn<std::vector<OrderingIndex>>("wordIndexes");
+
+    std::mt19937 generator{23};
+
+    QTest::newRow("1 added, 1 removed") << generateDataSet(8, 12, generator) << size_t{3} << generateDataSet(1, 12, generator) << std::vector<OrderingIndex>{2};
+    QTest::newRow("added word removed") << generateDataSet(8, 12, generator) << size_t{2} << generateDataSet(1, 12, generator) << std::vector<OrderingIndex>{8};
+    QTest::newRow("multiple blocks") << generateDataSet(20, 150, generator) << size_t{4} << generateDataSet(5, 150, generator) << std::vector<OrderingIndex>{0, 24, 7, 13};
+    QTest::newRow("all initial words removed") << generateDataSet(5, 20, generator) << size_t{5} << generateDataSet(3, 20, generator) << std::vector<OrderingIndex>{0, 1, 2, 3, 4};
+}
+
+void DataOrderingEngineTests::_buildExactMinTestTable()
+{
+    QTest::addColumn<DataSet>("dataSet");
+    QTest::addColumn<size_t>("threadsCount");
+
+    std::mt19937 generator{3};
+
+    QTest::newRow("1 word") << DataSet{{true, false, true}} << size_t{1};
+    QTest::newRow("2 words") << DataSet{{true, false, true}, {false, true, true}} << size_t{1};
+    QTest::newRow("identical words") << DataSet{{true, true, false, false}, {true, true, false, false}, {true, true, false, false}} << size_t{1};
+    QTest::newRow("complementary words") << DataSet{{true, true, false, false}, {false, false, true, true}, {true, true, false, false}, {false, false, true, true}} << size_t{1};
+    QTest::newRow("single bit words") << DataSet{{true}, {false}, {true}, {false}, {false}} << size_t{1};
+
+    for (const size_t c_WordsCount : {3u, 5u, 7u, 8u})
+    {
+        for (const size_t c_WordSize : {5u, 16u, 70u})
+        {
+            const std::string c_RowName{std::to_string(c_WordsCount) + " words, " + std::to_string(c_WordSize) + " bits"};
+            QTest::newRow(c_RowName.c_str()) << generateDataSet(c_WordsCount, c_WordSize, generator) << size_t{1};
+        }
+    }
+
+    QTest::newRow("8 words, 12 bits, 4 threads") << generateDataSet(8, 12, generator) << size_t{4};
+
+    // largest path distances that still fit into 16 bits
+    QTest::newRow("no distance overflow: 2 words") << generateDataSet(2, 65534, generator) << size_t{1};
+    QTest::newRow("no distance overflow: 4 words") << generateDataSet(4, 21844, generator) << size_t{1};
+    QTest::newRow("no distance overflow: 8 words") << generateDataSet(8, 9362, generator) << size_t{1};
+}
+
+QTEST_APPLESS_MAIN(DataOrderingEngineTests)
+
+#include "tst_dataorderingenginetests.moc"
+// clang-format on
@@ -1,6 +1,23 @@
 #include "dataordering_io.h"
+#include "instrumentation.h"
 #include "matrixutils.h"
 
+// the flags of the segments of the same word are grouped together
+static void writeInversionFlags(std::ostream& out, const InversionFlags& inversionFlags, size_t segmentsCount)
+{
+    if (segmentsCount > 1)
+    {
+        for (size_t flagIndex{0}; flagIndex < inversionFlags.size(); ++flagIndex)
+        {
+            out << (flagIndex > 0 && 0 == flagIndex % segmentsCount ? " " : "") << inversionFlags[flagIndex];
+        }
+    }
+    else
+    {
+        out << inversionFlags;
+    }
+}
+
 DataOrderingFileReader::DataOrderingFileReader(const std::string& inputFilePath)
 {
     setInputFilePath(inputFilePath);
@@ -8,6 +25,8 @@ DataOrderingFileReader::DataOrderingFileReader(const std::string& inputFilePath)
 
 Result DataOrderingFileReader::readDataSetFromFile()
 {
+    INSTRUMENT_SCOPE("DataOrderingFileReader::parseDataSet");
+
     ResultType resultType{ResultType::SUCCESS};
     std::optional<DataSet> resultingDataSet;
 
@@ -64,7 +83,6 @@ DataOrderingFileWriter::DataOrderingFileWriter(const std::string& outputFilePath
 Result DataOrderingFileWriter::writeScenarioOutputToFile(const std::string& header, const DataOrderingEngine& engine)
 {
     ResultType resultType{ResultType::SUCCESS};
-    std::optional<DataSet> resultingDataSet;
 
     if (!m_Out.is_open())
     {
@@ -73,24 +91,15 @@ Result DataOrderingFileWriter::writeScenarioOutputToFile(const std::string& head
 
     if (m_Out.is_open())
     {
-        resultingDataSet = engine.getOrderedDataSet();
-
-        m_Out << header << "\n\n";
-        m_Out << "The transmitted data words are: \n\n";
-        m_Out << *resultingDataSet << "\n";
-        m_Out << "Transmission order: ";
-        m_Out << Utilities::toSizeVector(engine.getOrderingIndexes()) << "\n";
-        m_Out << "Inversion status: ";
-        m_Out << engine.getInversionFlags() << "\n";
-        m_Out << "Total number of transitions is: ";
-        m_Out << *engine.getTotalTransitionsCount() << "\n";
+        writeScenarioOutput(m_Out, header, engine);
     }
     else
     {
         resultType = ResultType::OUTPUT_FILE_OPENING_ERROR;
     }
 
-    return {resultType, resultingDataSet};
+    // the ordered data set is not returned (would be an unnecessary copy), it can be retrieved from the engine
+    return {resultType, std::nullopt};
 }
 
 void DataOrderingFileWriter::beginSection()
@@ -116,6 +125,40 @@ void DataOrderingFileWriter::endSection()
     }
 }
 
+Result DataOrderingFileWriter::writeSectionToFile(const std::string& sectionOutput)
+{
+    ResultType resultType{ResultType::SUCCESS};
+
+    beginSection();
+
+    if (m_Out.is_open())
+    {
+        m_Out << sectionOutput;
+        endSection();
+    }
+    else
+    {
+        resultType = ResultType::OUTPUT_FILE_OPENING_ERROR;
+    }
+
+    return {resultType, std::nullopt};
+}
+
+void DataOrderingFileWriter::writeScenarioOutput(std::ostream& out, const std::string& header,
+                                                 const DataOrderingEngine& engine)
+{
+    out << header << "\n\n";
+    out << "The transmitted data words are: \n\n";
+    out << engine.getOrderedDataSetView() << "\n";
+    out << "Transmission order: ";
+    out << Utilities::toSizeVector(engine.getOrderingIndexes()) << "\n";
+    out << "Inversion status: ";
+    writeInversionFlags(out, engine.getInversionFlags(), engine.getInversionSegmentsCount());
+    out << "\n";
+    out << "Total number of transitions is: ";
+    out << *engine.getTotalTransitionsCount() << "\n";
+}
+
 void DataOrderingFileWriter::setOutputFilePath(const std::string& outputFilePath)
 {
     if (m_OutputFilePath != outputFilePath)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fstream>
+#include <ostream>
 #include <string>
 
 #include "dataorderingengine.h"
@@ -39,6 +40,11 @@ public:
     void beginSection();
     void endSection();
 
+    // writes a complete section (scenario outputs previously written to a string by using writeScenarioOutput())
+    Result writeSectionToFile(const std::string& sectionOutput);
+
+    static void writeScenarioOutput(std::ostream& out, const std::string& header, const DataOrderingEngine& engine);
+
     void setOutputFilePath(const std::string& outputFilePath);
     const std::string& getOutputFilePath() const;
 
@@ -1,11 +1,45 @@
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 
 #include "dataorderingengine.h"
+#include "instrumentation.h"
 
 #define NO_INVERSION false
 #define INVERSION_ALLOWED true
 
+static constexpr size_t c_BitsPerBlock{64};
+
+// Hamming distance between the bits of two packed words that are located within [segmentBegin, segmentEnd)
+static size_t getPackedSegmentHammingDistance(const uint64_t* firstWordBlocks, const uint64_t* secondWordBlocks,
+                                              size_t segmentBegin, size_t segmentEnd)
+{
+    size_t hammingDistance{0};
+
+    for (size_t blockIndex{segmentBegin / c_BitsPerBlock}; blockIndex * c_BitsPerBlock < segmentEnd; ++blockIndex)
+    {
+        const size_t c_BlockBegin{blockIndex * c_BitsPerBlock};
+        uint64_t mask{~uint64_t{0}};
+
+        if (segmentBegin > c_BlockBegin)
+        {
+            mask &= mask << (segmentBegin - c_BlockBegin);
+        }
+
+        if (segmentEnd < c_BlockBegin + c_BitsPerBlock)
+        {
+            mask &= ~uint64_t{0} >> (c_BlockBegin + c_BitsPerBlock - segmentEnd);
+        }
+
+        hammingDistance +=
+            static_cast<size_t>(std::popcount((firstWordBlocks[blockIndex] ^ secondWordBlocks[blockIndex]) & mask));
+    }
+
+    return hammingDistance;
+}
+
 DataOrderingEngine::DataOrderingEngine(const DataSet& dataSet)
 {
     setDataSet(dataSet);
@@ -13,158 +47,291 @@ DataOrderingEngine::DataOrderingEngine(const DataSet& dataSet)
 
 void DataOrderingEngine::performGreedyMinSimplified()
 {
+    INSTRUMENT_SCOPE("DataOrderingEngine::greedySelection");
+
+    _performGreedyMinSimplified(m_AdjacencyMatrix, NO_INVERSION);
+}
+
+void DataOrderingEngine::performGreedyMinSimplifiedUsingInversion()
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::greedySelectionWithInversion");
+
+    _performGreedyMinSimplified(m_AdjacencyMatrix, INVERSION_ALLOWED);
+}
+
+bool DataOrderingEngine::performGreedyMinSimplifiedUsingSegmentedInversion(size_t segmentsCount)
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::greedySelectionWithSegmentedInversion");
+
+    bool success{false};
+
     do
     {
-        if (!m_WordSize.has_value())
+        if (!m_WordSize.has_value() || 0 == segmentsCount || segmentsCount > *m_WordSize)
         {
             break;
         }
 
         const size_t c_DataSetSize{m_DataSet.size()};
+        const size_t c_BlocksPerWord{m_PackedDataSet.m_BlocksPerWord};
 
-        if (0 == c_DataSetSize)
-        {
-            break;
-        }
-
-        if (m_OrderingIndexes.size() != c_DataSetSize || m_InversionFlags.size() != c_DataSetSize)
+        if (m_OrderingIndexes.size() != c_DataSetSize ||
+            m_InversionFlags.size() != c_DataSetSize * m_InversionSegmentsCount ||
+            m_PackedDataSet.m_Blocks.size() != c_DataSetSize * c_BlocksPerWord)
         {
             assert(false);
             break;
         }
 
-        StatusFlags wordAlreadyAddedStatuses;
-        std::optional<OrderingIndex> currentWordIndex{_initGreedyMinSimplified(NO_INVERSION, wordAlreadyAddedStatuses)};
+        std::vector<size_t> segmentBegins(segmentsCount + 1);
 
-        if (wordAlreadyAddedStatuses.size() != c_DataSetSize)
+        for (size_t segmentIndex{0}; segmentIndex <= segmentsCount; ++segmentIndex)
         {
-            assert(false);
-            break;
+            segmentBegins[segmentIndex] = Utilities::getSegmentBegin(*m_WordSize, segmentsCount, segmentIndex);
         }
 
-        // continue with the remaining words, add them at one end of the ordered set (first the distance between second
-        // added word and another one is considered and so on...)
-        size_t addedWordsCount{
-            static_cast<size_t>(std::count(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(), true))};
+        // distances with the best inversion of each segment (symmetric, so computed once for each pair of words)
+        const matrix_size_t c_WordsCount{static_cast<matrix_size_t>(c_DataSetSize)};
+        AdjacencyMatrix segmentedAdjacencyMatrix;
+        segmentedAdjacencyMatrix.resize(c_WordsCount, c_WordsCount);
 
-        if (0 == addedWordsCount)
-        {
-            assert(false);
-            break;
-        }
+        INSTRUMENT_COUNT("DataOrderingEngine::segmentedDistancesCount", c_DataSetSize * (c_DataSetSize - 1ull) / 2);
 
-        for (; addedWordsCount < c_DataSetSize; ++addedWordsCount)
+        for (matrix_size_t firstWordIndex{0}; firstWordIndex < c_WordsCount; ++firstWordIndex)
         {
-            std::optional<OrderingIndex> nextWordIndex;
-            _retrieveNextOrderedWord(wordAlreadyAddedStatuses, currentWordIndex, nextWordIndex);
+            const uint64_t* const c_FirstWordBlocks{m_PackedDataSet.m_Blocks.data() + firstWordIndex * c_BlocksPerWord};
 
-            if (!nextWordIndex.has_value() || nextWordIndex >= c_DataSetSize || nextWordIndex == currentWordIndex)
+            for (matrix_size_t secondWordIndex{firstWordIndex + 1}; secondWordIndex < c_WordsCount; ++secondWordIndex)
             {
-                assert(false);
-                break;
+                const uint64_t* const c_SecondWordBlocks{m_PackedDataSet.m_Blocks.data() +
+                                                         secondWordIndex * c_BlocksPerWord};
+                size_t distance{0};
+
+                for (size_t segmentIndex{0}; segmentIndex < segmentsCount; ++segmentIndex)
+                {
+                    const size_t c_SegmentSize{segmentBegins[segmentIndex + 1] - segmentBegins[segmentIndex]};
+                    const size_t c_HammingDistance{getPackedSegmentHammingDistance(
+                        c_FirstWordBlocks, c_SecondWordBlocks, segmentBegins[segmentIndex],
+                        segmentBegins[segmentIndex + 1])};
+
+                    distance += std::min(c_HammingDistance, c_SegmentSize - c_HammingDistance);
+                }
+
+                segmentedAdjacencyMatrix.at(firstWordIndex, secondWordIndex) = distance;
+                segmentedAdjacencyMatrix.at(secondWordIndex, firstWordIndex) = distance;
             }
 
-            currentWordIndex = nextWordIndex;
-            m_OrderingIndexes[addedWordsCount] = *currentWordIndex;
-            m_InversionFlags[addedWordsCount] = false;
-            wordAlreadyAddedStatuses[*currentWordIndex] = true;
+            segmentedAdjacencyMatrix.at(firstWordIndex, firstWordIndex) = 0;
         }
 
-        if (std::any_of(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(),
-                        [](bool added) { return !added; }))
+        /* same selection as for whole words: the distances are already minimized by inverting the segments, so the
+           words are ordered without inversion (for a single segment this results in the same ordering as
+           performGreedyMinSimplifiedUsingInversion())
+        */
+        if (!_performGreedyMinSimplified(segmentedAdjacencyMatrix, NO_INVERSION))
         {
             assert(false);
             break;
         }
 
-        _updateOrderedDataSet();
+        m_InversionSegmentsCount = segmentsCount;
+        m_InversionFlags.assign(c_DataSetSize * segmentsCount, false);
+
+        // a segment is inverted relative to the same segment of the predecessor if the distance becomes smaller
+        for (size_t orderingPosition{1}; orderingPosition < c_DataSetSize; ++orderingPosition)
+        {
+            const uint64_t* const c_PreviousWordBlocks{m_PackedDataSet.m_Blocks.data() +
+                                                       m_OrderingIndexes[orderingPosition - 1] * c_BlocksPerWord};
+            const uint64_t* const c_CurrentWordBlocks{m_PackedDataSet.m_Blocks.data() +
+                                                      m_OrderingIndexes[orderingPosition] * c_BlocksPerWord};
+
+            for (size_t segmentIndex{0}; segmentIndex < segmentsCount; ++segmentIndex)
+            {
+                const size_t c_SegmentSize{segmentBegins[segmentIndex + 1] - segmentBegins[segmentIndex]};
+                const size_t c_HammingDistance{
+                    getPackedSegmentHammingDistance(c_PreviousWordBlocks, c_CurrentWordBlocks,
+                                                    segmentBegins[segmentIndex], segmentBegins[segmentIndex + 1])};
+                const size_t c_FlagIndex{orderingPosition * segmentsCount + segmentIndex};
+                const bool c_IsInvertedSuccessor{c_SegmentSize - c_HammingDistance < c_HammingDistance};
+
+                m_InversionFlags[c_FlagIndex] = c_IsInvertedSuccessor != m_InversionFlags[c_FlagIndex - segmentsCount];
+            }
+        }
+
+        success = true;
     } while (false);
+
+    return success;
 }
 
-void DataOrderingEngine::performGreedyMinSimplifiedUsingInversion()
+bool DataOrderingEngine::performExactMin(size_t threadsCount)
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::exactOrdering");
+
+    return _performExactMin(NO_INVERSION, threadsCount);
+}
+
+bool DataOrderingEngine::performExactMinUsingInversion(size_t threadsCount)
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::exactOrderingWithInversion");
+
+    return _performExactMin(INVERSION_ALLOWED, threadsCount);
+}
+
+void DataOrderingEngine::setDataSet(const DataSet& dataSet)
 {
+    _reset();
+    m_DataSet = dataSet;
+    _init();
+}
+
+void DataOrderingEngine::setDataSet(DataSet&& dataSet)
+{
+    _reset();
+    m_DataSet = std::move(dataSet);
+    _init();
+}
+
+bool DataOrderingEngine::addWords(const DataSet& words, bool inversionAllowed)
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::addWords");
+
+    bool success{false};
+
     do
     {
-        if (!m_WordSize.has_value())
+        // an invalid data set (e.g. containing words of different sizes) cannot be extended
+        if (words.empty() || (!m_DataSet.empty() && m_AdjacencyMatrix.isEmpty()))
         {
             break;
         }
 
-        const size_t c_DataSetSize{m_DataSet.size()};
+        const size_t c_WordSize{m_WordSize.has_value() ? *m_WordSize : words.front().size()};
 
-        if (0 == c_DataSetSize)
+        if (0 == c_WordSize ||
+            !std::all_of(words.cbegin(), words.cend(),
+                         [c_WordSize](const auto& word) { return c_WordSize == word.size(); }))
         {
             break;
         }
 
-        if (m_OrderingIndexes.size() != c_DataSetSize || m_InversionFlags.size() != c_DataSetSize)
+        // nothing to update incrementally, the words are ordered from scratch (by insertion)
+        if (m_DataSet.empty())
         {
-            assert(false);
-            break;
+            setDataSet(words);
+            m_OrderingIndexes.clear();
+            m_InversionFlags.clear();
         }
+        else
+        {
+            const PackedDataSet c_PackedWords{Utilities::packDataSet(words)};
 
-        StatusFlags wordAlreadyAddedStatuses;
-        std::optional<OrderingIndex> currentWordIndex{
-            _initGreedyMinSimplified(INVERSION_ALLOWED, wordAlreadyAddedStatuses)};
+            _appendToAdjacencyMatrix(words);
+            m_DataSet.insert(m_DataSet.end(), words.cbegin(), words.cend());
+            m_PackedDataSet.m_Blocks.insert(m_PackedDataSet.m_Blocks.end(), c_PackedWords.m_Blocks.cbegin(),
+                                            c_PackedWords.m_Blocks.cend());
+        }
 
-        if (wordAlreadyAddedStatuses.size() != c_DataSetSize)
+        if (m_AdjacencyMatrix.getNrOfRows() != m_DataSet.size() ||
+            m_AdjacencyMatrix.getNrOfColumns() != m_DataSet.size())
         {
             assert(false);
             break;
         }
 
-        // continue with the remaining words, add them at one end of the ordered set (first the distance between second
-        // added word and another one is considered and so on...)
-        size_t addedWordsCount{
-            static_cast<size_t>(std::count(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(), true))};
+        for (size_t wordIndex{m_DataSet.size() - words.size()}; wordIndex < m_DataSet.size(); ++wordIndex)
+        {
+            _insertIntoOrdering(static_cast<OrderingIndex>(wordIndex), inversionAllowed);
+        }
 
-        if (0 == addedWordsCount)
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+bool DataOrderingEngine::removeWords(std::vector<OrderingIndex> wordIndexes)
+{
+    INSTRUMENT_SCOPE("DataOrderingEngine::removeWords");
+
+    bool success{false};
+
+    do
+    {
+        const size_t c_DataSetSize{m_DataSet.size()};
+
+        std::sort(wordIndexes.begin(), wordIndexes.end());
+        wordIndexes.erase(std::unique(wordIndexes.begin(), wordIndexes.end()), wordIndexes.end());
+
+        if (wordIndexes.empty() || wordIndexes.back() >= c_DataSetSize)
+        {
+            break;
+        }
+
+        if (m_AdjacencyMatrix.getNrOfRows() != c_DataSetSize || m_AdjacencyMatrix.getNrOfColumns() != c_DataSetSize ||
+            m_OrderingIndexes.size() != c_DataSetSize ||
+            m_InversionFlags.size() != c_DataSetSize * m_InversionSegmentsCount)
         {
             assert(false);
             break;
         }
 
-        for (; addedWordsCount < c_DataSetSize; ++addedWordsCount)
+        success = true;
+
+        if (wordIndexes.size() == c_DataSetSize)
         {
-            std::optional<OrderingIndex> nextWordIndex;
-            const bool isInvertedSuccessor{
-                _retrieveNextOrderedWordUsingInversion(wordAlreadyAddedStatuses, currentWordIndex, nextWordIndex)};
+            _reset();
+            break;
+        }
 
-            if (!nextWordIndex.has_value() || nextWordIndex >= c_DataSetSize || nextWordIndex == currentWordIndex)
-            {
-                assert(false);
-                break;
-            }
+        _eraseFromAdjacencyMatrix(wordIndexes);
 
-            currentWordIndex = nextWordIndex;
-            m_OrderingIndexes[addedWordsCount] = *currentWordIndex;
-            m_InversionFlags[addedWordsCount] = isInvertedSuccessor ? !m_InversionFlags.at(addedWordsCount - 1)
-                                                                    : m_InversionFlags.at(addedWordsCount - 1);
-            wordAlreadyAddedStatuses[*currentWordIndex] = true;
+        // erase from the highest index so the remaining indexes to erase stay valid
+        for (auto wordIndexIt{wordIndexes.crbegin()}; wordIndexIt != wordIndexes.crend(); ++wordIndexIt)
+        {
+            const auto c_WordBlocksIt{m_PackedDataSet.m_Blocks.begin() +
+                                      *wordIndexIt * m_PackedDataSet.m_BlocksPerWord};
+
+            m_DataSet.erase(m_DataSet.begin() + *wordIndexIt);
+            m_PackedDataSet.m_Blocks.erase(c_WordBlocksIt, c_WordBlocksIt + m_PackedDataSet.m_BlocksPerWord);
         }
 
-        if (std::any_of(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(),
-                        [](bool added) { return !added; }))
+        OrderingIndexes orderingIndexes;
+        InversionFlags inversionFlags;
+
+        orderingIndexes.reserve(m_DataSet.size());
+        inversionFlags.reserve(m_DataSet.size() * m_InversionSegmentsCount);
+
+        for (size_t orderingPosition{0}; orderingPosition < c_DataSetSize; ++orderingPosition)
         {
-            assert(false);
-            break;
+            const OrderingIndex c_WordIndex{m_OrderingIndexes[orderingPosition]};
+            const auto c_RemovedWordIt{std::lower_bound(wordIndexes.cbegin(), wordIndexes.cend(), c_WordIndex)};
+
+            if (c_RemovedWordIt == wordIndexes.cend() || *c_RemovedWordIt != c_WordIndex)
+            {
+                // the index decreases by the number of removed words that precede it within the data set
+                orderingIndexes.push_back(
+                    c_WordIndex - static_cast<OrderingIndex>(std::distance(wordIndexes.cbegin(), c_RemovedWordIt)));
+                std::copy_n(m_InversionFlags.cbegin() + orderingPosition * m_InversionSegmentsCount,
+                            m_InversionSegmentsCount, std::back_inserter(inversionFlags));
+            }
         }
 
-        _updateOrderedDataSet();
+        m_OrderingIndexes = std::move(orderingIndexes);
+        m_InversionFlags = std::move(inversionFlags);
     } while (false);
+
+    return success;
 }
 
-void DataOrderingEngine::setDataSet(const DataSet& dataSet)
+OrderedDataSetView DataOrderingEngine::getOrderedDataSetView() const
 {
-    _reset();
-    m_DataSet = dataSet;
-    m_OrderedDataSet = dataSet;
-    _init();
+    return OrderedDataSetView{m_DataSet, m_OrderingIndexes, m_InversionFlags, m_InversionSegmentsCount};
 }
 
-const DataSet& DataOrderingEngine::getOrderedDataSet() const
+DataSet DataOrderingEngine::getOrderedDataSet() const
 {
-    return m_OrderedDataSet;
+    return getOrderedDataSetView().toDataSet();
 }
 
 const OrderingIndexes& DataOrderingEngine::getOrderingIndexes() const
@@ -177,6 +344,11 @@ const InversionFlags& DataOrderingEngine::getInversionFlags() const
     return m_InversionFlags;
 }
 
+size_t DataOrderingEngine::getInversionSegmentsCount() const
+{
+    return m_InversionSegmentsCount;
+}
+
 HammingDistance DataOrderingEngine::getTotalTransitionsCount() const
 {
     HammingDistance transitionsCount{0};
@@ -188,12 +360,13 @@ HammingDistance DataOrderingEngine::getTotalTransitionsCount() const
     const size_t c_NrOfColumns{m_AdjacencyMatrix.getNrOfColumns()};
 
     assert(c_OrderingIndexesSize == c_DataSetSize);
-    assert(c_InversionFlagsSize == c_DataSetSize);
+    assert(c_InversionFlagsSize == c_DataSetSize * m_InversionSegmentsCount);
     assert(c_NrOfRows == c_DataSetSize);
     assert(c_NrOfColumns == c_DataSetSize);
 
     if (m_WordSize.has_value() && m_WordSize > 0 && c_DataSetSize > 1 && c_OrderingIndexesSize == c_DataSetSize &&
-        c_InversionFlagsSize == c_DataSetSize && c_NrOfRows == c_DataSetSize && c_NrOfColumns == c_DataSetSize)
+        c_InversionFlagsSize == c_DataSetSize * m_InversionSegmentsCount && c_NrOfRows == c_DataSetSize &&
+        c_NrOfColumns == c_DataSetSize)
     {
         for (size_t currentWordIndex{0}; currentWordIndex < c_DataSetSize - 1; ++currentWordIndex)
         {
@@ -215,13 +388,16 @@ HammingDistance DataOrderingEngine::getTotalTransitionsCount() const
                 break;
             }
 
-            if (m_InversionFlags[currentWordIndex] != m_InversionFlags[currentWordIndex + 1])
+            // normalize Hamming distance if one of the words is inverted (each segment separately if segmented)
+            for (size_t segmentIndex{0}; segmentIndex < m_InversionSegmentsCount; ++segmentIndex)
             {
-                hammingDistance =
-                    *m_WordSize - *hammingDistance; // normalize Hamming distance if one of the words is inverted
-            }
+                const size_t c_FlagIndex{currentWordIndex * m_InversionSegmentsCount + segmentIndex};
 
-            transitionsCount = *transitionsCount + *hammingDistance;
+                transitionsCount =
+                    *transitionsCount + _getSegmentTransitionsCount(
+                                            c_FirstWordIndex, m_InversionFlags[c_FlagIndex], c_SecondWordIndex,
+                                            m_InversionFlags[c_FlagIndex + m_InversionSegmentsCount], segmentIndex);
+            }
         }
     }
 
@@ -258,6 +434,7 @@ void DataOrderingEngine::_init()
     if (m_WordSize.has_value() && m_WordSize > 0 && m_AdjacencyMatrix.isEmpty() && m_OrderingIndexes.empty() &&
         m_InversionFlags.empty())
     {
+        m_PackedDataSet = Utilities::packDataSet(m_DataSet);
         _buildAdjacencyMatrix();
     }
 
@@ -299,6 +476,8 @@ void DataOrderingEngine::_computeWordSize()
 
 void DataOrderingEngine::_buildAdjacencyMatrix()
 {
+    INSTRUMENT_SCOPE("DataOrderingEngine::buildAdjacencyMatrix");
+
     AdjacencyMatrix newAdjacencyMatrix;
 
     if (!m_DataSet.empty() && m_WordSize.has_value() && m_WordSize > 0)
@@ -308,6 +487,8 @@ void DataOrderingEngine::_buildAdjacencyMatrix()
         const matrix_size_t c_WordsCount{static_cast<matrix_size_t>(m_DataSet.size())};
         newAdjacencyMatrix.resize(c_WordsCount, c_WordsCount);
 
+        INSTRUMENT_COUNT("DataOrderingEngine::hammingDistancesCount", c_WordsCount * (c_WordsCount - 1ull) / 2);
+
         for (matrix_size_t firstWordPos{0}; firstWordPos < c_WordsCount; ++firstWordPos)
         {
             for (matrix_size_t secondWordPos{firstWordPos + 1}; secondWordPos < c_WordsCount; ++secondWordPos)
@@ -340,17 +521,296 @@ void DataOrderingEngine::_buildAdjacencyMatrix()
     m_AdjacencyMatrix = std::move(newAdjacencyMatrix);
 }
 
+/* The matrix is rebuilt once per batch (instead of inserting/erasing a row and column for each word) by copying the
+   existing distances, so only the distances between the new words and the other words need to be computed.
+   The new words should have the same size as the data set words and should not be appended to the data set yet.
+*/
+void DataOrderingEngine::_appendToAdjacencyMatrix(const DataSet& words)
+{
+    const matrix_size_t c_OldWordsCount{static_cast<matrix_size_t>(m_DataSet.size())};
+    const matrix_size_t c_WordsCount{static_cast<matrix_size_t>(m_DataSet.size() + words.size())};
+
+    AdjacencyMatrix newAdjacencyMatrix;
+    newAdjacencyMatrix.resize(c_WordsCount, c_WordsCount);
+
+    for (matrix_size_t firstWordPos{0}; firstWordPos < c_OldWordsCount; ++firstWordPos)
+    {
+        std::copy(m_AdjacencyMatrix.constZRowBegin(firstWordPos), m_AdjacencyMatrix.constZRowEnd(firstWordPos),
+                  newAdjacencyMatrix.zRowBegin(firstWordPos));
+    }
+
+    INSTRUMENT_COUNT("DataOrderingEngine::hammingDistancesCount",
+                     words.size() * c_OldWordsCount + words.size() * (words.size() - 1ull) / 2);
+
+    for (matrix_size_t firstWordPos{c_OldWordsCount}; firstWordPos < c_WordsCount; ++firstWordPos)
+    {
+        const DataWord& c_FirstWord{words[firstWordPos - c_OldWordsCount]};
+
+        for (matrix_size_t secondWordPos{0}; secondWordPos < firstWordPos; ++secondWordPos)
+        {
+            const HammingDistance c_HammingDistance{_getHammingDistance(
+                c_FirstWord, secondWordPos < c_OldWordsCount ? m_DataSet[secondWordPos]
+                                                             : words[secondWordPos - c_OldWordsCount])};
+
+            newAdjacencyMatrix.at(firstWordPos, secondWordPos) = c_HammingDistance;
+            newAdjacencyMatrix.at(secondWordPos, firstWordPos) = c_HammingDistance;
+        }
+
+        newAdjacencyMatrix.at(firstWordPos, firstWordPos) = 0;
+    }
+
+    m_AdjacencyMatrix = std::move(newAdjacencyMatrix);
+}
+
+// the indexes should be sorted and unique, the words are still in the data set (not yet erased)
+void DataOrderingEngine::_eraseFromAdjacencyMatrix(const std::vector<OrderingIndex>& sortedWordIndexes)
+{
+    std::vector<matrix_size_t> remainingWordIndexes;
+    remainingWordIndexes.reserve(m_DataSet.size() - sortedWordIndexes.size());
+
+    for (matrix_size_t wordIndex{0}, erasedWordPos{0}; wordIndex < m_DataSet.size(); ++wordIndex)
+    {
+        if (erasedWordPos < sortedWordIndexes.size() && sortedWordIndexes[erasedWordPos] == wordIndex)
+        {
+            ++erasedWordPos;
+        }
+        else
+        {
+            remainingWordIndexes.push_back(wordIndex);
+        }
+    }
+
+    const matrix_size_t c_WordsCount{static_cast<matrix_size_t>(remainingWordIndexes.size())};
+    AdjacencyMatrix newAdjacencyMatrix;
+    newAdjacencyMatrix.resize(c_WordsCount, c_WordsCount);
+
+    for (matrix_size_t firstWordPos{0}; firstWordPos < c_WordsCount; ++firstWordPos)
+    {
+        for (matrix_size_t secondWordPos{0}; secondWordPos < c_WordsCount; ++secondWordPos)
+        {
+            newAdjacencyMatrix.at(firstWordPos, secondWordPos) =
+                m_AdjacencyMatrix.at(remainingWordIndexes[firstWordPos], remainingWordIndexes[secondWordPos]);
+        }
+    }
+
+    m_AdjacencyMatrix = std::move(newAdjacencyMatrix);
+}
+
+/* Cheapest insertion: the word is inserted at the position (and with the inversion flags) that causes the minimum
+   increase of the total transitions count, the other words keeping their relative order and inversion flags.
+   The segments are independent from each other, so the inversion flag of each segment is chosen separately.
+*/
+void DataOrderingEngine::_insertIntoOrdering(OrderingIndex wordIndex, bool inversionAllowed)
+{
+    const size_t c_OrderedWordsCount{m_OrderingIndexes.size()};
+    const size_t c_SegmentsCount{m_InversionSegmentsCount};
+    size_t bestPosition{0};
+    InversionFlags bestInversionFlags(c_SegmentsCount, false);
+    InversionFlags inversionFlags(c_SegmentsCount, false);
+    size_t minTransitionsIncrease{std::numeric_limits<size_t>::max()};
+
+    for (size_t position{0}; c_OrderedWordsCount > 0 && position <= c_OrderedWordsCount; ++position)
+    {
+        size_t transitionsIncrease{0};
+
+        for (size_t segmentIndex{0}; segmentIndex < c_SegmentsCount; ++segmentIndex)
+        {
+            const size_t c_NextFlagIndex{position * c_SegmentsCount + segmentIndex};
+            size_t minSegmentTransitionsCount{std::numeric_limits<size_t>::max()};
+
+            for (const bool c_IsInverted : {false, true})
+            {
+                if (c_IsInverted && !inversionAllowed)
+                {
+                    break;
+                }
+
+                size_t segmentTransitionsCount{0};
+
+                if (position > 0)
+                {
+                    segmentTransitionsCount +=
+                        _getSegmentTransitionsCount(m_OrderingIndexes[position - 1],
+                                                    m_InversionFlags[c_NextFlagIndex - c_SegmentsCount], wordIndex,
+                                                    c_IsInverted, segmentIndex);
+                }
+
+                if (position < c_OrderedWordsCount)
+                {
+                    segmentTransitionsCount +=
+                        _getSegmentTransitionsCount(wordIndex, c_IsInverted, m_OrderingIndexes[position],
+                                                    m_InversionFlags[c_NextFlagIndex], segmentIndex);
+                }
+
+                if (segmentTransitionsCount < minSegmentTransitionsCount)
+                {
+                    minSegmentTransitionsCount = segmentTransitionsCount;
+                    inversionFlags[segmentIndex] = c_IsInverted;
+                }
+            }
+
+            transitionsIncrease += minSegmentTransitionsCount;
+
+            // the transitions between the new neighbors are replaced
+            if (position > 0 && position < c_OrderedWordsCount)
+            {
+                transitionsIncrease -= _getSegmentTransitionsCount(
+                    m_OrderingIndexes[position - 1], m_InversionFlags[c_NextFlagIndex - c_SegmentsCount],
+                    m_OrderingIndexes[position], m_InversionFlags[c_NextFlagIndex], segmentIndex);
+            }
+        }
+
+        if (transitionsIncrease < minTransitionsIncrease)
+        {
+            minTransitionsIncrease = transitionsIncrease;
+            bestPosition = position;
+            bestInversionFlags = inversionFlags;
+        }
+    }
+
+    m_OrderingIndexes.insert(m_OrderingIndexes.begin() + bestPosition, wordIndex);
+    m_InversionFlags.insert(m_InversionFlags.begin() + bestPosition * c_SegmentsCount, bestInversionFlags.cbegin(),
+                            bestInversionFlags.cend());
+}
+
+// for a single segment (whole word) the distance is taken from the adjacency matrix, otherwise from the packed words
+size_t DataOrderingEngine::_getSegmentTransitionsCount(OrderingIndex firstWordIndex, bool isFirstSegmentInverted,
+                                                       OrderingIndex secondWordIndex, bool isSecondSegmentInverted,
+                                                       size_t segmentIndex) const
+{
+    size_t hammingDistance{0};
+    size_t segmentSize{*m_WordSize};
+
+    if (1 == m_InversionSegmentsCount)
+    {
+        hammingDistance = *m_AdjacencyMatrix.at(firstWordIndex, secondWordIndex);
+    }
+    else
+    {
+        const size_t c_BlocksPerWord{m_PackedDataSet.m_BlocksPerWord};
+        const size_t c_SegmentBegin{Utilities::getSegmentBegin(*m_WordSize, m_InversionSegmentsCount, segmentIndex)};
+        const size_t c_SegmentEnd{Utilities::getSegmentBegin(*m_WordSize, m_InversionSegmentsCount, segmentIndex + 1)};
+
+        hammingDistance = getPackedSegmentHammingDistance(
+            m_PackedDataSet.m_Blocks.data() + firstWordIndex * c_BlocksPerWord,
+            m_PackedDataSet.m_Blocks.data() + secondWordIndex * c_BlocksPerWord, c_SegmentBegin, c_SegmentEnd);
+        segmentSize = c_SegmentEnd - c_SegmentBegin;
+    }
+
+    return isFirstSegmentInverted == isSecondSegmentInverted ? hammingDistance : segmentSize - hammingDistance;
+}
+
+// the modes that invert whole words use a single flag per word (the flags are overwritten by the ordering)
+void DataOrderingEngine::_resetInversionSegments()
+{
+    if (m_InversionSegmentsCount != 1)
+    {
+        m_InversionSegmentsCount = 1;
+        m_InversionFlags.assign(m_OrderingIndexes.size(), false);
+    }
+}
+
 void DataOrderingEngine::_reset()
 {
     m_DataSet.clear();
-    m_OrderedDataSet.clear();
+    m_PackedDataSet = {};
     m_AdjacencyMatrix.clear();
     m_OrderingIndexes.clear();
     m_InversionFlags.clear();
+    m_InversionSegmentsCount = 1;
     m_WordSize.reset();
 }
 
-std::optional<OrderingIndex> DataOrderingEngine::_initGreedyMinSimplified(bool inversionAllowed,
+bool DataOrderingEngine::_performGreedyMinSimplified(const AdjacencyMatrix& adjacencyMatrix, bool inversionAllowed)
+{
+    bool success{false};
+
+    do
+    {
+        if (!m_WordSize.has_value())
+        {
+            break;
+        }
+
+        const size_t c_DataSetSize{m_DataSet.size()};
+
+        if (0 == c_DataSetSize)
+        {
+            break;
+        }
+
+        if (m_OrderingIndexes.size() != c_DataSetSize ||
+            m_InversionFlags.size() != c_DataSetSize * m_InversionSegmentsCount)
+        {
+            assert(false);
+            break;
+        }
+
+        _resetInversionSegments();
+
+        StatusFlags wordAlreadyAddedStatuses;
+        std::optional<OrderingIndex> currentWordIndex{
+            _initGreedyMinSimplified(adjacencyMatrix, inversionAllowed, wordAlreadyAddedStatuses)};
+
+        if (wordAlreadyAddedStatuses.size() != c_DataSetSize)
+        {
+            assert(false);
+            break;
+        }
+
+        // continue with the remaining words, add them at one end of the ordered set (first the distance between second
+        // added word and another one is considered and so on...)
+        size_t addedWordsCount{
+            static_cast<size_t>(std::count(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(), true))};
+
+        if (0 == addedWordsCount)
+        {
+            assert(false);
+            break;
+        }
+
+        for (; addedWordsCount < c_DataSetSize; ++addedWordsCount)
+        {
+            std::optional<OrderingIndex> nextWordIndex;
+            bool isInvertedSuccessor{false};
+
+            if (inversionAllowed)
+            {
+                isInvertedSuccessor = _retrieveNextOrderedWordUsingInversion(adjacencyMatrix, wordAlreadyAddedStatuses,
+                                                                             currentWordIndex, nextWordIndex);
+            }
+            else
+            {
+                _retrieveNextOrderedWord(adjacencyMatrix, wordAlreadyAddedStatuses, currentWordIndex, nextWordIndex);
+            }
+
+            if (!nextWordIndex.has_value() || nextWordIndex >= c_DataSetSize || nextWordIndex == currentWordIndex)
+            {
+                assert(false);
+                break;
+            }
+
+            currentWordIndex = nextWordIndex;
+            m_OrderingIndexes[addedWordsCount] = *currentWordIndex;
+            m_InversionFlags[addedWordsCount] = isInvertedSuccessor != m_InversionFlags.at(addedWordsCount - 1);
+            wordAlreadyAddedStatuses[*currentWordIndex] = true;
+        }
+
+        if (std::any_of(wordAlreadyAddedStatuses.cbegin(), wordAlreadyAddedStatuses.cend(),
+                        [](bool added) { return !added; }))
+        {
+            assert(false);
+            break;
+        }
+
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+std::optional<OrderingIndex> DataOrderingEngine::_initGreedyMinSimplified(const AdjacencyMatrix& adjacencyMatrix,
+                                                                          bool inversionAllowed,
                                                                           StatusFlags& wordAlreadyAddedStatuses)
 {
     std::optional<OrderingIndex> currentWordIndex;
@@ -374,11 +834,11 @@ std::optional<OrderingIndex> DataOrderingEngine::_initGreedyMinSimplified(bool i
 
             if (inversionAllowed)
             {
-                isInversionRequired = _retrieveFirstTwoOrderedWordsUsingInversion(minDistancePair);
+                isInversionRequired = _retrieveFirstTwoOrderedWordsUsingInversion(adjacencyMatrix, minDistancePair);
             }
             else
             {
-                _retrieveFirstTwoOrderedWords(minDistancePair);
+                _retrieveFirstTwoOrderedWords(adjacencyMatrix, minDistancePair);
             }
 
             if (minDistancePair.has_value() && minDistancePair->first != minDistancePair->second &&
@@ -413,7 +873,8 @@ std::optional<OrderingIndex> DataOrderingEngine::_initGreedyMinSimplified(bool i
     return currentWordIndex;
 }
 
-void DataOrderingEngine::_retrieveFirstTwoOrderedWords(std::optional<OrderingIndexesPair>& minDistancePair) const
+void DataOrderingEngine::_retrieveFirstTwoOrderedWords(const AdjacencyMatrix& adjacencyMatrix,
+                                                       std::optional<OrderingIndexesPair>& minDistancePair) const
 {
     do
     {
@@ -429,13 +890,13 @@ void DataOrderingEngine::_retrieveFirstTwoOrderedWords(std::optional<OrderingInd
             break;
         }
 
-        if (m_AdjacencyMatrix.getNrOfRows() != c_DataSetSize || m_AdjacencyMatrix.getNrOfColumns() != c_DataSetSize)
+        if (adjacencyMatrix.getNrOfRows() != c_DataSetSize || adjacencyMatrix.getNrOfColumns() != c_DataSetSize)
         {
             assert(false);
             break;
         }
 
-        HammingDistance currentDistance{_retrieveDistanceBetweenFirstTwoUnorderedWords()};
+        HammingDistance currentDistance{_retrieveDistanceBetweenFirstTwoUnorderedWords(adjacencyMatrix)};
 
         if (!currentDistance.has_value() || m_WordSize < currentDistance)
         {
@@ -449,8 +910,8 @@ void DataOrderingEngine::_retrieveFirstTwoOrderedWords(std::optional<OrderingInd
 
         for (matrix_size_t currentDiagNr{1}; currentDiagNr < c_PositiveDiagonalsCount; ++currentDiagNr)
         {
-            for (AdjacencyMatrix::ConstDIterator it{m_AdjacencyMatrix.constDBegin(currentDiagNr)};
-                 it != m_AdjacencyMatrix.constDEnd(currentDiagNr); ++it)
+            for (AdjacencyMatrix::ConstDIterator it{adjacencyMatrix.constDBegin(currentDiagNr)};
+                 it != adjacencyMatrix.constDEnd(currentDiagNr); ++it)
             {
                 if (!it->has_value() || *it > m_WordSize)
                 {
@@ -476,7 +937,7 @@ void DataOrderingEngine::_retrieveFirstTwoOrderedWords(std::optional<OrderingInd
 }
 
 bool DataOrderingEngine::_retrieveFirstTwoOrderedWordsUsingInversion(
-    std::optional<OrderingIndexesPair>& minDistancePair) const
+    const AdjacencyMatrix& adjacencyMatrix, std::optional<OrderingIndexesPair>& minDistancePair) const
 {
     bool areInverted{false};
 
@@ -494,13 +955,13 @@ bool DataOrderingEngine::_retrieveFirstTwoOrderedWordsUsingInversion(
             break;
         }
 
-        if (m_AdjacencyMatrix.getNrOfRows() != c_DataSetSize || m_AdjacencyMatrix.getNrOfColumns() != c_DataSetSize)
+        if (adjacencyMatrix.getNrOfRows() != c_DataSetSize || adjacencyMatrix.getNrOfColumns() != c_DataSetSize)
         {
             assert(false);
             break;
         }
 
-        HammingDistance currentDistance{_retrieveDistanceBetweenFirstTwoUnorderedWords()};
+        HammingDistance currentDistance{_retrieveDistanceBetweenFirstTwoUnorderedWords(adjacencyMatrix)};
 
         if (!currentDistance.has_value() || m_WordSize < currentDistance)
         {
@@ -522,8 +983,8 @@ bool DataOrderingEngine::_retrieveFirstTwoOrderedWordsUsingInversion(
 
         for (matrix_size_t currentDiagNr{1}; currentDiagNr < c_PositiveDiagonalsCount; ++currentDiagNr)
         {
-            for (AdjacencyMatrix::ConstDIterator it{m_AdjacencyMatrix.constDBegin(currentDiagNr)};
-                 it != m_AdjacencyMatrix.constDEnd(currentDiagNr); ++it)
+            for (AdjacencyMatrix::ConstDIterator it{adjacencyMatrix.constDBegin(currentDiagNr)};
+                 it != adjacencyMatrix.constDEnd(currentDiagNr); ++it)
             {
                 if (!it->has_value() || *it > m_WordSize)
                 {
@@ -563,7 +1024,203 @@ bool DataOrderingEngine::_retrieveFirstTwoOrderedWordsUsingInversion(
     return areInverted;
 }
 
-void DataOrderingEngine::_retrieveNextOrderedWord(const StatusFlags& wordAlreadyAddedStatuses,
+/* Held-Karp algorithm adapted for paths (the last word is not connected back to the first one):
+   - minimum distance of a path that contains exactly the words of a subset (bitmask) and ends with a given word (last
+   word) is stored at index subset * wordsCount + lastWord
+   - each subset is computed from the subsets having one word less, so the subsets are computed in layers (by number of
+   words), each layer being split among threads; the subsets of a layer are enumerated directly (not filtered out of all
+   subsets)
+   - when inversion is allowed the inversion flags can always be chosen so that each transition costs min(distance,
+   wordSize - distance), so the same algorithm is used with these distances and the flags are determined afterwards
+*/
+bool DataOrderingEngine::_performExactMin(bool inversionAllowed, size_t threadsCount)
+{
+    using Distance = uint16_t;
+    static constexpr Distance c_InfiniteDistance{std::numeric_limits<Distance>::max()};
+    static constexpr size_t c_MinSubsetsCountPerThread{1024};
+
+    bool success{false};
+
+    do
+    {
+        const size_t c_WordsCount{m_DataSet.size()};
+
+        if (!m_WordSize.has_value() || 0 == c_WordsCount || c_WordsCount > c_MaxExactOrderingWordsCount)
+        {
+            break;
+        }
+
+        // any path distance should fit into the distance type (maximum value reserved as "infinite" distance)
+        if (*m_WordSize * (c_WordsCount - 1) >= c_InfiniteDistance)
+        {
+            break;
+        }
+
+        if (m_AdjacencyMatrix.getNrOfRows() != c_WordsCount || m_AdjacencyMatrix.getNrOfColumns() != c_WordsCount ||
+            m_OrderingIndexes.size() != c_WordsCount ||
+            m_InversionFlags.size() != c_WordsCount * m_InversionSegmentsCount)
+        {
+            assert(false);
+            break;
+        }
+
+        std::vector<Distance> distances(c_WordsCount * c_WordsCount);
+        bool areDistancesValid{true};
+
+        for (matrix_size_t firstWordIndex{0}; firstWordIndex < c_WordsCount; ++firstWordIndex)
+        {
+            for (matrix_size_t secondWordIndex{0}; secondWordIndex < c_WordsCount; ++secondWordIndex)
+            {
+                const HammingDistance& c_HammingDistance{m_AdjacencyMatrix.at(firstWordIndex, secondWordIndex)};
+
+                if (!c_HammingDistance.has_value() || c_HammingDistance > m_WordSize)
+                {
+                    areDistancesValid = false;
+                    break;
+                }
+
+                distances[firstWordIndex * c_WordsCount + secondWordIndex] = static_cast<Distance>(
+                    inversionAllowed ? std::min(*c_HammingDistance, *m_WordSize - *c_HammingDistance)
+                                     : *c_HammingDistance);
+            }
+        }
+
+        if (!areDistancesValid)
+        {
+            assert(false);
+            break;
+        }
+
+        const size_t c_SubsetsCount{size_t{1} << c_WordsCount};
+        std::vector<Distance> minPathDistances(c_SubsetsCount * c_WordsCount, c_InfiniteDistance);
+
+        for (size_t wordIndex{0}; wordIndex < c_WordsCount; ++wordIndex)
+        {
+            minPathDistances[(size_t{1} << wordIndex) * c_WordsCount + wordIndex] = 0;
+        }
+
+        auto computeSubsets{[&distances, &minPathDistances, c_WordsCount](const size_t* pFirstSubset,
+                                                                           const size_t* pLastSubset) {
+            for (const size_t* pSubset{pFirstSubset}; pSubset < pLastSubset; ++pSubset)
+            {
+                const size_t c_Subset{*pSubset};
+
+                for (size_t remainingWords{c_Subset}; remainingWords != 0; remainingWords &= remainingWords - 1)
+                {
+                    const size_t c_LastWordIndex{static_cast<size_t>(std::countr_zero(remainingWords))};
+                    const size_t c_PreviousSubset{c_Subset & ~(size_t{1} << c_LastWordIndex)};
+                    Distance minPathDistance{c_InfiniteDistance};
+
+                    for (size_t previousWords{c_PreviousSubset}; previousWords != 0; previousWords &= previousWords - 1)
+                    {
+                        const size_t c_PreviousWordIndex{static_cast<size_t>(std::countr_zero(previousWords))};
+                        const Distance c_PathDistance{static_cast<Distance>(
+                            minPathDistances[c_PreviousSubset * c_WordsCount + c_PreviousWordIndex] +
+                            distances[c_PreviousWordIndex * c_WordsCount + c_LastWordIndex])};
+
+                        minPathDistance = std::min(minPathDistance, c_PathDistance);
+                    }
+
+                    minPathDistances[c_Subset * c_WordsCount + c_LastWordIndex] = minPathDistance;
+                }
+            }
+        }};
+
+        std::vector<size_t> layerSubsets;
+
+        for (size_t wordsPerSubsetCount{2}; wordsPerSubsetCount <= c_WordsCount; ++wordsPerSubsetCount)
+        {
+            layerSubsets.clear();
+
+            // Gosper's hack: only the subsets having the required number of words are visited (in increasing order)
+            for (size_t subset{(size_t{1} << wordsPerSubsetCount) - 1}; subset < c_SubsetsCount;)
+            {
+                layerSubsets.push_back(subset);
+
+                const size_t c_LowestWord{subset & (~subset + 1)};
+                const size_t c_Ripple{subset + c_LowestWord};
+
+                subset = (((c_Ripple ^ subset) >> 2) / c_LowestWord) | c_Ripple;
+            }
+
+            const size_t c_LayerSubsetsCount{layerSubsets.size()};
+            const size_t c_ThreadsCount{std::clamp<size_t>(
+                std::min(threadsCount, c_LayerSubsetsCount / c_MinSubsetsCountPerThread), 1, c_LayerSubsetsCount)};
+            const size_t* const c_pLayerSubsets{layerSubsets.data()};
+
+            std::vector<std::thread> threads;
+            threads.reserve(c_ThreadsCount - 1);
+
+            for (size_t threadIndex{1}; threadIndex < c_ThreadsCount; ++threadIndex)
+            {
+                threads.emplace_back(computeSubsets,
+                                     c_pLayerSubsets + c_LayerSubsetsCount * threadIndex / c_ThreadsCount,
+                                     c_pLayerSubsets + c_LayerSubsetsCount * (threadIndex + 1) / c_ThreadsCount);
+            }
+
+            computeSubsets(c_pLayerSubsets, c_pLayerSubsets + c_LayerSubsetsCount / c_ThreadsCount);
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        // rebuild the optimal path backwards, starting with the last word of the minimum distance full path
+        size_t subset{c_SubsetsCount - 1};
+        const auto c_FullPathDistancesIt{minPathDistances.cbegin() + subset * c_WordsCount};
+        size_t lastWordIndex{static_cast<size_t>(
+            std::min_element(c_FullPathDistancesIt, c_FullPathDistancesIt + c_WordsCount) - c_FullPathDistancesIt)};
+
+        for (size_t orderingPosition{c_WordsCount - 1}; orderingPosition > 0; --orderingPosition)
+        {
+            m_OrderingIndexes[orderingPosition] = static_cast<OrderingIndex>(lastWordIndex);
+
+            const size_t c_PreviousSubset{subset & ~(size_t{1} << lastWordIndex)};
+            const Distance c_PathDistance{minPathDistances[subset * c_WordsCount + lastWordIndex]};
+
+            for (size_t previousWords{c_PreviousSubset}; previousWords != 0; previousWords &= previousWords - 1)
+            {
+                const size_t c_PreviousWordIndex{static_cast<size_t>(std::countr_zero(previousWords))};
+
+                if (minPathDistances[c_PreviousSubset * c_WordsCount + c_PreviousWordIndex] +
+                        distances[c_PreviousWordIndex * c_WordsCount + lastWordIndex] ==
+                    c_PathDistance)
+                {
+                    lastWordIndex = c_PreviousWordIndex;
+                    break;
+                }
+            }
+
+            subset = c_PreviousSubset;
+        }
+
+        _resetInversionSegments();
+
+        m_OrderingIndexes[0] = static_cast<OrderingIndex>(lastWordIndex);
+        m_InversionFlags[0] = false;
+
+        // a word is inverted relative to its predecessor if the distance to the inverted word is smaller
+        for (size_t orderingPosition{1}; orderingPosition < c_WordsCount; ++orderingPosition)
+        {
+            const size_t c_HammingDistance{
+                *m_AdjacencyMatrix.at(m_OrderingIndexes[orderingPosition - 1], m_OrderingIndexes[orderingPosition])};
+            const bool c_IsInvertedSuccessor{inversionAllowed && *m_WordSize - c_HammingDistance < c_HammingDistance};
+
+            const bool c_IsPredecessorInverted{m_InversionFlags[orderingPosition - 1]};
+
+            m_InversionFlags[orderingPosition] =
+                c_IsInvertedSuccessor ? !c_IsPredecessorInverted : c_IsPredecessorInverted;
+        }
+
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+void DataOrderingEngine::_retrieveNextOrderedWord(const AdjacencyMatrix& adjacencyMatrix,
+                                                  const StatusFlags& wordAlreadyAddedStatuses,
                                                   const std::optional<OrderingIndex>& currentWordIndex,
                                                   std::optional<OrderingIndex>& nextWordIndex) const
 {
@@ -571,8 +1228,8 @@ void DataOrderingEngine::_retrieveNextOrderedWord(const StatusFlags& wordAlready
     {
         const size_t c_DataSetSize{m_DataSet.size()};
 
-        if (!m_WordSize.has_value() || m_AdjacencyMatrix.getNrOfRows() != c_DataSetSize ||
-            m_AdjacencyMatrix.getNrOfColumns() != c_DataSetSize || wordAlreadyAddedStatuses.size() != c_DataSetSize ||
+        if (!m_WordSize.has_value() || adjacencyMatrix.getNrOfRows() != c_DataSetSize ||
+            adjacencyMatrix.getNrOfColumns() != c_DataSetSize || wordAlreadyAddedStatuses.size() != c_DataSetSize ||
             !currentWordIndex.has_value() || currentWordIndex >= c_DataSetSize)
         {
             assert(false);
@@ -587,11 +1244,11 @@ void DataOrderingEngine::_retrieveNextOrderedWord(const StatusFlags& wordAlready
         HammingDistance minHammingDistance{*m_WordSize + 1};
 
         AdjacencyMatrix::ConstZIterator currentWordIt{
-            m_AdjacencyMatrix.getConstZIterator(*nextWordIndex, *nextWordIndex)};
+            adjacencyMatrix.getConstZIterator(*nextWordIndex, *nextWordIndex)};
         const std::optional<matrix_size_t> c_CurrentWordItRowNr{currentWordIt.getRowNr()};
 
-        for (AdjacencyMatrix::ConstZIterator it{m_AdjacencyMatrix.constZRowBegin(*c_CurrentWordItRowNr)};
-             it != m_AdjacencyMatrix.constZRowEnd(*c_CurrentWordItRowNr); ++it)
+        for (AdjacencyMatrix::ConstZIterator it{adjacencyMatrix.constZRowBegin(*c_CurrentWordItRowNr)};
+             it != adjacencyMatrix.constZRowEnd(*c_CurrentWordItRowNr); ++it)
         {
             if (!it->has_value() || *it > m_WordSize)
             {
@@ -612,7 +1269,8 @@ void DataOrderingEngine::_retrieveNextOrderedWord(const StatusFlags& wordAlready
     } while (false);
 }
 
-bool DataOrderingEngine::_retrieveNextOrderedWordUsingInversion(const StatusFlags& wordAlreadyAddedStatuses,
+bool DataOrderingEngine::_retrieveNextOrderedWordUsingInversion(const AdjacencyMatrix& adjacencyMatrix,
+                                                                const StatusFlags& wordAlreadyAddedStatuses,
                                                                 const std::optional<OrderingIndex>& currentWordIndex,
                                                                 std::optional<OrderingIndex>& nextWordIndex) const
 {
@@ -622,8 +1280,8 @@ bool DataOrderingEngine::_retrieveNextOrderedWordUsingInversion(const StatusFlag
     {
         const size_t c_DataSetSize{m_DataSet.size()};
 
-        if (!m_WordSize.has_value() || m_AdjacencyMatrix.getNrOfRows() != c_DataSetSize ||
-            m_AdjacencyMatrix.getNrOfColumns() != c_DataSetSize || wordAlreadyAddedStatuses.size() != c_DataSetSize ||
+        if (!m_WordSize.has_value() || adjacencyMatrix.getNrOfRows() != c_DataSetSize ||
+            adjacencyMatrix.getNrOfColumns() != c_DataSetSize || wordAlreadyAddedStatuses.size() != c_DataSetSize ||
             !currentWordIndex.has_value() || currentWordIndex >= c_DataSetSize)
         {
             assert(false);
@@ -638,13 +1296,13 @@ bool DataOrderingEngine::_retrieveNextOrderedWordUsingInversion(const StatusFlag
         HammingDistance minHammingDistance{*m_WordSize + 1};
 
         AdjacencyMatrix::ConstZIterator currentWordIt{
-            m_AdjacencyMatrix.getConstZIterator(*nextWordIndex, *nextWordIndex)};
+            adjacencyMatrix.getConstZIterator(*nextWordIndex, *nextWordIndex)};
         const std::optional<matrix_size_t> c_CurrentWordItRowNr{currentWordIt.getRowNr()};
 
         // no need to check optional validity for it.getColumnNr() before getting its value (*) because the matrix is
         // presumed non-empty (see above check) and the iterator is not reverse
-        for (AdjacencyMatrix::ConstZIterator it{m_AdjacencyMatrix.constZRowBegin(*c_CurrentWordItRowNr)};
-             it != m_AdjacencyMatrix.constZRowEnd(*c_CurrentWordItRowNr); ++it)
+        for (AdjacencyMatrix::ConstZIterator it{adjacencyMatrix.constZRowBegin(*c_CurrentWordItRowNr)};
+             it != adjacencyMatrix.constZRowEnd(*c_CurrentWordItRowNr); ++it)
         {
             if (!it->has_value() || *it > m_WordSize)
             {
@@ -680,7 +1338,8 @@ bool DataOrderingEngine::_retrieveNextOrderedWordUsingInversion(const StatusFlag
     return isInvertedSuccessor;
 }
 
-HammingDistance DataOrderingEngine::_retrieveDistanceBetweenFirstTwoUnorderedWords() const
+HammingDistance DataOrderingEngine::_retrieveDistanceBetweenFirstTwoUnorderedWords(
+    const AdjacencyMatrix& adjacencyMatrix) const
 {
     HammingDistance startingDistance;
 
@@ -688,10 +1347,10 @@ HammingDistance DataOrderingEngine::_retrieveDistanceBetweenFirstTwoUnorderedWor
     const matrix_size_t currentSecondWordIndex{1};
     const size_t c_DataSetSize{m_DataSet.size()};
 
-    if (c_DataSetSize > 1 && m_AdjacencyMatrix.getNrOfRows() == c_DataSetSize &&
-        m_AdjacencyMatrix.getNrOfColumns() == c_DataSetSize)
+    if (c_DataSetSize > 1 && adjacencyMatrix.getNrOfRows() == c_DataSetSize &&
+        adjacencyMatrix.getNrOfColumns() == c_DataSetSize)
     {
-        startingDistance = m_AdjacencyMatrix.at(currentFirstWordIndex, currentSecondWordIndex);
+        startingDistance = adjacencyMatrix.at(currentFirstWordIndex, currentSecondWordIndex);
         assert(startingDistance.has_value());
     }
     else
@@ -701,34 +1360,3 @@ HammingDistance DataOrderingEngine::_retrieveDistanceBetweenFirstTwoUnorderedWor
 
     return startingDistance;
 }
-
-void DataOrderingEngine::_updateOrderedDataSet()
-{
-    const size_t c_DataSetSize{m_DataSet.size()};
-
-    if (c_DataSetSize == m_OrderingIndexes.size() && c_DataSetSize == m_InversionFlags.size())
-    {
-        m_OrderedDataSet.clear();
-        m_OrderedDataSet.reserve(c_DataSetSize);
-
-        for (size_t currentWordIndex{0}; currentWordIndex < c_DataSetSize; ++currentWordIndex)
-        {
-            const bool& c_ShouldInvert{m_InversionFlags.at(currentWordIndex)};
-            const OrderingIndex& c_OrderingIndex{m_OrderingIndexes.at(currentWordIndex)};
-
-            if (c_OrderingIndex >= c_DataSetSize)
-            {
-                assert(false);
-                break;
-            }
-
-            const DataWord& c_DataWord{m_DataSet.at(c_OrderingIndex)};
-
-            m_OrderedDataSet.push_back(c_ShouldInvert ? Utilities::invertDataWord(c_DataWord) : c_DataWord);
-        }
-    }
-    else
-    {
-        assert(false);
-    }
-}
@@ -1,14 +1,13 @@
 #pragma once
 
+#include <thread>
 #include <utility>
 
 #include "datautils.h"
 #include "matrix.h"
+#include "ordereddatasetview.h"
 
 using HammingDistance = std::optional<size_t>;
-using OrderingIndex = matrix_size_t;
-using OrderingIndexes = std::vector<OrderingIndex>;
-using InversionFlags = DataWord;
 using StatusFlags = DataWord;
 
 class DataOrderingEngine
@@ -25,13 +24,52 @@ public:
     void performGreedyMinSimplified();
     void performGreedyMinSimplifiedUsingInversion();
 
+    /* Greedy ordering where each word is split into segments that are inverted separately (partial bus-invert):
+       - the distance between two words is the sum of the per segment distances min(d, w - d) (d: Hamming distance of
+       the segment, w: segment size), computed by popcount on the packed words
+       - the inversion flags of each segment are then chosen relative to the same segment of the predecessor
+       - the words are selected in the same way as for whole words, so a single segment results in the same ordering as
+       performGreedyMinSimplifiedUsingInversion()
+       - returns false (current ordering kept) if the segments count is 0 or exceeds the word size
+    */
+    bool performGreedyMinSimplifiedUsingSegmentedInversion(size_t segmentsCount);
+
+    /* Exact ordering (minimum total transitions count), computed by dynamic programming over the subsets of words:
+       - only for small data sets (see c_MaxExactOrderingWordsCount), as both the execution time and the required memory
+       grow exponentially with the number of words (about 40MB for 20 words, 2MB for 16 words)
+       - the subsets having the same number of words are independent from each other so they are split among threads
+       - returns false if the ordering could not be performed (data set too large, words too long), in which case the
+       current ordering is kept
+    */
+    bool performExactMin(size_t threadsCount = std::thread::hardware_concurrency());
+    bool performExactMinUsingInversion(size_t threadsCount = std::thread::hardware_concurrency());
+
     void setDataSet(const DataSet& dataSet);
+    void setDataSet(DataSet&& dataSet);
+
+    /* Incremental updates of the data set (e.g. when words arrive and expire continuously):
+       - only the adjacency matrix rows/columns of the added/removed words are updated (no full rebuild)
+       - each added word is appended to the data set and inserted into the current ordering where the total transitions
+       count increases the least (cheapest insertion), possibly inverted (if inversion allowed)
+       - the removed words are taken out of the current ordering (their neighbors become adjacent), the remaining words
+       keep their relative order within the data set (so their indexes might decrease)
+       - return false (no change) if the added words don't have the required size, the indexes to remove are invalid or
+       the current data set is invalid (words of different sizes)
+    */
+    bool addWords(const DataSet& words, bool inversionAllowed = false);
+    bool removeWords(std::vector<OrderingIndex> wordIndexes);
 
-    const DataSet& getOrderedDataSet() const;
+    // the view applies the current ordering on access (no copy), while getOrderedDataSet() creates an ordered copy
+    OrderedDataSetView getOrderedDataSetView() const;
+    DataSet getOrderedDataSet() const;
     const OrderingIndexes& getOrderingIndexes() const;
+    // consecutive flags for each ordered word, one per segment (single flag per word unless segmented inversion used)
     const InversionFlags& getInversionFlags() const;
+    size_t getInversionSegmentsCount() const;
     HammingDistance getTotalTransitionsCount() const;
 
+    static constexpr size_t c_MaxExactOrderingWordsCount{20};
+
 private:
     using AdjacencyMatrix = Matrix<HammingDistance>;
 
@@ -43,25 +81,40 @@ private:
     void _init();
     void _computeWordSize();
     void _buildAdjacencyMatrix();
+    void _appendToAdjacencyMatrix(const DataSet& words);
+    void _eraseFromAdjacencyMatrix(const std::vector<OrderingIndex>& sortedWordIndexes);
+    void _insertIntoOrdering(OrderingIndex wordIndex, bool inversionAllowed);
+    size_t _getSegmentTransitionsCount(OrderingIndex firstWordIndex, bool isFirstSegmentInverted,
+                                       OrderingIndex secondWordIndex, bool isSecondSegmentInverted,
+                                       size_t segmentIndex) const;
+    void _resetInversionSegments();
     void _reset();
 
-    std::optional<OrderingIndex> _initGreedyMinSimplified(bool inversionAllowed, StatusFlags& wordAlreadyAddedStatuses);
-    void _retrieveFirstTwoOrderedWords(std::optional<OrderingIndexesPair>& minDistancePair) const;
-    bool _retrieveFirstTwoOrderedWordsUsingInversion(std::optional<OrderingIndexesPair>& minDistancePair) const;
-    void _retrieveNextOrderedWord(const StatusFlags& wordAlreadyAddedStatuses,
+    /* The greedy selection functions get the adjacency matrix as argument, so they can be applied either on the
+       Hamming distances (m_AdjacencyMatrix) or on other distances between the data words (e.g. segmented inversion)
+    */
+    bool _performGreedyMinSimplified(const AdjacencyMatrix& adjacencyMatrix, bool inversionAllowed);
+    std::optional<OrderingIndex> _initGreedyMinSimplified(const AdjacencyMatrix& adjacencyMatrix, bool inversionAllowed,
+                                                          StatusFlags& wordAlreadyAddedStatuses);
+    void _retrieveFirstTwoOrderedWords(const AdjacencyMatrix& adjacencyMatrix,
+                                       std::optional<OrderingIndexesPair>& minDistancePair) const;
+    bool _retrieveFirstTwoOrderedWordsUsingInversion(const AdjacencyMatrix& adjacencyMatrix,
+                                                     std::optional<OrderingIndexesPair>& minDistancePair) const;
+    bool _performExactMin(bool inversionAllowed, size_t threadsCount);
+    void _retrieveNextOrderedWord(const AdjacencyMatrix& adjacencyMatrix, const StatusFlags& wordAlreadyAddedStatuses,
                                   const std::optional<OrderingIndex>& currentWordIndex,
                                   std::optional<OrderingIndex>& nextWordIndex) const;
-    bool _retrieveNextOrderedWordUsingInversion(const StatusFlags& wordAlreadyAddedStatuses,
+    bool _retrieveNextOrderedWordUsingInversion(const AdjacencyMatrix& adjacencyMatrix,
+                                                const StatusFlags& wordAlreadyAddedStatuses,
                                                 const std::optional<OrderingIndex>& currentWordIndex,
                                                 std::optional<OrderingIndex>& nextWordIndex) const;
-    HammingDistance _retrieveDistanceBetweenFirstTwoUnorderedWords() const;
-    void _updateOrderedDataSet();
-
+    HammingDistance _retrieveDistanceBetweenFirstTwoUnorderedWords(const AdjacencyMatrix& adjacencyMatrix) const;
     DataSet m_DataSet;
-    DataSet m_OrderedDataSet;
+    PackedDataSet m_PackedDataSet; // same words as m_DataSet, kept in sync for computing the segment distances
     AdjacencyMatrix m_AdjacencyMatrix;
     OrderingIndexes m_OrderingIndexes; // original index of each word (permutation occurs by indexes, original dataset
                                        // is not modified)
     InversionFlags m_InversionFlags; // each word has a flag mentioning if inverted or not (flags are also "permutated")
+    size_t m_InversionSegmentsCount{1}; // number of flags per word (segments inverted separately)
     HammingDistance m_WordSize;
 };
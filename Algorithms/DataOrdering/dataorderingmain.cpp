@@ -12,18 +12,23 @@
    Two algorithms will be used:
    - Greedy Min Simplified (GMS): ordering only, no inversion
    - Greedy Min Simplified with inversion: words are ordered and possibly inverted
+
+   For small data sets the exact (optimal) ordering is also computed (with and without inversion), so the results of
+   the greedy algorithm can be compared against it.
 */
 
 #include <cassert>
 #include <iostream>
 
-#include "dataordering_io.h"
-#include "dataorderingengine.h"
+#include "dataorderingpipeline.h"
+#include "instrumentation.h"
 #include "utils.h"
 
 /* Input file contains one or more data sections (separated by an empty row). Each section consists of:
    - header row: number of words and word length (in bits)
    - payload rows: the actual words expressed in binary (one word per row, e.g. 10010100)
+
+   The sections are ordered in parallel (see DataOrderingPipeline) and written to the output file in input order.
 */
 
 static const std::string c_InFile{Utilities::c_InputOutputDir + "dataorderinginput.txt"};
@@ -34,71 +39,16 @@ void displayResult(ResultType resultType, size_t orderedDataSetsCount, const std
 
 int main()
 {
-    DataOrderingFileReader fileReader{c_InFile};
-    DataOrderingFileWriter fileWriter{c_OutFile};
+    DataOrderingPipeline pipeline{c_InFile, c_OutFile};
 
     Utilities::clearScreen();
-    std::cout << "Reading dataset from input file:\n" << fileReader.getInputFilePath() << "\n\n";
-
-    Result result{ResultType::SUCCESS, std::nullopt};
-    std::vector<DataSet> dataSetsToOrder;
-
-    while (result.first == ResultType::SUCCESS)
-    {
-        result = fileReader.readDataSetFromFile();
-
-        if (result.first != ResultType::SUCCESS)
-        {
-            break;
-        }
-
-        if (!result.second.has_value())
-        {
-            assert(false);
-            break;
-        }
-
-        std::cout << "Input is valid: " << result.second->size() << " " << result.second->at(0).size()
-                  << "-bit words\n";
-        dataSetsToOrder.push_back(*result.second);
-    }
-
-    DataOrderingEngine engine;
-
-    for (const auto& dataSet : dataSetsToOrder)
-    {
-        fileWriter.beginSection();
-
-        engine.setDataSet(dataSet);
-        result = fileWriter.writeScenarioOutputToFile("A. Initial order", engine);
-
-        if (result.first != ResultType::SUCCESS)
-        {
-            break;
-        }
-
-        engine.performGreedyMinSimplified();
-        result = fileWriter.writeScenarioOutputToFile(
-            "\n\nB. Scenario 1: Greedy min simplified (GMS) without inversion", engine);
+    std::cout << "Reading dataset from input file:\n" << pipeline.getInputFilePath() << "\n\n";
 
-        if (result.first != ResultType::SUCCESS)
-        {
-            break;
-        }
-
-        engine.performGreedyMinSimplifiedUsingInversion();
-        result = fileWriter.writeScenarioOutputToFile("\n\nC. Scenario 2: Greedy min simplified (GMS) with inversion",
-                                                      engine);
-
-        if (result.first != ResultType::SUCCESS)
-        {
-            break;
-        }
-
-        fileWriter.endSection();
-    }
+    const ResultType c_ResultType{pipeline.run()};
 
-    displayResult(result.first, dataSetsToOrder.size(), fileReader.getInputFilePath(), fileWriter.getOutputFilePath());
+    displayResult(c_ResultType, pipeline.getOrderedDataSetsCount(), pipeline.getInputFilePath(),
+                  pipeline.getOutputFilePath());
+    INSTRUMENT_DUMP(Utilities::c_InputOutputDir + "dataordering");
 
     return 0;
 }
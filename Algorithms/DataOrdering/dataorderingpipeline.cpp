@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "dataorderingpipeline.h"
+#include "instrumentation.h"
+
+// maximum number of data sets that can be read ahead of the writer (per engine)
+static constexpr size_t c_MaxPendingDataSetsPerEngine{4};
+static constexpr size_t c_InversionSegmentsCount{2};
+
+// the exact ordering is performed by each engine in parallel with the others, so it is limited to sections small
+// enough to keep its memory footprint (about 2MB) and execution time negligible
+static constexpr size_t c_MaxExactOrderingWordsCount{16};
+static_assert(c_MaxExactOrderingWordsCount <= DataOrderingEngine::c_MaxExactOrderingWordsCount);
+
+DataOrderingPipeline::DataOrderingPipeline(const std::string& inputFilePath, const std::string& outputFilePath,
+                                           size_t enginesCount)
+    : m_FileReader{inputFilePath}
+    , m_FileWriter{outputFilePath}
+    , m_EnginesCount{std::max<size_t>(enginesCount, 1)}
+    , m_ReadDataSetsCount{0}
+    , m_WrittenDataSetsCount{0}
+    , m_ReadingResult{ResultType::SUCCESS}
+    , m_IsReadingFinished{false}
+    , m_ShouldStop{false}
+{
+}
+
+ResultType DataOrderingPipeline::run()
+{
+    m_ReorderBuffer.clear();
+    m_ReadDataSetsCount = 0;
+    m_WrittenDataSetsCount = 0;
+    m_ReadingResult = ResultType::SUCCESS;
+    m_IsReadingFinished = false;
+    m_ShouldStop = false;
+
+    ResultType writingResult{ResultType::SUCCESS};
+    std::thread readerThread{&DataOrderingPipeline::_readDataSets, this};
+    std::vector<std::thread> engineThreads;
+    engineThreads.reserve(m_EnginesCount);
+
+    for (size_t threadNumber{0}; threadNumber < m_EnginesCount; ++threadNumber)
+    {
+        engineThreads.emplace_back(&DataOrderingPipeline::_orderDataSets, this);
+    }
+
+    for (;;)
+    {
+        std::string sectionOutput;
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ConditionVariable.wait(lock, [this]() {
+                return m_ReorderBuffer.contains(m_WrittenDataSetsCount) ||
+                       (m_IsReadingFinished && m_WrittenDataSetsCount == m_ReadDataSetsCount);
+            });
+
+            auto sectionOutputIt{m_ReorderBuffer.find(m_WrittenDataSetsCount)};
+
+            if (sectionOutputIt == m_ReorderBuffer.end())
+            {
+                break;
+            }
+
+            sectionOutput = std::move(sectionOutputIt->second);
+            m_ReorderBuffer.erase(sectionOutputIt);
+        }
+
+        writingResult = m_FileWriter.writeSectionToFile(sectionOutput).first;
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+
+            if (writingResult == ResultType::SUCCESS)
+            {
+                ++m_WrittenDataSetsCount;
+            }
+            else
+            {
+                m_ShouldStop = true;
+            }
+        }
+
+        // allow the reader to read new data sets (or stop all threads in case of error)
+        m_ConditionVariable.notify_all();
+
+        if (writingResult != ResultType::SUCCESS)
+        {
+            break;
+        }
+    }
+
+    readerThread.join();
+
+    for (auto& thread : engineThreads)
+    {
+        thread.join();
+    }
+
+    return writingResult != ResultType::SUCCESS ? writingResult : m_ReadingResult;
+}
+
+size_t DataOrderingPipeline::getOrderedDataSetsCount() const
+{
+    return m_WrittenDataSetsCount;
+}
+
+const std::string& DataOrderingPipeline::getInputFilePath() const
+{
+    return m_FileReader.getInputFilePath();
+}
+
+const std::string& DataOrderingPipeline::getOutputFilePath() const
+{
+    return m_FileWriter.getOutputFilePath();
+}
+
+void DataOrderingPipeline::_readDataSets()
+{
+    const size_t c_MaxPendingDataSetsCount{c_MaxPendingDataSetsPerEngine * m_EnginesCount};
+    ResultType readingResult{ResultType::SUCCESS};
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ConditionVariable.wait(lock, [this, c_MaxPendingDataSetsCount]() {
+                return m_ShouldStop || m_ReadDataSetsCount < m_WrittenDataSetsCount + c_MaxPendingDataSetsCount;
+            });
+
+            if (m_ShouldStop)
+            {
+                break;
+            }
+        }
+
+        Result result{m_FileReader.readDataSetFromFile()};
+        readingResult = result.first;
+
+        if (result.first != ResultType::SUCCESS)
+        {
+            break;
+        }
+
+        if (!result.second.has_value())
+        {
+            assert(false);
+            break;
+        }
+
+        std::cout << "Input is valid: " << result.second->size() << " " << result.second->at(0).size()
+                  << "-bit words\n";
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_DataSetsQueue.emplace(m_ReadDataSetsCount, std::move(*result.second));
+            ++m_ReadDataSetsCount;
+        }
+
+        m_ConditionVariable.notify_all();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock{m_Mutex};
+        m_ReadingResult = readingResult;
+        m_IsReadingFinished = true;
+    }
+
+    m_ConditionVariable.notify_all();
+}
+
+void DataOrderingPipeline::_orderDataSets()
+{
+    DataOrderingEngine engine;
+
+    for (;;)
+    {
+        std::pair<size_t, DataSet> indexedDataSet;
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ConditionVariable.wait(
+                lock, [this]() { return m_ShouldStop || m_IsReadingFinished || !m_DataSetsQueue.empty(); });
+
+            if (m_ShouldStop || m_DataSetsQueue.empty())
+            {
+                break;
+            }
+
+            indexedDataSet = std::move(m_DataSetsQueue.front());
+            m_DataSetsQueue.pop();
+        }
+
+        std::string sectionOutput{_orderDataSet(engine, std::move(indexedDataSet.second))};
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ReorderBuffer.emplace(indexedDataSet.first, std::move(sectionOutput));
+        }
+
+        m_ConditionVariable.notify_all();
+    }
+}
+
+std::string DataOrderingPipeline::_orderDataSet(DataOrderingEngine& engine, DataSet&& dataSet)
+{
+    INSTRUMENT_SCOPE("DataOrderingPipeline::orderDataSet");
+
+    std::ostringstream out;
+
+    const bool c_IsExactOrderingPerformed{dataSet.size() <= c_MaxExactOrderingWordsCount};
+
+    engine.setDataSet(std::move(dataSet));
+    DataOrderingFileWriter::writeScenarioOutput(out, "A. Initial order", engine);
+
+    engine.performGreedyMinSimplified();
+    DataOrderingFileWriter::writeScenarioOutput(
+        out, "\n\nB. Scenario 1: Greedy min simplified (GMS) without inversion", engine);
+
+    engine.performGreedyMinSimplifiedUsingInversion();
+    DataOrderingFileWriter::writeScenarioOutput(out, "\n\nC. Scenario 2: Greedy min simplified (GMS) with inversion",
+                                                engine);
+
+    // performed only if the data set is small enough; a single thread is used for each data set as the engines are
+    // already running in parallel
+    if (c_IsExactOrderingPerformed && engine.performExactMin(1))
+    {
+        DataOrderingFileWriter::writeScenarioOutput(out, "\n\nD. Scenario 3: Exact min without inversion", engine);
+    }
+
+    if (c_IsExactOrderingPerformed && engine.performExactMinUsingInversion(1))
+    {
+        DataOrderingFileWriter::writeScenarioOutput(out, "\n\nE. Scenario 4: Exact min with inversion", engine);
+    }
+
+    // performed only if the words are large enough to be split into segments
+    if (engine.performGreedyMinSimplifiedUsingSegmentedInversion(c_InversionSegmentsCount))
+    {
+        DataOrderingFileWriter::writeScenarioOutput(out,
+                                                    "\n\nF. Scenario 5: Greedy min simplified (GMS) with inversion of " +
+                                                        std::to_string(c_InversionSegmentsCount) + " word segments",
+                                                    engine);
+    }
+
+    return out.str();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "dataordering_io.h"
+
+/* Orders the data sets (sections) of an input file in parallel and writes the results into the output file:
+   - the data sets are read one by one by a reader thread and ordered by a pool of threads (each one using its own
+   engine)
+   - the results are collected into a reorder buffer and written into the output file in the input order of the data
+   sets (on the calling thread), as soon as all results of the preceding data sets have been written
+   - the reader cannot get too far ahead of the writer (the number of data sets in progress is limited), so only a few
+   data sets per thread are kept in memory no matter how many sections the input file contains
+*/
+class DataOrderingPipeline
+{
+public:
+    DataOrderingPipeline(const std::string& inputFilePath, const std::string& outputFilePath,
+                         size_t enginesCount = std::thread::hardware_concurrency());
+
+    // returns the writing error (if any), otherwise the result of the last read (INVALID_INPUT at end of input); the
+    // input file is read only once, so subsequent calls don't order any data sets
+    ResultType run();
+
+    size_t getOrderedDataSetsCount() const;
+    const std::string& getInputFilePath() const;
+    const std::string& getOutputFilePath() const;
+
+private:
+    void _readDataSets();
+    void _orderDataSets();
+
+    static std::string _orderDataSet(DataOrderingEngine& engine, DataSet&& dataSet);
+
+    DataOrderingFileReader m_FileReader;
+    DataOrderingFileWriter m_FileWriter;
+    size_t m_EnginesCount;
+    std::queue<std::pair<size_t, DataSet>> m_DataSetsQueue;
+    std::map<size_t, std::string> m_ReorderBuffer;
+    std::mutex m_Mutex;
+    std::condition_variable m_ConditionVariable;
+    size_t m_ReadDataSetsCount;
+    size_t m_WrittenDataSetsCount;
+    ResultType m_ReadingResult;
+    bool m_IsReadingFinished;
+    bool m_ShouldStop;
+};
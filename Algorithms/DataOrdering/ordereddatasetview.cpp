@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+#include "ordereddatasetview.h"
+
+OrderedDataSetView::Word::Word(const DataWord& word, const InversionFlags& inversionFlags,
+                               size_t firstInversionFlagIndex, size_t segmentsCount)
+    : m_pWord{&word}
+    , m_pInversionFlags{&inversionFlags}
+    , m_FirstInversionFlagIndex{firstInversionFlagIndex}
+    , m_SegmentsCount{segmentsCount}
+{
+    assert(m_SegmentsCount > 0 && m_FirstInversionFlagIndex + m_SegmentsCount <= m_pInversionFlags->size());
+}
+
+size_t OrderedDataSetView::Word::size() const
+{
+    return m_pWord->size();
+}
+
+bool OrderedDataSetView::Word::operator[](size_t bitIndex) const
+{
+    const size_t c_SegmentIndex{
+        m_SegmentsCount > 1 ? Utilities::getSegmentIndex(m_pWord->size(), m_SegmentsCount, bitIndex) : 0};
+
+    return (*m_pWord)[bitIndex] != isInverted(c_SegmentIndex);
+}
+
+size_t OrderedDataSetView::Word::getSegmentsCount() const
+{
+    return m_SegmentsCount;
+}
+
+bool OrderedDataSetView::Word::isInverted(size_t segmentIndex) const
+{
+    assert(segmentIndex < m_SegmentsCount);
+
+    return (*m_pInversionFlags)[m_FirstInversionFlagIndex + segmentIndex];
+}
+
+const DataWord& OrderedDataSetView::Word::getOriginalWord() const
+{
+    return *m_pWord;
+}
+
+DataWord OrderedDataSetView::Word::toDataWord() const
+{
+    DataWord word{*m_pWord};
+
+    for (size_t segmentIndex{0}; segmentIndex < m_SegmentsCount; ++segmentIndex)
+    {
+        if (isInverted(segmentIndex))
+        {
+            const size_t c_SegmentBegin{Utilities::getSegmentBegin(word.size(), m_SegmentsCount, segmentIndex)};
+            const size_t c_SegmentEnd{Utilities::getSegmentBegin(word.size(), m_SegmentsCount, segmentIndex + 1)};
+
+            std::transform(word.cbegin() + c_SegmentBegin, word.cbegin() + c_SegmentEnd, word.begin() + c_SegmentBegin,
+                           [](bool value) { return !value; });
+        }
+    }
+
+    return word;
+}
+
+OrderedDataSetView::ConstIterator::ConstIterator(const OrderedDataSetView* pView, size_t position)
+    : m_pView{pView}
+    , m_Position{position}
+{
+}
+
+OrderedDataSetView::Word OrderedDataSetView::ConstIterator::operator*() const
+{
+    return (*m_pView)[m_Position];
+}
+
+OrderedDataSetView::ConstIterator& OrderedDataSetView::ConstIterator::operator++()
+{
+    ++m_Position;
+    return *this;
+}
+
+OrderedDataSetView::ConstIterator OrderedDataSetView::ConstIterator::operator++(int)
+{
+    ConstIterator it{*this};
+    ++m_Position;
+    return it;
+}
+
+OrderedDataSetView::OrderedDataSetView(const DataSet& dataSet, const OrderingIndexes& orderingIndexes,
+                                       const InversionFlags& inversionFlags, size_t segmentsCount)
+    : m_DataSet{dataSet}
+    , m_OrderingIndexes{orderingIndexes}
+    , m_InversionFlags{inversionFlags}
+    , m_SegmentsCount{segmentsCount}
+{
+    assert(m_SegmentsCount > 0 && m_OrderingIndexes.size() * m_SegmentsCount == m_InversionFlags.size());
+}
+
+size_t OrderedDataSetView::size() const
+{
+    return m_OrderingIndexes.size();
+}
+
+size_t OrderedDataSetView::getSegmentsCount() const
+{
+    return m_SegmentsCount;
+}
+
+bool OrderedDataSetView::empty() const
+{
+    return m_OrderingIndexes.empty();
+}
+
+OrderedDataSetView::Word OrderedDataSetView::operator[](size_t position) const
+{
+    assert(position < m_OrderingIndexes.size() && m_OrderingIndexes[position] < m_DataSet.size());
+
+    return Word{m_DataSet[m_OrderingIndexes[position]], m_InversionFlags, position * m_SegmentsCount, m_SegmentsCount};
+}
+
+OrderedDataSetView::ConstIterator OrderedDataSetView::begin() const
+{
+    return ConstIterator{this, 0};
+}
+
+OrderedDataSetView::ConstIterator OrderedDataSetView::end() const
+{
+    return ConstIterator{this, size()};
+}
+
+DataSet OrderedDataSetView::toDataSet() const
+{
+    DataSet dataSet;
+    dataSet.reserve(size());
+
+    for (const Word word : *this)
+    {
+        dataSet.push_back(word.toDataWord());
+    }
+
+    return dataSet;
+}
+
+std::ostream& operator<<(std::ostream& out, const OrderedDataSetView& orderedDataSetView)
+{
+    std::string charsToWrite;
+
+    for (const OrderedDataSetView::Word word : orderedDataSetView)
+    {
+        const DataWord& c_OriginalWord{word.getOriginalWord()};
+        const size_t c_WordSize{c_OriginalWord.size()};
+        const size_t c_SegmentsCount{word.getSegmentsCount()};
+
+        for (size_t segmentIndex{0}; segmentIndex < c_SegmentsCount; ++segmentIndex)
+        {
+            const bool c_IsInverted{word.isInverted(segmentIndex)};
+            const size_t c_SegmentBegin{Utilities::getSegmentBegin(c_WordSize, c_SegmentsCount, segmentIndex)};
+            const size_t c_SegmentEnd{Utilities::getSegmentBegin(c_WordSize, c_SegmentsCount, segmentIndex + 1)};
+
+            std::transform(c_OriginalWord.cbegin() + c_SegmentBegin, c_OriginalWord.cbegin() + c_SegmentEnd,
+                           std::back_inserter(charsToWrite),
+                           [c_IsInverted](bool value) { return value != c_IsInverted ? '1' : '0'; });
+        }
+
+        charsToWrite.push_back('\n');
+    }
+
+    out << charsToWrite;
+
+    return out;
+}
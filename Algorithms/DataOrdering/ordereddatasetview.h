@@ -0,0 +1,93 @@
+#pragma once
+
+#include <iterator>
+#include <ostream>
+
+#include "datautils.h"
+#include "matrix.h"
+
+using OrderingIndex = matrix_size_t;
+using OrderingIndexes = std::vector<OrderingIndex>;
+using InversionFlags = DataWord;
+
+/* Read-only view of an ordered data set:
+   - the ordering indexes and inversion flags are applied when accessing the words, so the ordered data set is never
+   stored separately (the words are not copied, the inversion is applied bit by bit)
+   - it references the original data set, ordering indexes and inversion flags, so it should not outlive them; any
+   change in the ordering is reflected by the view
+   - each word might be split into multiple segments that are inverted separately, in which case the inversion flags of
+   each ordered word are consecutive (one per segment, see Utilities::getSegmentBegin())
+*/
+class OrderedDataSetView
+{
+public:
+    // word of the ordered data set (references the original word)
+    class Word
+    {
+    public:
+        // the inversion flags of the word segments start at the given index
+        Word(const DataWord& word, const InversionFlags& inversionFlags, size_t firstInversionFlagIndex,
+             size_t segmentsCount);
+
+        size_t size() const;
+        bool operator[](size_t bitIndex) const;
+
+        size_t getSegmentsCount() const;
+        bool isInverted(size_t segmentIndex = 0) const;
+        const DataWord& getOriginalWord() const;
+
+        // creates a copy of the word with the inversion applied
+        DataWord toDataWord() const;
+
+    private:
+        const DataWord* m_pWord;
+        const InversionFlags* m_pInversionFlags;
+        size_t m_FirstInversionFlagIndex;
+        size_t m_SegmentsCount;
+    };
+
+    class ConstIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Word;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Word;
+
+        ConstIterator(const OrderedDataSetView* pView, size_t position);
+
+        Word operator*() const;
+        ConstIterator& operator++();
+        ConstIterator operator++(int);
+
+        bool operator==(const ConstIterator& it) const = default;
+
+    private:
+        const OrderedDataSetView* m_pView;
+        size_t m_Position;
+    };
+
+    OrderedDataSetView(const DataSet& dataSet, const OrderingIndexes& orderingIndexes,
+                       const InversionFlags& inversionFlags, size_t segmentsCount = 1);
+
+    size_t size() const;
+    size_t getSegmentsCount() const;
+    bool empty() const;
+
+    Word operator[](size_t position) const;
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+    // creates a copy of the ordered data set (with the inversion applied)
+    DataSet toDataSet() const;
+
+private:
+    const DataSet& m_DataSet;
+    const OrderingIndexes& m_OrderingIndexes;
+    const InversionFlags& m_InversionFlags;
+    size_t m_SegmentsCount;
+};
+
+std::ostream& operator<<(std::ostream& out, const OrderedDataSetView& orderedDataSetView);
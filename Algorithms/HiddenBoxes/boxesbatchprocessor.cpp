@@ -0,0 +1,107 @@
+#include <algorithm>
+
+#include "boxesbatchprocessor.h"
+
+// maximum number of series that can be processed ahead of the result handler (per thread)
+static constexpr size_t c_MaxPendingSeriesPerThread{4};
+
+BoxesBatchProcessor::BoxesBatchProcessor(size_t threadsCount)
+    : m_ThreadsCount{std::max<size_t>(threadsCount, 1)}
+    , m_NextSeriesIndex{0}
+    , m_NextResultIndex{0}
+{
+}
+
+void BoxesBatchProcessor::process(std::vector<BoxesSeries>&& series, const ResultHandler& resultHandler)
+{
+    m_Series = std::move(series);
+    m_ReorderBuffer.clear();
+    m_NextSeriesIndex = 0;
+    m_NextResultIndex = 0;
+
+    const size_t c_SeriesCount{m_Series.size()};
+    std::vector<std::thread> threads;
+    threads.reserve(m_ThreadsCount);
+
+    for (size_t threadNumber{0}; threadNumber < std::min(m_ThreadsCount, c_SeriesCount); ++threadNumber)
+    {
+        threads.emplace_back(&BoxesBatchProcessor::_processSeries, this);
+    }
+
+    for (size_t seriesIndex{0}; seriesIndex < c_SeriesCount; ++seriesIndex)
+    {
+        FittingBoxesResult result;
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ConditionVariable.wait(lock, [this, seriesIndex]() { return m_ReorderBuffer.contains(seriesIndex); });
+
+            auto resultIt{m_ReorderBuffer.find(seriesIndex)};
+            result = std::move(resultIt->second);
+            m_ReorderBuffer.erase(resultIt);
+            m_NextResultIndex = seriesIndex + 1;
+        }
+
+        // allow the threads to pick up new series
+        m_ConditionVariable.notify_all();
+
+        if (resultHandler)
+        {
+            resultHandler(result);
+        }
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    m_Series.clear();
+}
+
+void BoxesBatchProcessor::_processSeries()
+{
+    const size_t c_SeriesCount{m_Series.size()};
+    const size_t c_MaxPendingSeriesCount{c_MaxPendingSeriesPerThread * m_ThreadsCount};
+
+    for (;;)
+    {
+        size_t seriesIndex{0};
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ConditionVariable.wait(lock, [this, c_SeriesCount, c_MaxPendingSeriesCount]() {
+                return m_NextSeriesIndex >= c_SeriesCount ||
+                       m_NextSeriesIndex < m_NextResultIndex + c_MaxPendingSeriesCount;
+            });
+
+            if (m_NextSeriesIndex >= c_SeriesCount)
+            {
+                break;
+            }
+
+            seriesIndex = m_NextSeriesIndex++;
+        }
+
+        // each series is handled by a single thread (no point in processing it in parallel, the threads are busy)
+        FittingBoxesResult result{_retrieveFittingBoxes(std::move(m_Series[seriesIndex]))};
+
+        {
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_ReorderBuffer.emplace(seriesIndex, std::move(result));
+        }
+
+        m_ConditionVariable.notify_all();
+    }
+}
+
+FittingBoxesResult BoxesBatchProcessor::_retrieveFittingBoxes(BoxesSeries&& series)
+{
+    FittingBoxesResult result;
+    BoxSizes boxSizes{std::move(series.m_BoxSizes)};
+
+    result.m_OriginalIndexes = sortBoxes(boxSizes, series.m_DimensionsCount);
+    result.m_FittingBoxesIndexes = retrieveFittingBoxes(boxSizes, series.m_DimensionsCount, 1);
+
+    return result;
+}
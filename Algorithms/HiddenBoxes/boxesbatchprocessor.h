@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "boxutils.h"
+
+struct BoxesSeries
+{
+    BoxSizes m_BoxSizes; // unsorted (as read from input)
+    matrix_size_t m_DimensionsCount;
+};
+
+struct FittingBoxesResult
+{
+    std::vector<matrix_size_t> m_OriginalIndexes;     // original index of each box after lexicographic sort
+    std::vector<matrix_size_t> m_FittingBoxesIndexes; // "after lexicographic sort" indexes of the fitting boxes
+};
+
+/* Processes multiple independent box series in parallel:
+   - each series is sorted and its maximum fitting range of boxes determined by one of the pool threads
+   - the results are collected into a reorder buffer and passed to the result handler in the input order of the series
+   (on the calling thread), as soon as all results of the preceding series are available
+   - the threads cannot get too far ahead of the result handler (the number of pending results is limited), so the
+   buffer doesn't grow beyond a few results per thread
+*/
+class BoxesBatchProcessor
+{
+public:
+    using ResultHandler = std::function<void(const FittingBoxesResult&)>;
+
+    explicit BoxesBatchProcessor(size_t threadsCount = std::thread::hardware_concurrency());
+
+    void process(std::vector<BoxesSeries>&& series, const ResultHandler& resultHandler);
+
+private:
+    void _processSeries();
+
+    static FittingBoxesResult _retrieveFittingBoxes(BoxesSeries&& series);
+
+    size_t m_ThreadsCount;
+    std::vector<BoxesSeries> m_Series;
+    std::map<size_t, FittingBoxesResult> m_ReorderBuffer;
+    std::mutex m_Mutex;
+    std::condition_variable m_ConditionVariable;
+    size_t m_NextSeriesIndex;
+    size_t m_NextResultIndex;
+};
@@ -1,7 +1,277 @@
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+#include <optional>
 
 #include "boxutils.h"
 
+// number of boxes for which the fitting boxes are searched in parallel (among the boxes from previous blocks)
+static constexpr size_t c_BoxesBlockSize{1024};
+
+struct FittingInfo
+{
+    matrix_size_t m_FittingBoxesCount{1};
+    std::optional<matrix_size_t> m_PrevFittingBoxIndex;
+};
+
+using FittingInfos = std::vector<FittingInfo>;
+
+static bool flatBoxFitsIntoBox(const matrix_size_t* pFittingBoxSizes, const matrix_size_t* pIncludingBoxSizes,
+                               matrix_size_t dimensionsCount)
+{
+    bool fitsIntoBox{true};
+
+    for (matrix_size_t dimension{0}; dimension < dimensionsCount; ++dimension)
+    {
+        if (pFittingBoxSizes[dimension] >= pIncludingBoxSizes[dimension])
+        {
+            fitsIntoBox = false;
+            break;
+        }
+    }
+
+    return fitsIntoBox;
+}
+
+static std::vector<matrix_size_t> recoverFittingBoxes(const FittingInfos& fittingInfos)
+{
+    std::vector<matrix_size_t> recoveredIndexes;
+
+    if (!fittingInfos.empty())
+    {
+        // first box with maximum count (same as for the Matrix based implementation)
+        const auto c_MaxFittingIt{
+            std::max_element(fittingInfos.cbegin(), fittingInfos.cend(), [](const auto& first, const auto& second) {
+                return first.m_FittingBoxesCount < second.m_FittingBoxesCount;
+            })};
+
+        recoveredIndexes.reserve(c_MaxFittingIt->m_FittingBoxesCount);
+
+        for (std::optional<matrix_size_t> currentIndex{
+                 static_cast<matrix_size_t>(std::distance(fittingInfos.cbegin(), c_MaxFittingIt))};
+             currentIndex.has_value(); currentIndex = fittingInfos[*currentIndex].m_PrevFittingBoxIndex)
+        {
+            recoveredIndexes.push_back(*currentIndex);
+        }
+
+        std::reverse(recoveredIndexes.begin(), recoveredIndexes.end());
+    }
+
+    return recoveredIndexes;
+}
+
+/* Patience sorting (longest strictly increasing chain), the boxes being processed by increasing first size and (for
+   equal first sizes) by decreasing index, which ensures boxes with the same first size cannot be chained:
+   - the boxes are distributed to piles, the pile number of each box being its fitting boxes count minus 1
+   - within each pile the first sizes are increasing and the second sizes decreasing (in processing order)
+   - the preceding fitting box is the lowest index box from the previous pile that fits into the current box (same as
+   for the Matrix based implementation), which is found by binary search
+*/
+static FittingInfos retrieve2DFittingInfos(const BoxSizes& sortedBoxSizes)
+{
+    const matrix_size_t c_NrOfBoxes{static_cast<matrix_size_t>(sortedBoxSizes.size() / 2)};
+
+    auto firstSize{[&sortedBoxSizes](matrix_size_t boxIndex) { return sortedBoxSizes[2 * boxIndex]; }};
+    auto secondSize{[&sortedBoxSizes](matrix_size_t boxIndex) { return sortedBoxSizes[2 * boxIndex + 1]; }};
+
+    FittingInfos fittingInfos(c_NrOfBoxes);
+    std::vector<std::vector<matrix_size_t>> piles;
+    std::vector<matrix_size_t> pileTopSecondSizes;
+
+    for (matrix_size_t groupStart{0}; groupStart < c_NrOfBoxes;)
+    {
+        matrix_size_t groupEnd{groupStart + 1};
+
+        while (groupEnd < c_NrOfBoxes && firstSize(groupEnd) == firstSize(groupStart))
+        {
+            ++groupEnd;
+        }
+
+        for (matrix_size_t boxIndex{groupEnd}; boxIndex-- > groupStart;)
+        {
+            const matrix_size_t c_FirstSize{firstSize(boxIndex)};
+            const matrix_size_t c_SecondSize{secondSize(boxIndex)};
+            const size_t c_PileIndex{static_cast<size_t>(
+                std::distance(pileTopSecondSizes.cbegin(), std::lower_bound(pileTopSecondSizes.cbegin(),
+                                                                            pileTopSecondSizes.cend(), c_SecondSize)))};
+
+            FittingInfo& fittingInfo{fittingInfos[boxIndex]};
+            fittingInfo.m_FittingBoxesCount = static_cast<matrix_size_t>(c_PileIndex + 1);
+
+            if (c_PileIndex > 0)
+            {
+                const std::vector<matrix_size_t>& c_PrevPile{piles[c_PileIndex - 1]};
+
+                // boxes with smaller first size are at the beginning of the pile, out of these the ones with smaller
+                // second size are located at the end
+                const auto c_SmallerFirstSizeEndIt{
+                    std::partition_point(c_PrevPile.cbegin(), c_PrevPile.cend(),
+                                         [&](matrix_size_t index) { return firstSize(index) < c_FirstSize; })};
+                const auto c_FittingBeginIt{
+                    std::partition_point(c_PrevPile.cbegin(), c_SmallerFirstSizeEndIt,
+                                         [&](matrix_size_t index) { return secondSize(index) >= c_SecondSize; })};
+
+                assert(c_FittingBeginIt != c_SmallerFirstSizeEndIt);
+
+                // the lowest index fitting box is the last one processed out of the boxes with lowest first size
+                const matrix_size_t c_LowestFirstSize{firstSize(*c_FittingBeginIt)};
+                const auto c_LowestFirstSizeEndIt{
+                    std::partition_point(c_FittingBeginIt, c_SmallerFirstSizeEndIt,
+                                         [&](matrix_size_t index) { return firstSize(index) == c_LowestFirstSize; })};
+
+                fittingInfo.m_PrevFittingBoxIndex = *(c_LowestFirstSizeEndIt - 1);
+            }
+
+            if (c_PileIndex == piles.size())
+            {
+                piles.emplace_back();
+                pileTopSecondSizes.push_back(c_SecondSize);
+            }
+
+            piles[c_PileIndex].push_back(boxIndex);
+            pileTopSecondSizes[c_PileIndex] = c_SecondSize;
+        }
+
+        groupStart = groupEnd;
+    }
+
+    return fittingInfos;
+}
+
+/* Dynamic programming with boxes grouped by fitting boxes count (levels):
+   - for each box the levels are checked in decreasing order, the first fitting box (lowest index) from the highest
+   level being the preceding box (same result as for the Matrix based implementation)
+   - for each level the minimum size per dimension is stored, if any of them is not smaller than the corresponding
+   size of the current box, then no box from the level fits and the level is skipped
+   - the boxes are processed in blocks: the fitting boxes from previous blocks are searched in parallel, then the boxes
+   from the same block are checked sequentially; the block boxes are added to the levels once the block is processed
+*/
+static FittingInfos retrieveMultiDimensionalFittingInfos(const BoxSizes& sortedBoxSizes,
+                                                         matrix_size_t dimensionsCount, size_t threadsCount)
+{
+    const matrix_size_t c_NrOfBoxes{static_cast<matrix_size_t>(sortedBoxSizes.size() / dimensionsCount)};
+
+    auto boxSizes{[&sortedBoxSizes, dimensionsCount](matrix_size_t boxIndex) {
+        return sortedBoxSizes.data() + static_cast<size_t>(boxIndex) * dimensionsCount;
+    }};
+
+    FittingInfos fittingInfos(c_NrOfBoxes);
+    std::vector<std::vector<matrix_size_t>> levels;
+    std::vector<BoxSizes> levelMinSizes;
+
+    auto searchPreviousBlocks{[&](matrix_size_t boxIndex) {
+        const matrix_size_t* const pCurrentBoxSizes{boxSizes(boxIndex)};
+        FittingInfo& fittingInfo{fittingInfos[boxIndex]};
+
+        for (size_t levelIndex{levels.size()}; levelIndex-- > 0;)
+        {
+            const BoxSizes& c_MinSizes{levelMinSizes[levelIndex]};
+
+            if (!flatBoxFitsIntoBox(c_MinSizes.data(), pCurrentBoxSizes, dimensionsCount))
+            {
+                continue;
+            }
+
+            const std::vector<matrix_size_t>& c_Level{levels[levelIndex]};
+            const auto c_FittingBoxIt{std::find_if(c_Level.cbegin(), c_Level.cend(), [&](matrix_size_t index) {
+                return flatBoxFitsIntoBox(boxSizes(index), pCurrentBoxSizes, dimensionsCount);
+            })};
+
+            if (c_FittingBoxIt != c_Level.cend())
+            {
+                fittingInfo.m_FittingBoxesCount = static_cast<matrix_size_t>(levelIndex + 2);
+                fittingInfo.m_PrevFittingBoxIndex = *c_FittingBoxIt;
+                break;
+            }
+        }
+    }};
+
+    for (matrix_size_t blockStart{0}; blockStart < c_NrOfBoxes; blockStart += c_BoxesBlockSize)
+    {
+        const matrix_size_t c_BlockEnd{
+            static_cast<matrix_size_t>(std::min<size_t>(blockStart + c_BoxesBlockSize, c_NrOfBoxes))};
+        const size_t c_BlockThreadsCount{
+            levels.empty() ? 1 : std::clamp<size_t>(threadsCount, 1, c_BlockEnd - blockStart)};
+
+        if (c_BlockThreadsCount > 1)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(c_BlockThreadsCount);
+
+            for (size_t threadIndex{0}; threadIndex < c_BlockThreadsCount; ++threadIndex)
+            {
+                threads.emplace_back([&, threadIndex]() {
+                    for (matrix_size_t boxIndex{static_cast<matrix_size_t>(blockStart + threadIndex)};
+                         boxIndex < c_BlockEnd; boxIndex += static_cast<matrix_size_t>(c_BlockThreadsCount))
+                    {
+                        searchPreviousBlocks(boxIndex);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        else if (!levels.empty())
+        {
+            for (matrix_size_t boxIndex{blockStart}; boxIndex < c_BlockEnd; ++boxIndex)
+            {
+                searchPreviousBlocks(boxIndex);
+            }
+        }
+
+        // boxes from previous blocks have lower indexes so they are preferred for equal counts
+        for (matrix_size_t boxIndex{blockStart}; boxIndex < c_BlockEnd; ++boxIndex)
+        {
+            FittingInfo& fittingInfo{fittingInfos[boxIndex]};
+
+            for (matrix_size_t prevBoxIndex{blockStart}; prevBoxIndex < boxIndex; ++prevBoxIndex)
+            {
+                const matrix_size_t c_PrevFittingBoxesCount{fittingInfos[prevBoxIndex].m_FittingBoxesCount};
+
+                if (c_PrevFittingBoxesCount + 1 > fittingInfo.m_FittingBoxesCount &&
+                    flatBoxFitsIntoBox(boxSizes(prevBoxIndex), boxSizes(boxIndex), dimensionsCount))
+                {
+                    fittingInfo.m_FittingBoxesCount = c_PrevFittingBoxesCount + 1;
+                    fittingInfo.m_PrevFittingBoxIndex = prevBoxIndex;
+                }
+            }
+        }
+
+        for (matrix_size_t boxIndex{blockStart}; boxIndex < c_BlockEnd; ++boxIndex)
+        {
+            const size_t c_LevelIndex{fittingInfos[boxIndex].m_FittingBoxesCount - 1u};
+            const matrix_size_t* const pCurrentBoxSizes{boxSizes(boxIndex)};
+
+            if (c_LevelIndex >= levels.size())
+            {
+                levels.resize(c_LevelIndex + 1);
+                levelMinSizes.resize(c_LevelIndex + 1);
+            }
+
+            if (levels[c_LevelIndex].empty())
+            {
+                levelMinSizes[c_LevelIndex].assign(pCurrentBoxSizes, pCurrentBoxSizes + dimensionsCount);
+            }
+            else
+            {
+                BoxSizes& minSizes{levelMinSizes[c_LevelIndex]};
+
+                for (matrix_size_t dimension{0}; dimension < dimensionsCount; ++dimension)
+                {
+                    minSizes[dimension] = std::min(minSizes[dimension], pCurrentBoxSizes[dimension]);
+                }
+            }
+
+            levels[c_LevelIndex].push_back(boxIndex);
+        }
+    }
+
+    return fittingInfos;
+}
+
 std::vector<matrix_size_t> retrieveFittingBoxes(const Matrix<matrix_size_t>& boxes)
 {
     // total number of boxes belonging to series
@@ -102,3 +372,68 @@ bool boxFitsIntoBox(matrix_size_t fittingBoxNumber, matrix_size_t includingBoxNu
 
     return fitsIntoBox;
 }
+
+std::vector<matrix_size_t> sortBoxes(BoxSizes& boxSizes, matrix_size_t dimensionsCount)
+{
+    std::vector<matrix_size_t> originalIndexes;
+
+    if (dimensionsCount > 0 && boxSizes.size() % dimensionsCount == 0)
+    {
+        const size_t c_NrOfBoxes{boxSizes.size() / dimensionsCount};
+
+        for (auto it{boxSizes.begin()}; it != boxSizes.end(); it += dimensionsCount)
+        {
+            std::sort(it, it + dimensionsCount);
+        }
+
+        originalIndexes.resize(c_NrOfBoxes);
+        std::iota(originalIndexes.begin(), originalIndexes.end(), 0);
+
+        // stable sorting keeps equal boxes in their original order (same as the bubble sort from lexicographicalSort())
+        std::stable_sort(originalIndexes.begin(), originalIndexes.end(),
+                         [&](matrix_size_t first, matrix_size_t second) {
+                             const auto c_FirstBoxIt{boxSizes.cbegin() +
+                                                     static_cast<ptrdiff_t>(first) * dimensionsCount};
+                             const auto c_SecondBoxIt{boxSizes.cbegin() +
+                                                      static_cast<ptrdiff_t>(second) * dimensionsCount};
+
+                             return std::lexicographical_compare(c_FirstBoxIt, c_FirstBoxIt + dimensionsCount,
+                                                                 c_SecondBoxIt, c_SecondBoxIt + dimensionsCount);
+                         });
+
+        BoxSizes sortedBoxSizes;
+        sortedBoxSizes.reserve(boxSizes.size());
+
+        for (const matrix_size_t originalIndex : originalIndexes)
+        {
+            const auto c_BoxIt{boxSizes.cbegin() + static_cast<ptrdiff_t>(originalIndex) * dimensionsCount};
+            sortedBoxSizes.insert(sortedBoxSizes.end(), c_BoxIt, c_BoxIt + dimensionsCount);
+        }
+
+        boxSizes = std::move(sortedBoxSizes);
+    }
+    else
+    {
+        assert(false);
+    }
+
+    return originalIndexes;
+}
+
+std::vector<matrix_size_t> retrieveFittingBoxes(const BoxSizes& sortedBoxSizes, matrix_size_t dimensionsCount,
+                                                size_t threadsCount)
+{
+    std::vector<matrix_size_t> fittingBoxes;
+
+    // see boxFitsIntoBox() regarding the minimum number of dimensions
+    assert(dimensionsCount > 1 && "Invalid dimensions for boxes");
+
+    if (dimensionsCount > 0 && sortedBoxSizes.size() % dimensionsCount == 0)
+    {
+        fittingBoxes = recoverFittingBoxes(
+            2 == dimensionsCount ? retrieve2DFittingInfos(sortedBoxSizes)
+                                 : retrieveMultiDimensionalFittingInfos(sortedBoxSizes, dimensionsCount, threadsCount));
+    }
+
+    return fittingBoxes;
+}
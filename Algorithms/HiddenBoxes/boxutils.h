@@ -1,7 +1,26 @@
 #pragma once
 
+#include <thread>
+#include <vector>
+
 #include "matrix.h"
 
+// sizes of all boxes from a series stored contiguously (box i occupies positions i * dimensionsCount to (i + 1) *
+// dimensionsCount - 1)
+using BoxSizes = std::vector<matrix_size_t>;
+
 std::vector<matrix_size_t> retrieveFittingBoxes(const Matrix<matrix_size_t>& boxes);
 bool boxFitsIntoBox(matrix_size_t fittingBoxNumber, matrix_size_t includingBoxNumber,
                     const Matrix<matrix_size_t>& boxes);
+
+/* Faster alternatives for large series (same results as Utilities::lexicographicalSort() + retrieveFittingBoxes()):
+   - sortBoxes() sorts the sizes of each box and then the boxes lexicographically (stable sort), the original box
+   indexes being returned
+   - retrieveFittingBoxes() with flat data requires the boxes to be sorted by sortBoxes(): for 2 dimensions an
+   O(n * log(n)) patience sorting approach is used, for more dimensions the boxes are grouped by fitting boxes count
+   and the groups that cannot contain fitting boxes are skipped (the search is performed in parallel for blocks of
+   boxes)
+*/
+std::vector<matrix_size_t> sortBoxes(BoxSizes& boxSizes, matrix_size_t dimensionsCount);
+std::vector<matrix_size_t> retrieveFittingBoxes(const BoxSizes& sortedBoxSizes, matrix_size_t dimensionsCount,
+                                                size_t threadsCount = std::thread::hardware_concurrency());
@@ -5,22 +5,31 @@
    3, 2) can be re-ordered (1, 2, 3)
      - the boxes need to be lexicographically sorted (in increasing order); then dynamic programming is performed to
    determine the maximum number of boxes that fit into each other
+     - the box sizes are copied from the read Matrix into a flat array in order to use the faster algorithms (see
+   boxutils.h), the results being the same
+     - batch mode (application launched with the -b argument): all series are read first and then processed in
+   parallel, the results being written in the same order as for the regular mode
 */
 
 #include <fstream>
 #include <iostream>
 
+#include "boxesbatchprocessor.h"
 #include "boxutils.h"
 #include "matrixutils.h"
 #include "utils.h"
 
 static const std::string c_InFile{Utilities::c_InputOutputDir + "boxesinput.txt"};
 static const std::string c_OutFile{Utilities::c_InputOutputDir + "boxesoutput.txt"};
+static const std::string c_BatchModeOption{"-b"};
 
 void logFittingBoxesToFile(std::ofstream& outStream, const std::vector<matrix_size_t>& fittingBoxIndexes,
                            const std::vector<matrix_size_t>& originalIndexes);
 
-int main()
+int processSeriesOneByOne(std::ifstream& in, std::ofstream& out);
+int processSeriesInBatch(std::ifstream& in, std::ofstream& out);
+
+int main(int argc, char** argv)
 {
     std::ifstream in{c_InFile};
     std::ofstream out{c_OutFile};
@@ -29,41 +38,79 @@ int main()
 
     if (in.is_open() && out.is_open())
     {
-        Matrix<matrix_size_t> sortedBoxData;
-
         std::cout << "Reading all existing box series from input file: " << c_InFile << "\n\n";
 
-        int nrOfSeries{0};
+        const bool c_IsBatchMode{argc > 1 && c_BatchModeOption == argv[1]};
+        const int c_NrOfSeries{c_IsBatchMode ? processSeriesInBatch(in, out) : processSeriesOneByOne(in, out)};
+
+        std::cout << "\n" << c_NrOfSeries << " series found and processed\n\n";
+    }
+    else
+    {
+        std::cerr << "Error in opening input and/or output file\n\n";
+    }
+
+    return 0;
+}
+
+int processSeriesOneByOne(std::ifstream& in, std::ofstream& out)
+{
+    Matrix<matrix_size_t> boxData;
+    int nrOfSeries{0};
+
+    while (!in.eof())
+    {
+        in >> boxData;
 
-        while (!in.eof())
+        if (boxData.getNrOfRows() > 0)
         {
-            in >> sortedBoxData;
+            const matrix_size_t c_DimensionsCount{boxData.getNrOfColumns()};
+            BoxSizes sortedBoxSizes{boxData.constZBegin(), boxData.constZEnd()};
 
-            if (sortedBoxData.getNrOfRows() > 0)
-            {
-                // the "original indexes" are the indexes of all boxes before lexicographic sort
-                const std::vector<matrix_size_t> c_OriginalIndexes{
-                    Utilities::lexicographicalSort<matrix_size_t>(sortedBoxData, true)};
+            // the "original indexes" are the indexes of all boxes before lexicographic sort
+            const std::vector<matrix_size_t> c_OriginalIndexes{sortBoxes(sortedBoxSizes, c_DimensionsCount)};
 
-                // the "fitting boxes indexes" are the "before lexicographic sort" indexes of the boxes that belong to
-                // maximum fitting series
-                const std::vector<matrix_size_t> c_FittingBoxesIndexes{retrieveFittingBoxes(sortedBoxData)};
+            // the "fitting boxes indexes" are the "before lexicographic sort" indexes of the boxes that belong to
+            // maximum fitting series
+            const std::vector<matrix_size_t> c_FittingBoxesIndexes{
+                retrieveFittingBoxes(sortedBoxSizes, c_DimensionsCount)};
 
-                std::cout << "Writing maximum fitting range of boxes to output file: " << c_OutFile << "\n";
+            std::cout << "Writing maximum fitting range of boxes to output file: " << c_OutFile << "\n";
 
-                logFittingBoxesToFile(out, c_FittingBoxesIndexes, c_OriginalIndexes);
-                ++nrOfSeries;
-            }
+            logFittingBoxesToFile(out, c_FittingBoxesIndexes, c_OriginalIndexes);
+            ++nrOfSeries;
         }
-
-        std::cout << "\n" << nrOfSeries << " series found and processed\n\n";
     }
-    else
+
+    return nrOfSeries;
+}
+
+int processSeriesInBatch(std::ifstream& in, std::ofstream& out)
+{
+    Matrix<matrix_size_t> boxData;
+    std::vector<BoxesSeries> series;
+
+    while (!in.eof())
     {
-        std::cerr << "Error in opening input and/or output file\n\n";
+        in >> boxData;
+
+        if (boxData.getNrOfRows() > 0)
+        {
+            series.push_back(
+                BoxesSeries{BoxSizes{boxData.constZBegin(), boxData.constZEnd()}, boxData.getNrOfColumns()});
+        }
     }
 
-    return 0;
+    const int c_NrOfSeries{static_cast<int>(series.size())};
+
+    std::cout << "Writing maximum fitting range of boxes for each series to output file: " << c_OutFile << "\n";
+
+    BoxesBatchProcessor batchProcessor;
+    batchProcessor.process(std::move(series), [&out](const FittingBoxesResult& result) {
+        logFittingBoxesToFile(out, result.m_FittingBoxesIndexes, result.m_OriginalIndexes);
+    });
+
+    return c_NrOfSeries;
 }
 
 // logs the input file row number of each found box by taking the lexicographical ordering into consideration
@@ -0,0 +1,348 @@
+// clang-format off
+#include <QTest>
+
+#include <limits>
+#include <random>
+
+#include "huffmanblockcompressor.h"
+
+using CodeTableMode = HuffmanBlockCompressor::CodeTableMode;
+
+// integer written into the container (little endian) for corrupting it
+struct ContainerPatch
+{
+    size_t m_Position;
+    size_t m_BytesCount;
+    uint64_t m_Value;
+};
+
+using ContainerPatches = std::vector<ContainerPatch>;
+
+class HuffmanBlockCompressorTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testRoundTrip();
+    void testDecompressBlock();
+    void testTruncatedContainer();
+    void testCorruptedContainer();
+
+    void testRoundTrip_data();
+    void testDecompressBlock_data();
+    void testTruncatedContainer_data();
+    void testCorruptedContainer_data();
+};
+
+// container layout (see HuffmanBlockCompressor)
+static constexpr size_t c_VersionPosition{4};
+static constexpr size_t c_CodeTableModePosition{5};
+static constexpr size_t c_BlockSizePosition{6};
+static constexpr size_t c_InputSizePosition{10};
+static constexpr size_t c_BlocksCountPosition{18};
+static constexpr size_t c_HeaderSize{22};
+static constexpr size_t c_BlockIndexEntrySize{16};
+
+static const std::string c_InvalidOutput{"unchanged"};
+
+// the lower chars are more frequent, so the resulting codes have different lengths
+static std::string generateInput(size_t size, size_t charsCount, unsigned int seed)
+{
+    std::mt19937 generator{seed};
+    std::vector<double> weights(charsCount);
+
+    for (size_t charIndex{0}; charIndex < charsCount; ++charIndex)
+    {
+        weights[charIndex] = 1.0 / static_cast<double>(charIndex + 1);
+    }
+
+    std::discrete_distribution<size_t> charDistribution(weights.cbegin(), weights.cend());
+    std::string input(size, '\0');
+
+    for (char& c : input)
+    {
+        c = static_cast<char>(charDistribution(generator));
+    }
+
+    return input;
+}
+
+static uint64_t readInteger(const CompressedData& data, size_t position, size_t bytesCount)
+{
+    uint64_t value{0};
+
+    for (size_t byteIndex{0}; byteIndex < bytesCount; ++byteIndex)
+    {
+        value |= static_cast<uint64_t>(data[position + byteIndex]) << (8 * byteIndex);
+    }
+
+    return value;
+}
+
+// symbols count followed by symbol, code length and code bytes for each symbol
+static size_t getCodeTableSize(const CompressedData& data, size_t position)
+{
+    const uint64_t c_SymbolsCount{readInteger(data, position, 2)};
+    size_t codeTableSize{2};
+
+    for (uint64_t symbolIndex{0}; symbolIndex < c_SymbolsCount; ++symbolIndex)
+    {
+        codeTableSize += 2 + (data[position + codeTableSize + 1] + 7) / 8;
+    }
+
+    return codeTableSize;
+}
+
+static size_t getBlockIndexPosition(const CompressedData& data)
+{
+    const bool c_IsSharedCodeTable{static_cast<uint8_t>(CodeTableMode::SHARED) == data[c_CodeTableModePosition]};
+
+    return c_HeaderSize + (c_IsSharedCodeTable ? getCodeTableSize(data, c_HeaderSize) : 0);
+}
+
+static size_t getBlockPosition(const CompressedData& data, size_t blockIndex)
+{
+    const size_t c_BlockIndexPosition{getBlockIndexPosition(data)};
+    const size_t c_BlocksCount{readInteger(data, c_BlocksCountPosition, 4)};
+
+    return c_BlockIndexPosition + c_BlocksCount * c_BlockIndexEntrySize + readInteger(data, c_BlockIndexPosition + blockIndex * c_BlockIndexEntrySize, 8);
+}
+
+// compression is checked by the round trip tests
+static CompressedData compress(const std::string& input, size_t blockSize, CodeTableMode codeTableMode)
+{
+    CompressedData compressedData;
+    HuffmanBlockCompressor{blockSize, codeTableMode}.compress(input, compressedData);
+
+    return compressedData;
+}
+
+void HuffmanBlockCompressorTests::testRoundTrip()
+{
+    QFETCH(std::string, input);
+    QFETCH(size_t, blockSize);
+    QFETCH(CodeTableMode, codeTableMode);
+    QFETCH(size_t, threadsCount);
+
+    HuffmanBlockCompressor compressor{blockSize, codeTableMode, threadsCount};
+    CompressedData compressedData;
+    std::string output{c_InvalidOutput};
+
+    QVERIFY(compressor.compress(input, compressedData));
+    QVERIFY(compressor.decompress(compressedData, output));
+    QCOMPARE(output, input);
+    QVERIFY(HuffmanBlockCompressor::getBlocksCount(compressedData) == (input.size() + blockSize - 1) / blockSize);
+
+    // the block size and code table mode are read from the container
+    output = c_InvalidOutput;
+
+    QVERIFY(HuffmanBlockCompressor{}.decompress(compressedData, output));
+    QCOMPARE(output, input);
+}
+
+void HuffmanBlockCompressorTests::testDecompressBlock()
+{
+    QFETCH(std::string, input);
+    QFETCH(size_t, blockSize);
+    QFETCH(CodeTableMode, codeTableMode);
+
+    const CompressedData c_CompressedData{compress(input, blockSize, codeTableMode)};
+    const size_t c_BlocksCount{(input.size() + blockSize - 1) / blockSize};
+
+    QVERIFY(HuffmanBlockCompressor::getBlocksCount(c_CompressedData) == c_BlocksCount);
+
+    // in reverse order, so no block depends on the previously decoded ones
+    for (size_t blockIndex{c_BlocksCount}; blockIndex > 0; --blockIndex)
+    {
+        std::string output{c_InvalidOutput};
+
+        QVERIFY(HuffmanBlockCompressor::decompressBlock(c_CompressedData, blockIndex - 1, output));
+        QCOMPARE(output, input.substr((blockIndex - 1) * blockSize, blockSize));
+    }
+
+    std::string output{c_InvalidOutput};
+
+    QVERIFY(!HuffmanBlockCompressor::decompressBlock(c_CompressedData, c_BlocksCount, output));
+    QCOMPARE(output, c_InvalidOutput);
+}
+
+void HuffmanBlockCompressorTests::testTruncatedContainer()
+{
+    QFETCH(std::string, input);
+    QFETCH(size_t, blockSize);
+    QFETCH(CodeTableMode, codeTableMode);
+
+    const CompressedData c_CompressedData{compress(input, blockSize, codeTableMode)};
+    const size_t c_BlocksCount{(input.size() + blockSize - 1) / blockSize};
+
+    QVERIFY(HuffmanBlockCompressor::getBlocksCount(c_CompressedData) == c_BlocksCount);
+
+    for (size_t truncatedSize{0}; truncatedSize < c_CompressedData.size(); ++truncatedSize)
+    {
+        const CompressedData c_TruncatedData(c_CompressedData.cbegin(), c_CompressedData.cbegin() + truncatedSize);
+        std::string output{c_InvalidOutput};
+
+        QVERIFY(!HuffmanBlockCompressor{}.decompress(c_TruncatedData, output));
+        QCOMPARE(output, c_InvalidOutput);
+
+        // the last block is always affected by truncation
+        QVERIFY(c_BlocksCount == 0 || !HuffmanBlockCompressor::decompressBlock(c_TruncatedData, c_BlocksCount - 1, output));
+        QCOMPARE(output, c_InvalidOutput);
+    }
+}
+
+void HuffmanBlockCompressorTests::testCorruptedContainer()
+{
+    QFETCH(CompressedData, compressedData);
+    QFETCH(ContainerPatches, patches);
+    QFETCH(size_t, corruptedBlockIndex);
+
+    for (const ContainerPatch& c_Patch : patches)
+    {
+        for (size_t byteIndex{0}; byteIndex < c_Patch.m_BytesCount; ++byteIndex)
+        {
+            compressedData[c_Patch.m_Position + byteIndex] = static_cast<uint8_t>(c_Patch.m_Value >> (8 * byteIndex));
+        }
+    }
+
+    std::string output{c_InvalidOutput};
+
+    QVERIFY(!HuffmanBlockCompressor{}.decompress(compressedData, output));
+    QCOMPARE(output, c_InvalidOutput);
+    QVERIFY(!HuffmanBlockCompressor::decompressBlock(compressedData, corruptedBlockIndex, output));
+    QCOMPARE(output, c_InvalidOutput);
+}
+
+void HuffmanBlockCompressorTests::testRoundTrip_data()
+{
+    QTest::addColumn<std::string>("input");
+    QTest::addColumn<size_t>("blockSize");
+    QTest::addColumn<CodeTableMode>("codeTableMode");
+    QTest::addColumn<size_t>("threadsCount");
+
+    const std::string c_Text{generateInput(10000, 20, 1)};
+    const std::string c_AllChars{generateInput(50000, 256, 2)};
+
+    for (const auto& [c_ModeName, c_CodeTableMode] : {std::pair{"shared", CodeTableMode::SHARED}, std::pair{"per block", CodeTableMode::PER_BLOCK}})
+    {
+        const std::string c_Mode{c_ModeName};
+
+        QTest::newRow((c_Mode + ": empty input").c_str()) << std::string{} << size_t{1024} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single char").c_str()) << std::string(1, 'a') << size_t{1024} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single repeated char").c_str()) << std::string(5000, 'a') << size_t{1024} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": two chars").c_str()) << std::string{"ab"} << size_t{1024} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": null chars").c_str()) << std::string{"\0a\0\0b\0", 6} << size_t{4} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single block").c_str()) << c_Text << size_t{16384} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": input size equal to block size").c_str()) << c_Text << size_t{10000} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": full blocks only").c_str()) << c_Text << size_t{1000} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": partial last block").c_str()) << c_Text << size_t{1024} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single char last block").c_str()) << c_Text << size_t{3333} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single char blocks").c_str()) << c_Text.substr(0, 500) << size_t{1} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": all chars").c_str()) << c_AllChars << size_t{4096} << c_CodeTableMode << size_t{4};
+        QTest::newRow((c_Mode + ": single thread").c_str()) << c_AllChars << size_t{4096} << c_CodeTableMode << size_t{1};
+        QTest::newRow((c_Mode + ": more threads than blocks").c_str()) << c_Text << size_t{4096} << c_CodeTableMode << size_t{8};
+    }
+}
+
+void HuffmanBlockCompressorTests::testDecompressBlock_data()
+{
+    QTest::addColumn<std::string>("input");
+    QTest::addColumn<size_t>("blockSize");
+    QTest::addColumn<CodeTableMode>("codeTableMode");
+
+    const std::string c_Text{generateInput(10000, 40, 3)};
+
+    for (const auto& [c_ModeName, c_CodeTableMode] : {std::pair{"shared", CodeTableMode::SHARED}, std::pair{"per block", CodeTableMode::PER_BLOCK}})
+    {
+        const std::string c_Mode{c_ModeName};
+
+        QTest::newRow((c_Mode + ": empty input").c_str()) << std::string{} << size_t{1024} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": single block").c_str()) << c_Text << size_t{16384} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": full blocks only").c_str()) << c_Text << size_t{2500} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": partial last block").c_str()) << c_Text << size_t{1024} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": single repeated char").c_str()) << std::string(5000, 'z') << size_t{1024} << c_CodeTableMode;
+    }
+}
+
+void HuffmanBlockCompressorTests::testTruncatedContainer_data()
+{
+    QTest::addColumn<std::string>("input");
+    QTest::addColumn<size_t>("blockSize");
+    QTest::addColumn<CodeTableMode>("codeTableMode");
+
+    const std::string c_Text{generateInput(600, 20, 4)};
+
+    for (const auto& [c_ModeName, c_CodeTableMode] : {std::pair{"shared", CodeTableMode::SHARED}, std::pair{"per block", CodeTableMode::PER_BLOCK}})
+    {
+        const std::string c_Mode{c_ModeName};
+
+        QTest::newRow((c_Mode + ": empty input").c_str()) << std::string{} << size_t{256} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": single block").c_str()) << c_Text << size_t{1024} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": partial last block").c_str()) << c_Text << size_t{256} << c_CodeTableMode;
+        QTest::newRow((c_Mode + ": single repeated char").c_str()) << std::string(600, 'z') << size_t{256} << c_CodeTableMode;
+    }
+}
+
+/* Input of 3 blocks (the last one being partial) compressed in both modes, corrupted by overwriting container fields:
+   - the corrupted block index is the one decompressBlock() should fail for (any block if the header gets corrupted)
+   - the output size is taken from the header, so it should be rejected before allocating if the encoded bits cannot
+   produce it
+*/
+void HuffmanBlockCompressorTests::testCorruptedContainer_data()
+{
+    QTest::addColumn<CompressedData>("compressedData");
+    QTest::addColumn<ContainerPatches>("patches");
+    QTest::addColumn<size_t>("corruptedBlockIndex");
+
+    static constexpr size_t c_BlockSize{1024};
+    static constexpr size_t c_MaxBlockSize{std::numeric_limits<uint32_t>::max()};
+
+    const std::string c_Text{generateInput(3000, 20, 5)};
+
+    for (const auto& [c_ModeName, c_CodeTableMode] : {std::pair{"shared", CodeTableMode::SHARED}, std::pair{"per block", CodeTableMode::PER_BLOCK}})
+    {
+        const std::string c_Mode{c_ModeName};
+        const CompressedData c_CompressedData{compress(c_Text, c_BlockSize, c_CodeTableMode)};
+        const size_t c_BlockIndexPosition{getBlockIndexPosition(c_CompressedData)};
+        const size_t c_LastBlockPosition{getBlockPosition(c_CompressedData, 2)};
+        const size_t c_LastBlockBitsCountPosition{c_LastBlockPosition + (CodeTableMode::PER_BLOCK == c_CodeTableMode ? getCodeTableSize(c_CompressedData, c_LastBlockPosition) : 0)};
+        const uint64_t c_LastBlockBitsCount{readInteger(c_CompressedData, c_LastBlockBitsCountPosition, 8)};
+
+        QTest::newRow((c_Mode + ": invalid signature").c_str()) << c_CompressedData << ContainerPatches{{0, 1, 'X'}} << size_t{0};
+        QTest::newRow((c_Mode + ": unsupported version").c_str()) << c_CompressedData << ContainerPatches{{c_VersionPosition, 1, 2}} << size_t{0};
+        QTest::newRow((c_Mode + ": invalid code table mode").c_str()) << c_CompressedData << ContainerPatches{{c_CodeTableModePosition, 1, 2}} << size_t{0};
+        QTest::newRow((c_Mode + ": zero block size").c_str()) << c_CompressedData << ContainerPatches{{c_BlockSizePosition, 4, 0}} << size_t{0};
+        QTest::newRow((c_Mode + ": block size not matching blocks count").c_str()) << c_CompressedData << ContainerPatches{{c_BlockSizePosition, 4, 2 * c_BlockSize}} << size_t{0};
+        QTest::newRow((c_Mode + ": input size not matching blocks count").c_str()) << c_CompressedData << ContainerPatches{{c_InputSizePosition, 8, c_Text.size() + c_BlockSize}} << size_t{0};
+        QTest::newRow((c_Mode + ": blocks count exceeding block index").c_str()) << c_CompressedData << ContainerPatches{{c_InputSizePosition, 8, c_Text.size() + 1000 * c_BlockSize}, {c_BlocksCountPosition, 4, 1003}} << size_t{0};
+        QTest::newRow((c_Mode + ": huge output size").c_str()) << c_CompressedData << ContainerPatches{{c_BlockSizePosition, 4, c_MaxBlockSize}, {c_InputSizePosition, 8, 3 * c_MaxBlockSize}} << size_t{0};
+        QTest::newRow((c_Mode + ": last block output size equal to block size").c_str()) << c_CompressedData << ContainerPatches{{c_InputSizePosition, 8, 2 * c_BlockSize + c_BlockSize - 1}} << size_t{2};
+        QTest::newRow((c_Mode + ": last block output size exceeding encoded bits").c_str()) << c_CompressedData << ContainerPatches{{c_InputSizePosition, 8, c_Text.size() + 1}} << size_t{2};
+        QTest::newRow((c_Mode + ": block offset out of range").c_str()) << c_CompressedData << ContainerPatches{{c_BlockIndexPosition + c_BlockIndexEntrySize, 8, c_CompressedData.size()}} << size_t{1};
+        QTest::newRow((c_Mode + ": encoded block size out of range").c_str()) << c_CompressedData << ContainerPatches{{c_BlockIndexPosition + 2 * c_BlockIndexEntrySize + 8, 8, c_CompressedData.size()}} << size_t{2};
+        QTest::newRow((c_Mode + ": encoded bits count too large").c_str()) << c_CompressedData << ContainerPatches{{c_LastBlockBitsCountPosition, 8, c_LastBlockBitsCount + 8}} << size_t{2};
+        QTest::newRow((c_Mode + ": encoded bits count too small").c_str()) << c_CompressedData << ContainerPatches{{c_LastBlockBitsCountPosition, 8, c_LastBlockBitsCount - 1}} << size_t{2};
+        QTest::newRow((c_Mode + ": huge encoded bits count").c_str()) << c_CompressedData << ContainerPatches{{c_LastBlockBitsCountPosition, 8, std::numeric_limits<uint64_t>::max()}} << size_t{2};
+    }
+
+    const CompressedData c_SharedCompressedData{compress(c_Text, c_BlockSize, CodeTableMode::SHARED)};
+    const CompressedData c_PerBlockCompressedData{compress(c_Text, c_BlockSize, CodeTableMode::PER_BLOCK)};
+    const size_t c_FirstBlockPosition{getBlockPosition(c_PerBlockCompressedData, 0)};
+
+    // the first code is 2 bits long (most frequent of 20 chars), so the second symbol follows it after 5 bytes (symbols
+    // count, first symbol, code length, code bits) and the code becomes a prefix of other codes if shortened to 1 bit
+    QTest::newRow("shared: empty code table") << c_SharedCompressedData << ContainerPatches{{c_HeaderSize, 2, 0}} << size_t{0};
+    QTest::newRow("shared: too many symbols") << c_SharedCompressedData << ContainerPatches{{c_HeaderSize, 2, 257}} << size_t{0};
+    QTest::newRow("shared: duplicate symbol") << c_SharedCompressedData << ContainerPatches{{c_HeaderSize + 5, 1, c_SharedCompressedData[c_HeaderSize + 2]}} << size_t{0};
+    QTest::newRow("shared: codes not prefix-free") << c_SharedCompressedData << ContainerPatches{{c_HeaderSize + 3, 1, 1}} << size_t{0};
+    QTest::newRow("per block: empty code table") << c_PerBlockCompressedData << ContainerPatches{{c_FirstBlockPosition, 2, 0}} << size_t{0};
+    QTest::newRow("per block: too many symbols") << c_PerBlockCompressedData << ContainerPatches{{c_FirstBlockPosition, 2, 257}} << size_t{0};
+    QTest::newRow("per block: duplicate symbol") << c_PerBlockCompressedData << ContainerPatches{{c_FirstBlockPosition + 5, 1, c_PerBlockCompressedData[c_FirstBlockPosition + 2]}} << size_t{0};
+    QTest::newRow("per block: codes not prefix-free") << c_PerBlockCompressedData << ContainerPatches{{c_FirstBlockPosition + 3, 1, 1}} << size_t{0};
+    QTest::newRow("per block: empty code among multiple codes") << c_PerBlockCompressedData << ContainerPatches{{c_FirstBlockPosition + 3, 1, 0}} << size_t{0};
+}
+
+QTEST_APPLESS_MAIN(HuffmanBlockCompressorTests)
+
+#include "tst_huffmanblockcompressortests.moc"
+// clang-format on
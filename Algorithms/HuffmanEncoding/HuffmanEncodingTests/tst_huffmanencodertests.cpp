@@ -0,0 +1,456 @@
+// clang-format off
+#include <QTest>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+#include "huffmanblockcompressor.h"
+#include "huffmanencoder.h"
+
+using Occurrences = std::vector<size_t>;
+using MaxCodeLength = std::optional<size_t>;
+
+class HuffmanEncoderTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testLengthLimitedEncoding();
+    void testLengthLimitedRoundTrip();
+    void testEncodingNotPerformed();
+
+    void testLengthLimitedEncoding_data();
+    void testLengthLimitedRoundTrip_data();
+    void testEncodingNotPerformed_data();
+};
+
+// the characters are assigned in increasing order starting with the given one (the occurrences are not sorted)
+static EncodingInput createEncodingInput(const Occurrences& occurrences, char firstChar = 'a')
+{
+    EncodingInput encodingInput{static_cast<matrix_size_t>(occurrences.size()), 2, ""};
+
+    for (size_t charIndex{0}; charIndex < occurrences.size(); ++charIndex)
+    {
+        encodingInput.at(static_cast<matrix_size_t>(charIndex), 0) = std::string(1, static_cast<char>(firstChar + charIndex));
+        encodingInput.at(static_cast<matrix_size_t>(charIndex), 1) = std::to_string(occurrences[charIndex]);
+    }
+
+    return encodingInput;
+}
+
+static Occurrences getFibonacciOccurrences(size_t charsCount)
+{
+    Occurrences occurrences{1, 1};
+
+    while (occurrences.size() < charsCount)
+    {
+        occurrences.push_back(occurrences[occurrences.size() - 1] + occurrences[occurrences.size() - 2]);
+    }
+
+    occurrences.resize(charsCount);
+
+    return occurrences;
+}
+
+static Occurrences getIncreasingOccurrences(size_t charsCount)
+{
+    Occurrences occurrences(charsCount);
+    std::iota(occurrences.begin(), occurrences.end(), 1);
+
+    return occurrences;
+}
+
+static size_t getMaxCodeLength(const EncodingOutput& encodingResult)
+{
+    size_t maxCodeLength{0};
+
+    for (const auto& [character, code] : encodingResult)
+    {
+        maxCodeLength = std::max(maxCodeLength, code.size());
+    }
+
+    return maxCodeLength;
+}
+
+static size_t getEncodedBitsCount(const EncodingOutput& encodingResult, const Occurrences& occurrences, char firstChar = 'a')
+{
+    size_t encodedBitsCount{0};
+
+    for (size_t charIndex{0}; charIndex < occurrences.size(); ++charIndex)
+    {
+        encodedBitsCount += occurrences[charIndex] * encodingResult.at(static_cast<char>(firstChar + charIndex)).size();
+    }
+
+    return encodedBitsCount;
+}
+
+// each code is compared with the next one in lexicographical order (if prefix-free, none is a prefix of its successor)
+static bool isPrefixFree(const EncodingOutput& encodingResult)
+{
+    std::vector<std::string> codes;
+
+    for (const auto& [character, code] : encodingResult)
+    {
+        codes.push_back(code);
+    }
+
+    std::sort(codes.begin(), codes.end());
+
+    bool isPrefixFree{true};
+
+    for (size_t codeIndex{1}; isPrefixFree && codeIndex < codes.size(); ++codeIndex)
+    {
+        isPrefixFree = codes[codeIndex].compare(0, codes[codeIndex - 1].size(), codes[codeIndex - 1]) != 0;
+    }
+
+    return isPrefixFree;
+}
+
+// Kraft sum (sum of 2 ^ -codeLength) multiplied by 2 ^ maxCodeLength, so it is equal to 1 if the result is 2 ^ maxCodeLength
+static uint64_t getScaledKraftSum(const EncodingOutput& encodingResult, size_t maxCodeLength)
+{
+    uint64_t scaledKraftSum{0};
+
+    for (const auto& [character, code] : encodingResult)
+    {
+        scaledKraftSum += uint64_t{1} << (maxCodeLength - code.size());
+    }
+
+    return scaledKraftSum;
+}
+
+// characters sorted by code length (then by character) get consecutive codes, shifted left when the length increases
+static bool isCanonical(const EncodingOutput& encodingResult)
+{
+    std::vector<std::pair<std::string, char>> codes;
+
+    for (const auto& [character, code] : encodingResult)
+    {
+        codes.emplace_back(code, character);
+    }
+
+    std::stable_sort(codes.begin(), codes.end(), [](const auto& first, const auto& second) {return first.first.size() < second.first.size();});
+
+    bool isCanonical{true};
+    uint64_t expectedCode{0};
+
+    for (size_t codeIndex{0}; isCanonical && codeIndex < codes.size(); ++codeIndex)
+    {
+        const std::string& c_Code{codes[codeIndex].first};
+
+        if (codeIndex > 0)
+        {
+            expectedCode = (expectedCode + 1) << (c_Code.size() - codes[codeIndex - 1].first.size());
+        }
+
+        isCanonical = c_Code.size() < 64 && std::stoull(c_Code, nullptr, 2) == expectedCode;
+    }
+
+    return isCanonical;
+}
+
+// the optimal lengths decrease as occurrences increase, so only sorted length sequences are tried (small inputs only)
+static size_t getMinEncodedBitsCountByExhaustiveSearch(Occurrences occurrences, size_t maxCodeLength)
+{
+    std::sort(occurrences.begin(), occurrences.end(), std::greater<size_t>{});
+
+    size_t minEncodedBitsCount{std::numeric_limits<size_t>::max()};
+    std::vector<size_t> codeLengths(occurrences.size(), 1);
+
+    for (;;)
+    {
+        uint64_t scaledKraftSum{0};
+        size_t encodedBitsCount{0};
+
+        for (size_t charIndex{0}; charIndex < occurrences.size(); ++charIndex)
+        {
+            scaledKraftSum += uint64_t{1} << (maxCodeLength - codeLengths[charIndex]);
+            encodedBitsCount += occurrences[charIndex] * codeLengths[charIndex];
+        }
+
+        if (scaledKraftSum <= uint64_t{1} << maxCodeLength)
+        {
+            minEncodedBitsCount = std::min(minEncodedBitsCount, encodedBitsCount);
+        }
+
+        // next non-decreasing length sequence
+        size_t position{codeLengths.size()};
+
+        while (position > 0 && maxCodeLength == codeLengths[position - 1])
+        {
+            --position;
+        }
+
+        if (0 == position)
+        {
+            break;
+        }
+
+        const size_t c_CodeLength{codeLengths[position - 1] + 1};
+        std::fill(codeLengths.begin() + static_cast<std::ptrdiff_t>(position) - 1, codeLengths.end(), c_CodeLength);
+    }
+
+    return minEncodedBitsCount;
+}
+
+static void appendInteger(CompressedData& data, uint64_t value, size_t bytesCount)
+{
+    for (size_t byteIndex{0}; byteIndex < bytesCount; ++byteIndex)
+    {
+        data.push_back(static_cast<uint8_t>(value >> (8 * byteIndex)));
+    }
+}
+
+static void appendBits(CompressedData& data, const std::string& code, size_t& bitsCount)
+{
+    for (const char c_Digit : code)
+    {
+        if (0 == bitsCount % 8)
+        {
+            data.push_back(0);
+        }
+
+        data.back() |= static_cast<uint8_t>(('1' == c_Digit ? 1u : 0u) << (bitsCount % 8));
+        ++bitsCount;
+    }
+}
+
+/* Container written independently from the compressor (shared code table mode, see HuffmanBlockCompressor) so any code
+   table can be used for encoding, including one with codes exceeding the compressor maximum code length (decoded by
+   using a tree instead of a lookup table).
+*/
+static CompressedData createContainer(const std::string& input, const EncodingOutput& codeTable, size_t blockSize)
+{
+    const size_t c_BlocksCount{(input.size() + blockSize - 1) / blockSize};
+    CompressedData compressedData{'H', 'U', 'F', 'B', 1, static_cast<uint8_t>(HuffmanBlockCompressor::CodeTableMode::SHARED)};
+
+    appendInteger(compressedData, blockSize, 4);
+    appendInteger(compressedData, input.size(), 8);
+    appendInteger(compressedData, c_BlocksCount, 4);
+    appendInteger(compressedData, codeTable.size(), 2);
+
+    for (const auto& [character, code] : codeTable)
+    {
+        size_t bitsCount{0};
+
+        compressedData.push_back(static_cast<uint8_t>(character));
+        compressedData.push_back(static_cast<uint8_t>(code.size()));
+        appendBits(compressedData, code, bitsCount);
+    }
+
+    std::vector<CompressedData> encodedBlocks(c_BlocksCount);
+
+    for (size_t blockIndex{0}; blockIndex < c_BlocksCount; ++blockIndex)
+    {
+        CompressedData encodedBits;
+        size_t bitsCount{0};
+
+        for (const char c_Char : input.substr(blockIndex * blockSize, blockSize))
+        {
+            appendBits(encodedBits, codeTable.at(c_Char), bitsCount);
+        }
+
+        appendInteger(encodedBlocks[blockIndex], bitsCount, 8);
+        encodedBlocks[blockIndex].insert(encodedBlocks[blockIndex].end(), encodedBits.cbegin(), encodedBits.cend());
+    }
+
+    size_t blockOffset{0};
+
+    for (const CompressedData& c_EncodedBlock : encodedBlocks)
+    {
+        appendInteger(compressedData, blockOffset, 8);
+        appendInteger(compressedData, c_EncodedBlock.size(), 8);
+        blockOffset += c_EncodedBlock.size();
+    }
+
+    for (const CompressedData& c_EncodedBlock : encodedBlocks)
+    {
+        compressedData.insert(compressedData.end(), c_EncodedBlock.cbegin(), c_EncodedBlock.cend());
+    }
+
+    return compressedData;
+}
+
+// the characters are interleaved, so each block contains a mix of them
+static std::string createInput(const Occurrences& occurrences, char firstChar = 'a')
+{
+    std::string input;
+    Occurrences remainingOccurrences{occurrences};
+
+    for (bool isCharAdded{true}; isCharAdded;)
+    {
+        isCharAdded = false;
+
+        for (size_t charIndex{0}; charIndex < remainingOccurrences.size(); ++charIndex)
+        {
+            if (remainingOccurrences[charIndex] > 0)
+            {
+                input.push_back(static_cast<char>(firstChar + charIndex));
+                --remainingOccurrences[charIndex];
+                isCharAdded = true;
+            }
+        }
+    }
+
+    return input;
+}
+
+void HuffmanEncoderTests::testLengthLimitedEncoding()
+{
+    QFETCH(Occurrences, occurrences);
+    QFETCH(size_t, maxCodeLength);
+    QFETCH(char, firstChar);
+
+    const EncodingInput c_EncodingInput{createEncodingInput(occurrences, firstChar)};
+    HuffmanEncoder unlimitedEncoder;
+    HuffmanEncoder limitedEncoder;
+
+    QVERIFY(unlimitedEncoder.encode(c_EncodingInput));
+    QVERIFY(limitedEncoder.encode(c_EncodingInput, maxCodeLength));
+
+    const EncodingOutput c_UnlimitedEncodingResult{unlimitedEncoder.getEncodingResult()};
+    const EncodingOutput c_EncodingResult{limitedEncoder.getEncodingResult()};
+    const size_t c_MaxResultingCodeLength{getMaxCodeLength(c_EncodingResult)};
+
+    QCOMPARE(c_EncodingResult.size(), occurrences.size());
+    QVERIFY(c_MaxResultingCodeLength <= maxCodeLength && c_MaxResultingCodeLength < 64);
+
+    for (size_t charIndex{0}; charIndex < occurrences.size(); ++charIndex)
+    {
+        const auto c_EncodingIt{c_EncodingResult.find(static_cast<char>(firstChar + charIndex))};
+
+        QVERIFY(c_EncodingIt != c_EncodingResult.cend());
+        QVERIFY(!c_EncodingIt->second.empty());
+        QVERIFY(c_EncodingIt->second.find_first_not_of("01") == std::string::npos);
+    }
+
+    QCOMPARE(getScaledKraftSum(c_EncodingResult, c_MaxResultingCodeLength), uint64_t{1} << c_MaxResultingCodeLength);
+    QVERIFY(isPrefixFree(c_EncodingResult));
+
+    // the unlimited encoding is kept if within the limit, otherwise the optimal canonical encoding within the limit is expected
+    if (getMaxCodeLength(c_UnlimitedEncodingResult) <= maxCodeLength)
+    {
+        QVERIFY(c_EncodingResult == c_UnlimitedEncodingResult);
+    }
+    else
+    {
+        QVERIFY(isCanonical(c_EncodingResult));
+
+        if (occurrences.size() <= 8)
+        {
+            QCOMPARE(getEncodedBitsCount(c_EncodingResult, occurrences, firstChar), getMinEncodedBitsCountByExhaustiveSearch(occurrences, maxCodeLength));
+        }
+    }
+}
+
+void HuffmanEncoderTests::testLengthLimitedRoundTrip()
+{
+    QFETCH(Occurrences, occurrences);
+    QFETCH(MaxCodeLength, maxCodeLength);
+    QFETCH(size_t, blockSize);
+    QFETCH(bool, isTreeDecoding);
+
+    const std::string c_Input{createInput(occurrences)};
+    HuffmanEncoder encoder;
+
+    QVERIFY(encoder.encode(createEncodingInput(occurrences), maxCodeLength));
+
+    const EncodingOutput c_CodeTable{encoder.getEncodingResult()};
+
+    // codes exceeding the maximum code length of the compressor cannot be decoded by table lookup
+    QCOMPARE(getMaxCodeLength(c_CodeTable) > HuffmanBlockCompressor::c_MaxCodeLength, isTreeDecoding);
+
+    const CompressedData c_CompressedData{createContainer(c_Input, c_CodeTable, blockSize)};
+    const size_t c_BlocksCount{(c_Input.size() + blockSize - 1) / blockSize};
+    std::string output;
+
+    QVERIFY(HuffmanBlockCompressor{}.decompress(c_CompressedData, output));
+    QCOMPARE(output, c_Input);
+    QVERIFY(HuffmanBlockCompressor::getBlocksCount(c_CompressedData) == c_BlocksCount);
+
+    for (size_t blockIndex{0}; blockIndex < c_BlocksCount; ++blockIndex)
+    {
+        QVERIFY(HuffmanBlockCompressor::decompressBlock(c_CompressedData, blockIndex, output));
+        QCOMPARE(output, c_Input.substr(blockIndex * blockSize, blockSize));
+    }
+}
+
+void HuffmanEncoderTests::testEncodingNotPerformed()
+{
+    QFETCH(Occurrences, occurrences);
+    QFETCH(MaxCodeLength, maxCodeLength);
+
+    HuffmanEncoder encoder;
+
+    QVERIFY(encoder.encode(createEncodingInput({1, 2, 3})));
+    QVERIFY(!encoder.encode(createEncodingInput(occurrences), maxCodeLength));
+    QVERIFY(encoder.getEncodingResult().empty());
+}
+
+void HuffmanEncoderTests::testLengthLimitedEncoding_data()
+{
+    QTest::addColumn<Occurrences>("occurrences");
+    QTest::addColumn<size_t>("maxCodeLength");
+    QTest::addColumn<char>("firstChar");
+
+    QTest::newRow("two symbols, limit 1") << Occurrences{3, 5} << size_t{1} << 'a';
+    QTest::newRow("two symbols, limit 8") << Occurrences{3, 5} << size_t{8} << 'a';
+    QTest::newRow("three symbols, minimum limit") << Occurrences{1, 2, 3} << size_t{2} << 'a';
+    QTest::newRow("four equal occurrences, minimum limit") << Occurrences{7, 7, 7, 7} << size_t{2} << 'a';
+    QTest::newRow("five symbols, minimum limit") << Occurrences{5, 1, 3, 1, 2} << size_t{3} << 'a';
+    QTest::newRow("eight symbols, minimum limit") << Occurrences{1, 2, 4, 8, 16, 32, 64, 128} << size_t{3} << 'a';
+    QTest::newRow("eight symbols, limit 4") << Occurrences{1, 2, 4, 8, 16, 32, 64, 128} << size_t{4} << 'a';
+    QTest::newRow("eight symbols, limit 5") << Occurrences{1, 2, 4, 8, 16, 32, 64, 128} << size_t{5} << 'a';
+    QTest::newRow("eight symbols, limit 6") << Occurrences{1, 2, 4, 8, 16, 32, 64, 128} << size_t{6} << 'a';
+    QTest::newRow("eight symbols, limit not exceeded") << Occurrences{1, 2, 4, 8, 16, 32, 64, 128} << size_t{7} << 'a';
+    QTest::newRow("eight equal occurrences, limit 4") << Occurrences(8, 10) << size_t{4} << 'a';
+    QTest::newRow("eight symbols, negative chars") << Occurrences{9, 1, 7, 3, 3, 12, 2, 5} << size_t{4} << static_cast<char>(-4);
+    QTest::newRow("fibonacci 20, minimum limit") << getFibonacciOccurrences(20) << size_t{5} << 'a';
+    QTest::newRow("fibonacci 20, limit 8") << getFibonacciOccurrences(20) << size_t{8} << 'a';
+    QTest::newRow("fibonacci 20, limit 12") << getFibonacciOccurrences(20) << size_t{12} << 'a';
+    QTest::newRow("fibonacci 20, limit 18") << getFibonacciOccurrences(20) << size_t{18} << 'a';
+    QTest::newRow("fibonacci 20, limit not exceeded") << getFibonacciOccurrences(20) << size_t{19} << 'a';
+    QTest::newRow("fibonacci 20, limit exceeding size_t bits") << getFibonacciOccurrences(20) << size_t{100} << 'a';
+    QTest::newRow("large occurrences, limit 4") << Occurrences{2147483647, 2147483646, 1, 2147483647, 5, 2147483647, 3, 1000000} << size_t{4} << 'a';
+    QTest::newRow("all chars, minimum limit") << getIncreasingOccurrences(256) << size_t{8} << static_cast<char>(-128);
+    QTest::newRow("all chars, limit 12") << getIncreasingOccurrences(256) << size_t{12} << static_cast<char>(-128);
+}
+
+void HuffmanEncoderTests::testLengthLimitedRoundTrip_data()
+{
+    QTest::addColumn<Occurrences>("occurrences");
+    QTest::addColumn<MaxCodeLength>("maxCodeLength");
+    QTest::addColumn<size_t>("blockSize");
+    QTest::addColumn<bool>("isTreeDecoding");
+
+    QTest::newRow("two symbols, limit 1") << Occurrences{300, 500} << MaxCodeLength{1} << size_t{128} << false;
+    QTest::newRow("fibonacci 20, minimum limit") << getFibonacciOccurrences(20) << MaxCodeLength{5} << size_t{4096} << false;
+    QTest::newRow("fibonacci 20, limit 8") << getFibonacciOccurrences(20) << MaxCodeLength{8} << size_t{4096} << false;
+    QTest::newRow("fibonacci 20, compressor limit") << getFibonacciOccurrences(20) << MaxCodeLength{HuffmanBlockCompressor::c_MaxCodeLength} << size_t{4096} << false;
+    QTest::newRow("fibonacci 20, limit 16") << getFibonacciOccurrences(20) << MaxCodeLength{16} << size_t{4096} << true;
+    QTest::newRow("fibonacci 20, no limit") << getFibonacciOccurrences(20) << MaxCodeLength{} << size_t{4096} << true;
+    QTest::newRow("fibonacci 20, no limit, single block") << getFibonacciOccurrences(20) << MaxCodeLength{} << size_t{100000} << true;
+    QTest::newRow("fibonacci 20, no limit, single char blocks") << getFibonacciOccurrences(20) << MaxCodeLength{} << size_t{1} << true;
+}
+
+void HuffmanEncoderTests::testEncodingNotPerformed_data()
+{
+    QTest::addColumn<Occurrences>("occurrences");
+    QTest::addColumn<MaxCodeLength>("maxCodeLength");
+
+    QTest::newRow("one symbol, no limit") << Occurrences{5} << MaxCodeLength{};
+    QTest::newRow("one symbol, limit 4") << Occurrences{5} << MaxCodeLength{4};
+    QTest::newRow("two symbols, limit 0") << Occurrences{3, 5} << MaxCodeLength{0};
+    QTest::newRow("three symbols, limit 1") << Occurrences{1, 2, 3} << MaxCodeLength{1};
+    QTest::newRow("five symbols, limit 2") << Occurrences{5, 1, 3, 1, 2} << MaxCodeLength{2};
+    QTest::newRow("nine symbols, limit 3") << Occurrences(9, 1) << MaxCodeLength{3};
+    QTest::newRow("fibonacci 20, limit 4") << getFibonacciOccurrences(20) << MaxCodeLength{4};
+    QTest::newRow("all chars, limit 7") << Occurrences(256, 1) << MaxCodeLength{7};
+}
+
+QTEST_APPLESS_MAIN(HuffmanEncoderTests)
+
+#include "tst_huffmanencodertests.moc"
+// clang-format on
@@ -0,0 +1,922 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <new>
+
+#include "huffmanblockcompressor.h"
+#include "instrumentation.h"
+
+using CharOccurrences = std::array<size_t, 256>;
+
+static constexpr uint8_t c_ContainerSignature[]{'H', 'U', 'F', 'B'};
+static constexpr uint8_t c_ContainerVersion{1};
+static constexpr size_t c_HeaderSize{sizeof(c_ContainerSignature) + 1 + 1 + 4 + 8 + 4};
+static constexpr size_t c_BlockIndexEntrySize{16};
+static constexpr size_t c_MaxSymbolsCount{256};
+static constexpr size_t c_MaxStoredCodeLength{std::numeric_limits<uint8_t>::max()};
+
+// the bit writer keeps at most 7 pending bits, so up to 57 bits can be added to them within a 64 bit integer
+static constexpr size_t c_MaxPackedBitsCount{57};
+
+// the occurrences are stored as int by the encoder
+static constexpr size_t c_MaxEncoderOccurrence{static_cast<size_t>(std::numeric_limits<int>::max())};
+
+// appends bits to a byte buffer (LSB first)
+class BitWriter
+{
+public:
+    explicit BitWriter(CompressedData& data)
+        : m_Data{data}
+        , m_PendingBits{0}
+        , m_PendingBitsCount{0}
+        , m_BitsCount{0}
+    {
+    }
+
+    void write(uint64_t bits, size_t bitsCount)
+    {
+        assert(bitsCount <= c_MaxPackedBitsCount);
+
+        m_PendingBits |= bits << m_PendingBitsCount;
+        m_PendingBitsCount += bitsCount;
+        m_BitsCount += bitsCount;
+
+        while (m_PendingBitsCount >= 8)
+        {
+            m_Data.push_back(static_cast<uint8_t>(m_PendingBits));
+            m_PendingBits >>= 8;
+            m_PendingBitsCount -= 8;
+        }
+    }
+
+    // codes of any length ('0' / '1' chars)
+    void write(const std::string& code)
+    {
+        for (size_t chunkBegin{0}; chunkBegin < code.size(); chunkBegin += c_MaxPackedBitsCount)
+        {
+            const size_t c_ChunkEnd{std::min(chunkBegin + c_MaxPackedBitsCount, code.size())};
+            uint64_t bits{0};
+
+            for (size_t bitIndex{chunkBegin}; bitIndex < c_ChunkEnd; ++bitIndex)
+            {
+                bits |= static_cast<uint64_t>(code[bitIndex] == '1') << (bitIndex - chunkBegin);
+            }
+
+            write(bits, c_ChunkEnd - chunkBegin);
+        }
+    }
+
+    // the last byte is padded with 0 bits
+    void flush()
+    {
+        if (m_PendingBitsCount > 0)
+        {
+            m_Data.push_back(static_cast<uint8_t>(m_PendingBits));
+            m_PendingBits = 0;
+            m_PendingBitsCount = 0;
+        }
+    }
+
+    size_t getBitsCount() const
+    {
+        return m_BitsCount;
+    }
+
+private:
+    CompressedData& m_Data;
+    uint64_t m_PendingBits;
+    size_t m_PendingBitsCount;
+    size_t m_BitsCount;
+};
+
+// code of each symbol (byte value) prepared for writing: short codes are packed into an integer
+struct SymbolCode
+{
+    const std::string* m_pCode{nullptr};
+    uint64_t m_PackedBits{0};
+};
+
+using SymbolCodes = std::array<SymbolCode, c_MaxSymbolsCount>;
+
+/* Binary tree built from the code table for decoding:
+   - each node has the indexes of its children (0: no child, as the root is never a child) and the decoded symbol (leaf
+   nodes only)
+   - building fails if the codes are not prefix-free
+*/
+struct DecodingTree
+{
+    static constexpr int c_NoSymbol{-1};
+
+    bool build(const EncodingOutput& codeTable)
+    {
+        bool success{true};
+
+        m_Children.assign(1, {0, 0});
+        m_Symbols.assign(1, c_NoSymbol);
+
+        for (const auto& [character, code] : codeTable)
+        {
+            uint32_t nodeIndex{0};
+
+            for (const char c_Digit : code)
+            {
+                const size_t c_Bit{c_Digit == '1' ? 1u : 0u};
+
+                if (m_Symbols[nodeIndex] != c_NoSymbol)
+                {
+                    success = false;
+                    break;
+                }
+
+                if (0 == m_Children[nodeIndex][c_Bit])
+                {
+                    m_Children[nodeIndex][c_Bit] = static_cast<uint32_t>(m_Children.size());
+                    m_Children.push_back({0, 0});
+                    m_Symbols.push_back(c_NoSymbol);
+                }
+
+                nodeIndex = m_Children[nodeIndex][c_Bit];
+            }
+
+            // the node of a symbol should be a new leaf
+            if (!success || m_Symbols[nodeIndex] != c_NoSymbol || m_Children[nodeIndex][0] != 0 ||
+                m_Children[nodeIndex][1] != 0)
+            {
+                success = false;
+                break;
+            }
+
+            m_Symbols[nodeIndex] = static_cast<uint8_t>(character);
+        }
+
+        return success;
+    }
+
+    std::vector<std::array<uint32_t, 2>> m_Children;
+    std::vector<int> m_Symbols;
+};
+
+/* Table for decoding a symbol by a single lookup (codes not exceeding the lookup bits count):
+   - the index is given by the next lookup bits (LSB first), so each code fills all entries starting with its bits
+   - building fails if the codes are not prefix-free (entry filled by multiple codes)
+*/
+struct DecodingTable
+{
+    struct Entry
+    {
+        uint8_t m_Symbol{0};
+        uint8_t m_CodeLength{0}; // 0: no code matches the bits
+    };
+
+    static constexpr size_t c_LookupBitsCount{HuffmanBlockCompressor::c_MaxCodeLength};
+
+    bool build(const EncodingOutput& codeTable)
+    {
+        bool success{true};
+
+        m_Entries.assign(size_t{1} << c_LookupBitsCount, Entry{});
+
+        for (const auto& [character, code] : codeTable)
+        {
+            assert(!code.empty() && code.size() <= c_LookupBitsCount);
+
+            size_t codeBits{0};
+
+            for (size_t bitIndex{0}; bitIndex < code.size(); ++bitIndex)
+            {
+                codeBits |= static_cast<size_t>(code[bitIndex] == '1') << bitIndex;
+            }
+
+            for (size_t entryIndex{codeBits}; entryIndex < m_Entries.size(); entryIndex += size_t{1} << code.size())
+            {
+                if (m_Entries[entryIndex].m_CodeLength > 0)
+                {
+                    success = false;
+                    break;
+                }
+
+                m_Entries[entryIndex] = {static_cast<uint8_t>(character), static_cast<uint8_t>(code.size())};
+            }
+
+            if (!success)
+            {
+                break;
+            }
+        }
+
+        return success;
+    }
+
+    std::vector<Entry> m_Entries;
+};
+
+static void appendInteger(CompressedData& data, uint64_t value, size_t bytesCount)
+{
+    for (size_t byteIndex{0}; byteIndex < bytesCount; ++byteIndex)
+    {
+        data.push_back(static_cast<uint8_t>(value >> (8 * byteIndex)));
+    }
+}
+
+static bool readInteger(const CompressedData& data, size_t& position, size_t bytesCount, uint64_t& value)
+{
+    const bool c_CanRead{position <= data.size() && bytesCount <= data.size() - position};
+
+    if (c_CanRead)
+    {
+        value = 0;
+
+        for (size_t byteIndex{0}; byteIndex < bytesCount; ++byteIndex)
+        {
+            value |= static_cast<uint64_t>(data[position + byteIndex]) << (8 * byteIndex);
+        }
+
+        position += bytesCount;
+    }
+
+    return c_CanRead;
+}
+
+static CharOccurrences countChars(std::string_view chars)
+{
+    CharOccurrences occurrences{};
+
+    for (const char c_Char : chars)
+    {
+        ++occurrences[static_cast<uint8_t>(c_Char)];
+    }
+
+    return occurrences;
+}
+
+// a single character gets an empty code (no bits required for encoding it)
+static bool buildCodeTable(const CharOccurrences& occurrences, EncodingOutput& codeTable)
+{
+    bool success{false};
+    EncodingOutput resultingCodeTable;
+
+    const size_t c_CharsCount{static_cast<size_t>(
+        std::count_if(occurrences.cbegin(), occurrences.cend(), [](size_t occurrence) { return occurrence > 0; }))};
+    const size_t c_MaxOccurrence{*std::max_element(occurrences.cbegin(), occurrences.cend())};
+
+    if (1 == c_CharsCount)
+    {
+        resultingCodeTable[static_cast<char>(std::distance(
+            occurrences.cbegin(), std::find_if(occurrences.cbegin(), occurrences.cend(),
+                                               [](size_t occurrence) { return occurrence > 0; })))] = "";
+        success = true;
+    }
+    else if (c_CharsCount > 1)
+    {
+        // very large occurrences (e.g. shared table of a huge input) are scaled down to fit the encoder (non-zero ones
+        // remain non-zero so each character still gets a code)
+        const size_t c_ScalingFactor{(c_MaxOccurrence + c_MaxEncoderOccurrence - 1) / c_MaxEncoderOccurrence};
+
+        EncodingInput encodingInput{static_cast<matrix_size_t>(c_CharsCount), 2, ""};
+        matrix_size_t rowNr{0};
+
+        for (size_t symbol{0}; symbol < occurrences.size(); ++symbol)
+        {
+            if (occurrences[symbol] > 0)
+            {
+                encodingInput.at(rowNr, 0) = std::string(1, static_cast<char>(symbol));
+                encodingInput.at(rowNr, 1) = std::to_string(std::max<size_t>(occurrences[symbol] / c_ScalingFactor, 1));
+                ++rowNr;
+            }
+        }
+
+        HuffmanEncoder encoder;
+        success = encoder.encode(encodingInput, HuffmanBlockCompressor::c_MaxCodeLength);
+
+        if (success)
+        {
+            resultingCodeTable = encoder.getEncodingResult();
+        }
+    }
+
+    if (success)
+    {
+        codeTable = std::move(resultingCodeTable);
+    }
+
+    return success;
+}
+
+static void writeCodeTable(const EncodingOutput& codeTable, CompressedData& data)
+{
+    appendInteger(data, codeTable.size(), 2);
+
+    for (const auto& [character, code] : codeTable)
+    {
+        assert(code.size() <= c_MaxStoredCodeLength);
+
+        BitWriter bitWriter{data};
+
+        data.push_back(static_cast<uint8_t>(character));
+        data.push_back(static_cast<uint8_t>(code.size()));
+        bitWriter.write(code);
+        bitWriter.flush();
+    }
+}
+
+static bool readCodeTable(const CompressedData& data, size_t& position, EncodingOutput& codeTable)
+{
+    EncodingOutput resultingCodeTable;
+    uint64_t symbolsCount{0};
+    bool success{readInteger(data, position, 2, symbolsCount) && symbolsCount > 0 &&
+                 symbolsCount <= c_MaxSymbolsCount};
+
+    for (uint64_t symbolIndex{0}; success && symbolIndex < symbolsCount; ++symbolIndex)
+    {
+        uint64_t symbol{0};
+        uint64_t codeLength{0};
+
+        success = readInteger(data, position, 1, symbol) && readInteger(data, position, 1, codeLength);
+
+        // only a single symbol has an empty code
+        if (!success || (0 == codeLength) != (1 == symbolsCount) ||
+            resultingCodeTable.find(static_cast<char>(symbol)) != resultingCodeTable.cend() ||
+            (codeLength + 7) / 8 > data.size() - position)
+        {
+            success = false;
+            break;
+        }
+
+        std::string code(codeLength, '0');
+
+        for (size_t bitIndex{0}; bitIndex < codeLength; ++bitIndex)
+        {
+            if ((data[position + bitIndex / 8] >> (bitIndex % 8)) & 1u)
+            {
+                code[bitIndex] = '1';
+            }
+        }
+
+        resultingCodeTable[static_cast<char>(symbol)] = std::move(code);
+        position += (codeLength + 7) / 8;
+    }
+
+    if (success)
+    {
+        codeTable = std::move(resultingCodeTable);
+    }
+
+    return success;
+}
+
+static SymbolCodes getSymbolCodes(const EncodingOutput& codeTable)
+{
+    SymbolCodes symbolCodes;
+
+    for (const auto& [character, code] : codeTable)
+    {
+        SymbolCode& symbolCode{symbolCodes[static_cast<uint8_t>(character)]};
+        symbolCode.m_pCode = &code;
+
+        for (size_t bitIndex{0}; bitIndex < code.size() && bitIndex < c_MaxPackedBitsCount; ++bitIndex)
+        {
+            symbolCode.m_PackedBits |= static_cast<uint64_t>(code[bitIndex] == '1') << bitIndex;
+        }
+    }
+
+    return symbolCodes;
+}
+
+// the shared code table is used if provided, otherwise a code table is built for the block and stored before its bits
+static bool encodeBlock(std::string_view block, const EncodingOutput* pSharedCodeTable, CompressedData& encodedBlock)
+{
+    INSTRUMENT_SCOPE("HuffmanBlockCompressor::encodeBlock");
+
+    EncodingOutput blockCodeTable;
+    bool success{true};
+
+    encodedBlock.clear();
+    encodedBlock.reserve(block.size() / 2);
+
+    if (!pSharedCodeTable)
+    {
+        success = buildCodeTable(countChars(block), blockCodeTable);
+
+        if (success)
+        {
+            writeCodeTable(blockCodeTable, encodedBlock);
+        }
+    }
+
+    if (success)
+    {
+        const SymbolCodes c_SymbolCodes{getSymbolCodes(pSharedCodeTable ? *pSharedCodeTable : blockCodeTable)};
+        const size_t c_BitsCountPosition{encodedBlock.size()};
+
+        appendInteger(encodedBlock, 0, 8); // placeholder, bits count known after encoding
+
+        BitWriter bitWriter{encodedBlock};
+
+        for (const char c_Char : block)
+        {
+            const SymbolCode& c_SymbolCode{c_SymbolCodes[static_cast<uint8_t>(c_Char)]};
+
+            if (!c_SymbolCode.m_pCode)
+            {
+                success = false;
+                break;
+            }
+
+            if (c_SymbolCode.m_pCode->size() <= c_MaxPackedBitsCount)
+            {
+                bitWriter.write(c_SymbolCode.m_PackedBits, c_SymbolCode.m_pCode->size());
+            }
+            else
+            {
+                bitWriter.write(*c_SymbolCode.m_pCode);
+            }
+        }
+
+        bitWriter.flush();
+
+        for (size_t byteIndex{0}; byteIndex < 8; ++byteIndex)
+        {
+            encodedBlock[c_BitsCountPosition + byteIndex] =
+                static_cast<uint8_t>(bitWriter.getBitsCount() >> (8 * byteIndex));
+        }
+    }
+
+    return success;
+}
+
+// exactly charsCount symbols should be decoded from the encoded bits (false returned otherwise)
+static bool decodeUsingTable(const EncodingOutput& codeTable, const uint8_t* encodedBits, uint64_t bitsCount,
+                             size_t charsCount, char* output)
+{
+    DecodingTable decodingTable;
+    bool success{decodingTable.build(codeTable)};
+
+    if (success)
+    {
+        static constexpr size_t c_LookupMask{(size_t{1} << DecodingTable::c_LookupBitsCount) - 1};
+
+        const size_t c_EncodedBytesCount{static_cast<size_t>((bitsCount + 7) / 8)};
+        size_t nextByteIndex{0};
+        uint64_t bitBuffer{0};
+        size_t bufferedBitsCount{0};
+        uint64_t remainingBitsCount{bitsCount};
+
+        for (size_t charIndex{0}; charIndex < charsCount; ++charIndex)
+        {
+            // the buffer is refilled byte by byte, the bits following the last encoded byte are 0 (never matched as
+            // they exceed the remaining bits count)
+            while (bufferedBitsCount <= 56 && nextByteIndex < c_EncodedBytesCount)
+            {
+                bitBuffer |= static_cast<uint64_t>(encodedBits[nextByteIndex++]) << bufferedBitsCount;
+                bufferedBitsCount += 8;
+            }
+
+            const DecodingTable::Entry& c_Entry{decodingTable.m_Entries[bitBuffer & c_LookupMask]};
+
+            if (0 == c_Entry.m_CodeLength || c_Entry.m_CodeLength > remainingBitsCount)
+            {
+                success = false;
+                break;
+            }
+
+            output[charIndex] = static_cast<char>(c_Entry.m_Symbol);
+            bitBuffer >>= c_Entry.m_CodeLength;
+            bufferedBitsCount -= c_Entry.m_CodeLength;
+            remainingBitsCount -= c_Entry.m_CodeLength;
+        }
+
+        success = success && 0 == remainingBitsCount;
+    }
+
+    return success;
+}
+
+// slower (bit by bit) decoding for codes exceeding the lookup table bits count
+static bool decodeUsingTree(const EncodingOutput& codeTable, const uint8_t* encodedBits, uint64_t bitsCount,
+                            size_t charsCount, char* output)
+{
+    DecodingTree decodingTree;
+    bool success{decodingTree.build(codeTable)};
+
+    if (success)
+    {
+        size_t decodedCharsCount{0};
+        uint32_t nodeIndex{0};
+
+        for (uint64_t bitIndex{0}; bitIndex < bitsCount; ++bitIndex)
+        {
+            nodeIndex = decodingTree.m_Children[nodeIndex][(encodedBits[bitIndex / 8] >> (bitIndex % 8)) & 1u];
+
+            // either no code matches the bits or there are more chars than expected
+            if (0 == nodeIndex || decodedCharsCount == charsCount)
+            {
+                success = false;
+                break;
+            }
+
+            if (decodingTree.m_Symbols[nodeIndex] != DecodingTree::c_NoSymbol)
+            {
+                output[decodedCharsCount++] = static_cast<char>(decodingTree.m_Symbols[nodeIndex]);
+                nodeIndex = 0;
+            }
+        }
+
+        // the last code should be complete
+        success = success && 0 == nodeIndex && decodedCharsCount == charsCount;
+    }
+
+    return success;
+}
+
+HuffmanBlockCompressor::HuffmanBlockCompressor(size_t blockSize, CodeTableMode codeTableMode, size_t threadsCount)
+    : m_BlockSize{std::clamp<size_t>(blockSize, 1, std::numeric_limits<uint32_t>::max())}
+    , m_CodeTableMode{codeTableMode}
+    , m_ThreadsCount{std::max<size_t>(threadsCount, 1)}
+{
+}
+
+bool HuffmanBlockCompressor::compress(std::string_view input, CompressedData& compressedData) const
+{
+    INSTRUMENT_SCOPE("HuffmanBlockCompressor::compress");
+
+    const size_t c_BlocksCount{(input.size() + m_BlockSize - 1) / m_BlockSize};
+    const bool c_IsSharedCodeTable{CodeTableMode::SHARED == m_CodeTableMode};
+
+    EncodingOutput sharedCodeTable;
+    std::vector<CompressedData> encodedBlocks(c_BlocksCount);
+    bool success{c_BlocksCount <= std::numeric_limits<uint32_t>::max()};
+
+    auto getBlock{[this, &input](size_t blockIndex) { return input.substr(blockIndex * m_BlockSize, m_BlockSize); }};
+
+    if (success && c_IsSharedCodeTable && c_BlocksCount > 0)
+    {
+        std::vector<CharOccurrences> blockOccurrences(c_BlocksCount);
+
+        _runInParallel(c_BlocksCount, m_ThreadsCount, [&blockOccurrences, &getBlock](size_t blockIndex) {
+            blockOccurrences[blockIndex] = countChars(getBlock(blockIndex));
+            return true;
+        });
+
+        CharOccurrences occurrences{};
+
+        for (const CharOccurrences& c_BlockOccurrences : blockOccurrences)
+        {
+            std::transform(occurrences.cbegin(), occurrences.cend(), c_BlockOccurrences.cbegin(), occurrences.begin(),
+                           std::plus<size_t>{});
+        }
+
+        success = buildCodeTable(occurrences, sharedCodeTable);
+    }
+
+    const EncodingOutput* const c_pSharedCodeTable{c_IsSharedCodeTable ? &sharedCodeTable : nullptr};
+
+    success = success && _runInParallel(c_BlocksCount, m_ThreadsCount,
+                                        [&encodedBlocks, &getBlock, c_pSharedCodeTable](size_t blockIndex) {
+                                            return encodeBlock(getBlock(blockIndex), c_pSharedCodeTable,
+                                                               encodedBlocks[blockIndex]);
+                                        });
+
+    if (success)
+    {
+        CompressedData result{std::cbegin(c_ContainerSignature), std::cend(c_ContainerSignature)};
+
+        result.push_back(c_ContainerVersion);
+        result.push_back(static_cast<uint8_t>(m_CodeTableMode));
+        appendInteger(result, m_BlockSize, 4);
+        appendInteger(result, input.size(), 8);
+        appendInteger(result, c_BlocksCount, 4);
+
+        if (c_IsSharedCodeTable && c_BlocksCount > 0)
+        {
+            writeCodeTable(sharedCodeTable, result);
+        }
+
+        size_t blockOffset{0};
+
+        for (const CompressedData& c_EncodedBlock : encodedBlocks)
+        {
+            appendInteger(result, blockOffset, 8);
+            appendInteger(result, c_EncodedBlock.size(), 8);
+            blockOffset += c_EncodedBlock.size();
+        }
+
+        result.reserve(result.size() + blockOffset);
+
+        for (const CompressedData& c_EncodedBlock : encodedBlocks)
+        {
+            result.insert(result.end(), c_EncodedBlock.cbegin(), c_EncodedBlock.cend());
+        }
+
+        compressedData = std::move(result);
+    }
+
+    return success;
+}
+
+bool HuffmanBlockCompressor::decompress(const CompressedData& compressedData, std::string& output) const
+{
+    INSTRUMENT_SCOPE("HuffmanBlockCompressor::decompress");
+
+    ContainerLayout containerLayout;
+    std::string result;
+
+    // the output size is taken from the header, so it should be checked against all encoded blocks before allocating
+    bool success{_readContainerLayout(compressedData, containerLayout) &&
+                 _runInParallel(containerLayout.m_Blocks.size(), m_ThreadsCount,
+                                [&compressedData, &containerLayout](size_t blockIndex) {
+                                    BlockEncoding blockEncoding;
+                                    return _readBlockEncoding(compressedData, containerLayout, blockIndex,
+                                                              blockEncoding);
+                                })};
+
+    if (success)
+    {
+        try
+        {
+            result.resize(containerLayout.m_InputSize);
+        }
+        catch (std::bad_alloc&)
+        {
+            success = false;
+        }
+    }
+
+    if (success)
+    {
+        success = _runInParallel(containerLayout.m_Blocks.size(), m_ThreadsCount,
+                                 [&compressedData, &containerLayout, &result](size_t blockIndex) {
+                                     return _decodeBlock(compressedData, containerLayout, blockIndex,
+                                                         result.data() + blockIndex * containerLayout.m_BlockSize);
+                                 });
+    }
+
+    if (success)
+    {
+        output = std::move(result);
+    }
+
+    return success;
+}
+
+std::optional<size_t> HuffmanBlockCompressor::getBlocksCount(const CompressedData& compressedData)
+{
+    std::optional<size_t> blocksCount;
+    ContainerLayout containerLayout;
+
+    if (_readContainerLayout(compressedData, containerLayout))
+    {
+        blocksCount = containerLayout.m_Blocks.size();
+    }
+
+    return blocksCount;
+}
+
+bool HuffmanBlockCompressor::decompressBlock(const CompressedData& compressedData, size_t blockIndex,
+                                             std::string& output)
+{
+    INSTRUMENT_SCOPE("HuffmanBlockCompressor::decompressBlock");
+
+    ContainerLayout containerLayout;
+    BlockEncoding blockEncoding;
+    std::string result;
+
+    bool success{_readContainerLayout(compressedData, containerLayout) &&
+                 blockIndex < containerLayout.m_Blocks.size() &&
+                 _readBlockEncoding(compressedData, containerLayout, blockIndex, blockEncoding)};
+
+    if (success)
+    {
+        try
+        {
+            result.resize(_getBlockCharsCount(containerLayout, blockIndex));
+        }
+        catch (std::bad_alloc&)
+        {
+            success = false;
+        }
+    }
+
+    if (success)
+    {
+        success = _decodeBlock(compressedData, containerLayout, blockIndex, result.data());
+    }
+
+    if (success)
+    {
+        output = std::move(result);
+    }
+
+    return success;
+}
+
+bool HuffmanBlockCompressor::_readContainerLayout(const CompressedData& compressedData,
+                                                  ContainerLayout& containerLayout)
+{
+    bool success{false};
+
+    do
+    {
+        if (compressedData.size() < c_HeaderSize ||
+            !std::equal(std::cbegin(c_ContainerSignature), std::cend(c_ContainerSignature), compressedData.cbegin()))
+        {
+            break;
+        }
+
+        size_t position{sizeof(c_ContainerSignature)};
+        uint64_t version{0};
+        uint64_t codeTableMode{0};
+        uint64_t blockSize{0};
+        uint64_t inputSize{0};
+        uint64_t blocksCount{0};
+
+        readInteger(compressedData, position, 1, version);
+        readInteger(compressedData, position, 1, codeTableMode);
+        readInteger(compressedData, position, 4, blockSize);
+        readInteger(compressedData, position, 8, inputSize);
+        readInteger(compressedData, position, 4, blocksCount);
+
+        if (version != c_ContainerVersion || codeTableMode > static_cast<uint8_t>(CodeTableMode::PER_BLOCK) ||
+            0 == blockSize || blocksCount != (inputSize + blockSize - 1) / blockSize)
+        {
+            break;
+        }
+
+        containerLayout.m_CodeTableMode = static_cast<CodeTableMode>(codeTableMode);
+        containerLayout.m_BlockSize = blockSize;
+        containerLayout.m_InputSize = inputSize;
+        containerLayout.m_SharedCodeTable.clear();
+        containerLayout.m_Blocks.clear();
+
+        if (CodeTableMode::SHARED == containerLayout.m_CodeTableMode && blocksCount > 0 &&
+            !readCodeTable(compressedData, position, containerLayout.m_SharedCodeTable))
+        {
+            break;
+        }
+
+        if (blocksCount > (compressedData.size() - position) / c_BlockIndexEntrySize)
+        {
+            break;
+        }
+
+        const size_t c_BlocksBegin{position + blocksCount * c_BlockIndexEntrySize};
+        const size_t c_BlocksSize{compressedData.size() - c_BlocksBegin};
+
+        containerLayout.m_Blocks.reserve(blocksCount);
+
+        for (uint64_t blockIndex{0}; blockIndex < blocksCount; ++blockIndex)
+        {
+            uint64_t blockOffset{0};
+            uint64_t encodedBlockSize{0};
+
+            readInteger(compressedData, position, 8, blockOffset);
+            readInteger(compressedData, position, 8, encodedBlockSize);
+
+            if (blockOffset > c_BlocksSize || encodedBlockSize > c_BlocksSize - blockOffset)
+            {
+                break;
+            }
+
+            containerLayout.m_Blocks.emplace_back(c_BlocksBegin + blockOffset,
+                                                  c_BlocksBegin + blockOffset + encodedBlockSize);
+        }
+
+        success = containerLayout.m_Blocks.size() == blocksCount;
+    } while (false);
+
+    return success;
+}
+
+size_t HuffmanBlockCompressor::_getBlockCharsCount(const ContainerLayout& containerLayout, size_t blockIndex)
+{
+    return std::min(containerLayout.m_BlockSize,
+                    containerLayout.m_InputSize - blockIndex * containerLayout.m_BlockSize);
+}
+
+bool HuffmanBlockCompressor::_readBlockEncoding(const CompressedData& compressedData,
+                                                const ContainerLayout& containerLayout, size_t blockIndex,
+                                                BlockEncoding& blockEncoding)
+{
+    bool success{false};
+
+    do
+    {
+        const auto [c_EncodedBlockBegin, c_EncodedBlockEnd]{containerLayout.m_Blocks[blockIndex]};
+
+        // a copy of the encoded block is not required, as long as reading doesn't pass its end
+        size_t position{c_EncodedBlockBegin};
+
+        blockEncoding.m_BlockCodeTable.clear();
+
+        if (CodeTableMode::PER_BLOCK == containerLayout.m_CodeTableMode &&
+            !readCodeTable(compressedData, position, blockEncoding.m_BlockCodeTable))
+        {
+            break;
+        }
+
+        const EncodingOutput& c_CodeTable{CodeTableMode::PER_BLOCK == containerLayout.m_CodeTableMode
+                                              ? blockEncoding.m_BlockCodeTable
+                                              : containerLayout.m_SharedCodeTable};
+        uint64_t bitsCount{0};
+
+        if (position > c_EncodedBlockEnd || !readInteger(compressedData, position, 8, bitsCount) ||
+            position > c_EncodedBlockEnd || (bitsCount + 7) / 8 != c_EncodedBlockEnd - position)
+        {
+            break;
+        }
+
+        // each char is encoded by at least the shortest and at most the longest code (a single symbol requires no bits)
+        const auto [c_ShortestEncoding, c_LongestEncoding]{std::minmax_element(
+            c_CodeTable.cbegin(), c_CodeTable.cend(),
+            [](const auto& first, const auto& second) { return first.second.size() < second.second.size(); })};
+        const uint64_t c_CharsCount{_getBlockCharsCount(containerLayout, blockIndex)};
+
+        if (bitsCount < c_CharsCount * c_ShortestEncoding->second.size() ||
+            bitsCount > c_CharsCount * c_LongestEncoding->second.size())
+        {
+            break;
+        }
+
+        blockEncoding.m_BitsCount = bitsCount;
+        blockEncoding.m_BitsPosition = position;
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+// the output should have room for the block chars count
+bool HuffmanBlockCompressor::_decodeBlock(const CompressedData& compressedData, const ContainerLayout& containerLayout,
+                                          size_t blockIndex, char* output)
+{
+    INSTRUMENT_SCOPE("HuffmanBlockCompressor::decodeBlock");
+
+    BlockEncoding blockEncoding;
+    bool success{_readBlockEncoding(compressedData, containerLayout, blockIndex, blockEncoding)};
+
+    if (success)
+    {
+        const EncodingOutput& c_CodeTable{CodeTableMode::PER_BLOCK == containerLayout.m_CodeTableMode
+                                              ? blockEncoding.m_BlockCodeTable
+                                              : containerLayout.m_SharedCodeTable};
+        const size_t c_CharsCount{_getBlockCharsCount(containerLayout, blockIndex)};
+
+        if (1 == c_CodeTable.size())
+        {
+            // single character: no encoded bits
+            std::fill_n(output, c_CharsCount, c_CodeTable.cbegin()->first);
+        }
+        else
+        {
+            const bool c_IsTableDecodingPossible{
+                std::all_of(c_CodeTable.cbegin(), c_CodeTable.cend(),
+                            [](const auto& encoding) { return encoding.second.size() <= c_MaxCodeLength; })};
+            const uint8_t* const c_EncodedBits{compressedData.data() + blockEncoding.m_BitsPosition};
+            const uint64_t c_BitsCount{blockEncoding.m_BitsCount};
+
+            success = c_IsTableDecodingPossible
+                          ? decodeUsingTable(c_CodeTable, c_EncodedBits, c_BitsCount, c_CharsCount, output)
+                          : decodeUsingTree(c_CodeTable, c_EncodedBits, c_BitsCount, c_CharsCount, output);
+        }
+    }
+
+    return success;
+}
+
+bool HuffmanBlockCompressor::_runInParallel(size_t tasksCount, size_t threadsCount,
+                                            const std::function<bool(size_t)>& task)
+{
+    std::atomic<size_t> nextTaskIndex{0};
+    std::atomic<bool> hasTaskFailed{false};
+
+    // each thread picks the next task when ready, so uneven tasks don't leave threads idle
+    auto runTasks{[tasksCount, &task, &nextTaskIndex, &hasTaskFailed]() {
+        for (size_t taskIndex{nextTaskIndex++}; taskIndex < tasksCount && !hasTaskFailed; taskIndex = nextTaskIndex++)
+        {
+            if (!task(taskIndex))
+            {
+                hasTaskFailed = true;
+            }
+        }
+    }};
+
+    const size_t c_ThreadsCount{std::clamp<size_t>(tasksCount, 1, threadsCount)};
+    std::vector<std::thread> threads;
+
+    threads.reserve(c_ThreadsCount - 1);
+
+    for (size_t threadIndex{1}; threadIndex < c_ThreadsCount; ++threadIndex)
+    {
+        threads.emplace_back(runTasks);
+    }
+
+    runTasks();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return !hasTaskFailed;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "huffmanencoder.h"
+
+using CompressedData = std::vector<uint8_t>;
+
+/* Block based Huffman compression of byte sequences (built on top of the HuffmanEncoder code tables):
+   - the input is split into fixed-size blocks that are encoded and decoded independently, so the work is distributed
+   among threads (each thread picks the next unprocessed block)
+   - the code table is either shared by all blocks (computed from the character occurrences of the whole input) or
+   computed for each block (adapted to the local character distribution, at the cost of storing a table per block)
+   - the result is an indexed container, so any block can be located and decoded without decoding the previous ones
+   - the code lengths are limited, so each symbol is decoded by a single table lookup (containers with longer codes are
+   decoded bit by bit)
+
+   Container format (integers are stored little endian, bits are stored LSB first):
+   - header: "HUFB", version (1 byte), code table mode (1 byte), block size (4 bytes), input size (8 bytes), blocks
+   count (4 bytes)
+   - shared code table (SHARED mode only)
+   - block index: offset (relative to the first block) and size of each encoded block (8 bytes each)
+   - encoded blocks: code table (PER_BLOCK mode only), encoded bits count (8 bytes), encoded bits
+   - code table: symbols count (2 bytes), then for each symbol: symbol (1 byte), code length (1 byte), code bits
+   (padded to full bytes); a single symbol has an empty code (its block contains no encoded bits)
+*/
+class HuffmanBlockCompressor
+{
+public:
+    enum class CodeTableMode : uint8_t
+    {
+        SHARED = 0,
+        PER_BLOCK
+    };
+
+    explicit HuffmanBlockCompressor(size_t blockSize = c_DefaultBlockSize,
+                                    CodeTableMode codeTableMode = CodeTableMode::PER_BLOCK,
+                                    size_t threadsCount = std::thread::hardware_concurrency());
+
+    // return false if the input could not be compressed / decompressed (e.g. invalid container, output too large to be
+    // allocated), output unchanged
+    bool compress(std::string_view input, CompressedData& compressedData) const;
+    bool decompress(const CompressedData& compressedData, std::string& output) const;
+
+    // random access (only the requested block is decoded), nullopt / false returned for invalid containers
+    static std::optional<size_t> getBlocksCount(const CompressedData& compressedData);
+    static bool decompressBlock(const CompressedData& compressedData, size_t blockIndex, std::string& output);
+
+    static constexpr size_t c_DefaultBlockSize{1 << 20};
+
+    // the codes are length-limited (see HuffmanEncoder) so each symbol is decoded by a single table lookup
+    static constexpr size_t c_MaxCodeLength{12};
+
+private:
+    struct ContainerLayout
+    {
+        CodeTableMode m_CodeTableMode;
+        size_t m_BlockSize;
+        size_t m_InputSize;
+        EncodingOutput m_SharedCodeTable;
+        std::vector<std::pair<size_t, size_t>> m_Blocks; // begin and end position of each encoded block
+    };
+
+    struct BlockEncoding
+    {
+        EncodingOutput m_BlockCodeTable; // PER_BLOCK mode only
+        uint64_t m_BitsCount;
+        size_t m_BitsPosition;
+    };
+
+    static bool _readContainerLayout(const CompressedData& compressedData, ContainerLayout& containerLayout);
+    static size_t _getBlockCharsCount(const ContainerLayout& containerLayout, size_t blockIndex);
+
+    // fails if the encoded bits count of the block cannot match its chars count (given the code lengths)
+    static bool _readBlockEncoding(const CompressedData& compressedData, const ContainerLayout& containerLayout,
+                                   size_t blockIndex, BlockEncoding& blockEncoding);
+    static bool _decodeBlock(const CompressedData& compressedData, const ContainerLayout& containerLayout,
+                             size_t blockIndex, char* output);
+
+    // the task returns false in case of failure, in which case the remaining tasks are no longer executed
+    static bool _runInParallel(size_t tasksCount, size_t threadsCount, const std::function<bool(size_t)>& task);
+
+    size_t m_BlockSize;
+    CodeTableMode m_CodeTableMode;
+    size_t m_ThreadsCount;
+};
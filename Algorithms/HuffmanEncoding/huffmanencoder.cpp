@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 
@@ -9,18 +10,37 @@ HuffmanEncoder::HuffmanEncoder()
 {
 }
 
-bool HuffmanEncoder::encode(const EncodingInput& encodingInput)
+bool HuffmanEncoder::encode(const EncodingInput& encodingInput, std::optional<size_t> maxCodeLength)
 {
     _reset();
 
-    const bool c_IsValidInput{_buildOccurrenceMap(encodingInput)};
+    // enough distinct codes should be available within the maximum length
+    const bool c_IsValidInput{_buildOccurrenceMap(encodingInput) &&
+                              (!maxCodeLength.has_value() ||
+                               (*maxCodeLength > 0u && (*maxCodeLength >= sizeof(size_t) * 8 ||
+                                                        mOccurrenceMap.size() <= size_t{1} << *maxCodeLength)))};
 
     if (c_IsValidInput)
     {
         _buildTree();
         _retrieveEncodingFromTree();
+
+        const bool c_IsCodeLengthExceeded{
+            maxCodeLength.has_value() &&
+            std::any_of(mEncodingResult.cbegin(), mEncodingResult.cend(),
+                        [&maxCodeLength](const auto& encoding) { return encoding.second.size() > *maxCodeLength; })};
+
+        if (c_IsCodeLengthExceeded)
+        {
+            _retrieveLengthLimitedEncoding(*maxCodeLength);
+        }
+
         _computeEncodingEfficiency();
     }
+    else
+    {
+        mOccurrenceMap.clear();
+    }
 
     return c_IsValidInput;
 }
@@ -221,6 +241,137 @@ void HuffmanEncoder::_retrieveEncodingFromTree()
     }
 }
 
+/* The code lengths are computed by using the package-merge algorithm (the resulting lengths are optimal for the given
+   maximum length):
+    - on the first level the items are the characters sorted by occurrence
+    - on each next level the items of the previous level are packaged in pairs (the occurrence of a package is the sum
+   of the paired items) and merged with the characters (ordered by occurrence)
+    - the first 2 * (charsCount - 1) items of the last level are selected; the first 2 * (number of selected packages)
+   items of the previous level are then selected and so on
+    - the code length of each character is the number of levels where it got selected
+   The canonical codes are then assigned: characters sorted by code length get consecutive codes, each code being
+   shifted left when the length increases (the codes are prefix-free as the lengths fulfill the Kraft equality).
+*/
+void HuffmanEncoder::_retrieveLengthLimitedEncoding(size_t maxCodeLength)
+{
+    const size_t c_CharsCount{mOccurrenceMap.size()};
+
+    assert(c_CharsCount >= scMinRequiredCharsCount && maxCodeLength > 0u);
+
+    // characters are referenced by their index in the occurrence map (ascending occurrence)
+    std::vector<char> characters;
+    std::vector<ssize_t> occurrences;
+
+    for (CharOccurrenceMap::const_iterator it{mOccurrenceMap.cbegin()}; it != mOccurrenceMap.cend(); ++it)
+    {
+        occurrences.push_back(it->first);
+        characters.push_back(it->second);
+    }
+
+    // package items have no character index
+    struct Item
+    {
+        ssize_t mOccurrence;
+        std::optional<size_t> mCharIndex;
+    };
+
+    // there is no need for more levels than characters
+    const size_t c_LevelsCount{std::min(maxCodeLength, c_CharsCount - 1)};
+    std::vector<std::vector<Item>> levels(c_LevelsCount);
+
+    for (size_t levelIndex{0}; levelIndex < c_LevelsCount; ++levelIndex)
+    {
+        std::vector<Item>& currentLevel{levels[levelIndex]};
+        currentLevel.reserve(2 * c_CharsCount);
+
+        size_t charIndex{0};
+        size_t packagedItemIndex{0};
+        const std::vector<Item>* pPreviousLevel{levelIndex > 0u ? &levels[levelIndex - 1] : nullptr};
+        const size_t c_PackagesCount{pPreviousLevel ? pPreviousLevel->size() / 2 : 0u};
+
+        while (charIndex < c_CharsCount || packagedItemIndex < 2 * c_PackagesCount)
+        {
+            const bool c_IsPackageAvailable{packagedItemIndex < 2 * c_PackagesCount};
+            const ssize_t c_PackageOccurrence{c_IsPackageAvailable
+                                                  ? (*pPreviousLevel)[packagedItemIndex].mOccurrence +
+                                                        (*pPreviousLevel)[packagedItemIndex + 1].mOccurrence
+                                                  : 0};
+
+            if (charIndex < c_CharsCount && (!c_IsPackageAvailable || occurrences[charIndex] <= c_PackageOccurrence))
+            {
+                currentLevel.push_back({occurrences[charIndex], charIndex});
+                ++charIndex;
+            }
+            else
+            {
+                currentLevel.push_back({c_PackageOccurrence, std::nullopt});
+                packagedItemIndex += 2;
+            }
+        }
+    }
+
+    std::vector<size_t> codeLengths(c_CharsCount, 0u);
+    size_t selectedItemsCount{2 * (c_CharsCount - 1)};
+
+    for (size_t levelIndex{c_LevelsCount}; levelIndex > 0u; --levelIndex)
+    {
+        const std::vector<Item>& c_Level{levels[levelIndex - 1]};
+        size_t selectedPackagesCount{0};
+
+        assert(selectedItemsCount <= c_Level.size());
+
+        for (size_t itemIndex{0}; itemIndex < selectedItemsCount; ++itemIndex)
+        {
+            if (c_Level[itemIndex].mCharIndex.has_value())
+            {
+                ++codeLengths[*c_Level[itemIndex].mCharIndex];
+            }
+            else
+            {
+                ++selectedPackagesCount;
+            }
+        }
+
+        selectedItemsCount = 2 * selectedPackagesCount;
+    }
+
+    std::vector<size_t> canonicalOrder(c_CharsCount);
+
+    for (size_t charIndex{0}; charIndex < c_CharsCount; ++charIndex)
+    {
+        canonicalOrder[charIndex] = charIndex;
+    }
+
+    std::sort(canonicalOrder.begin(), canonicalOrder.end(), [&codeLengths, &characters](size_t first, size_t second) {
+        return codeLengths[first] < codeLengths[second] ||
+               (codeLengths[first] == codeLengths[second] && characters[first] < characters[second]);
+    });
+
+    // the codes are stored as strings so there is no limit to the code size (other than the maximum length)
+    std::string code;
+    mEncodingResult.clear();
+
+    for (const size_t c_CharIndex : canonicalOrder)
+    {
+        if (!code.empty())
+        {
+            // increment the binary number (the next code of the same length)
+            std::string::reverse_iterator digitIt{code.rbegin()};
+
+            for (; digitIt != code.rend() && scBinaryDigit1 == *digitIt; ++digitIt)
+            {
+                *digitIt = scBinaryDigit0;
+            }
+
+            assert(digitIt != code.rend());
+            *digitIt = scBinaryDigit1;
+        }
+
+        code.resize(codeLengths[c_CharIndex], scBinaryDigit0);
+        mEncodingResult[characters[c_CharIndex]] = code;
+    }
+}
+
 /* The efficiency might be negative when the characters are uniformly distributed regarding occurrence (extreme case:
    they have perfectly equal occurrence). The least uniform the chars are distributed the higher is the efficiency. The
    efficiency is measured by how much the number of used bits decreases (or increases: negative) when using Huffman
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -15,7 +16,16 @@ class HuffmanEncoder
 public:
     HuffmanEncoder();
 
-    bool encode(const EncodingInput& encodingInput);
+    /* The maximum code length is optional:
+       - if provided and exceeded by the Huffman codes, the code lengths are limited by using the package-merge
+       algorithm (optimal lengths within the limit) and canonical codes are assigned
+       - the efficiency is computed for the resulting codes; comparing it with the efficiency of an unlimited encoding
+       does not measure a loss caused by the limit: the tree built without limit is not necessarily optimal (see
+       _buildTree()), so the limited codes might even be more efficient than the unlimited ones
+       - bounded codes can be decoded by a single table lookup per symbol (table with 2 ^ maxCodeLength entries)
+       - encoding fails if the limit is too low for encoding all characters (2 ^ maxCodeLength < characters count)
+    */
+    bool encode(const EncodingInput& encodingInput, std::optional<size_t> maxCodeLength = std::nullopt);
     EncodingOutput getEncodingResult() const;
     double getEncodingEfficiency() const;
 
@@ -38,6 +48,7 @@ private:
     bool _buildOccurrenceMap(const EncodingInput& encodingInput);
     void _buildTree();
     void _retrieveEncodingFromTree();
+    void _retrieveLengthLimitedEncoding(size_t maxCodeLength);
 
     /* Encoding efficiency is computed as reduction percentage of the total bit count when using Huffman encoding
        comparing to using fixed-size bit encoding with a minimum required bit count per symbol (character)
@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <cassert>
+
+#include "boruvka.h"
+
+BoruvkaEngine::BoruvkaEngine(size_t threadsCount)
+    : BaseEngine{"Boruvka"}
+    , mThreadsCount{std::max<size_t>(threadsCount, 1)}
+{
+}
+
+bool BoruvkaEngine::buildTrees(const GraphMatrix& graphMatrix)
+{
+    bool success{false};
+
+    _reset();
+
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        _buildGraph(graphMatrix);
+        _buildTreeFromGraph(true);  // minimum cost tree
+        _buildTreeFromGraph(false); // maximum cost tree
+
+        success = true;
+    }
+
+    return success;
+}
+
+bool BoruvkaEngine::buildTrees(size_t nodesCount, WeightedEdges edges)
+{
+    bool success{false};
+
+    _reset();
+
+    const bool c_AreEdgesValid{std::all_of(edges.cbegin(), edges.cend(), [nodesCount](const WeightedEdge& edge) {
+        return edge.mEdge.first < nodesCount && edge.mEdge.second < nodesCount;
+    })};
+
+    if (nodesCount > 0 && c_AreEdgesValid)
+    {
+        mNodesCount = nodesCount;
+        mEdges = std::move(edges);
+
+        _buildTreeFromGraph(true);
+        _buildTreeFromGraph(false);
+
+        success = true;
+    }
+
+    return success;
+}
+
+size_t BoruvkaEngine::getThreadsCount() const
+{
+    return mThreadsCount;
+}
+
+// same edges order as for KruskalEngine (required for identical tie breaking)
+void BoruvkaEngine::_buildGraph(const GraphMatrix& graphMatrix)
+{
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        mNodesCount = c_RowsCount;
+
+        for (matrix_size_t row{0}; row < c_RowsCount - 1; ++row)
+        {
+            for (Matrix<Cost>::ConstZIterator it{graphMatrix.getConstZIterator(row, row + 1)};
+                 it != graphMatrix.constZRowEnd(row); ++it)
+            {
+                if (*it != 0)
+                {
+                    mEdges.push_back(WeightedEdge{Edge{*it.getRowNr(), *it.getColumnNr()}, *it});
+                }
+            }
+        }
+    }
+    else
+    {
+        assert(false);
+    }
+}
+
+/* Each round consists of following steps:
+   a) each node is labeled with the root of its component (parallel by nodes)
+   b) edges that connect nodes of the same component are discarded and the best remaining edge of each component is
+   determined (parallel by edges)
+   c) the best edges are added to the tree (parallel by components): if two components selected the same edge it is
+   added only once, the order being strict (cost, then edge number) no other loops can be formed
+
+   The rounds stop when no edges connect different components anymore (the graph might be broken into separate parts,
+   in which case a tree is built for each part, same as for KruskalEngine).
+*/
+void BoruvkaEngine::_buildTreeFromGraph(bool isMinTree)
+{
+    assert(mNodesCount > 0);
+
+    Tree& tree{isMinTree ? mMinTree : mMaxTree};
+    assert(tree.empty());
+
+    auto isBetterEdge{[this, isMinTree](size_t firstIndex, size_t secondIndex) {
+        const Cost c_FirstCost{mEdges[firstIndex].mCost};
+        const Cost c_SecondCost{mEdges[secondIndex].mCost};
+
+        return isMinTree ? (c_FirstCost < c_SecondCost || (c_FirstCost == c_SecondCost && firstIndex < secondIndex))
+                         : (c_FirstCost > c_SecondCost || (c_FirstCost == c_SecondCost && firstIndex > secondIndex));
+    }};
+
+    mParents = std::vector<std::atomic<Node>>(mNodesCount);
+    mBestEdgeIndexes = std::vector<std::atomic<size_t>>(mNodesCount);
+    mComponents.resize(mNodesCount);
+    mActiveEdgeIndexes.assign(mThreadsCount, EdgeIndexes{});
+
+    for (Node node{0}; node < mNodesCount; ++node)
+    {
+        mParents[node].store(node, std::memory_order_relaxed);
+        mBestEdgeIndexes[node].store(scNullEdgeIndex, std::memory_order_relaxed);
+    }
+
+    // distribute the edges evenly among threads
+    const size_t c_EdgesCount{mEdges.size()};
+
+    for (size_t edgeIndex{0}; edgeIndex < c_EdgesCount; ++edgeIndex)
+    {
+        mActiveEdgeIndexes[edgeIndex * mThreadsCount / c_EdgesCount].push_back(edgeIndex);
+    }
+
+    auto getNodesRange{[this](size_t taskIndex) {
+        return std::pair<Node, Node>{taskIndex * mNodesCount / mThreadsCount,
+                                     (taskIndex + 1) * mNodesCount / mThreadsCount};
+    }};
+
+    std::vector<EdgeIndexes> addedEdgeIndexes(mThreadsCount);
+    EdgeIndexes treeEdgeIndexes;
+
+    for (bool edgesAdded{true}; edgesAdded;)
+    {
+        _runInParallel([this, &getNodesRange](size_t taskIndex) {
+            const auto [c_FirstNode, c_LastNode]{getNodesRange(taskIndex)};
+
+            for (Node node{c_FirstNode}; node < c_LastNode; ++node)
+            {
+                mComponents[node] = _findRoot(node);
+            }
+        });
+
+        _runInParallel([this, &isBetterEdge](size_t taskIndex) {
+            EdgeIndexes& activeEdgeIndexes{mActiveEdgeIndexes[taskIndex]};
+
+            const auto c_InactiveEdgesIt{std::remove_if(
+                activeEdgeIndexes.begin(), activeEdgeIndexes.end(), [this, &isBetterEdge](size_t edgeIndex) {
+                    const Node c_FirstComponent{mComponents[mEdges[edgeIndex].mEdge.first]};
+                    const Node c_SecondComponent{mComponents[mEdges[edgeIndex].mEdge.second]};
+                    const bool c_IsInactive{c_FirstComponent == c_SecondComponent};
+
+                    if (!c_IsInactive)
+                    {
+                        for (const Node component : {c_FirstComponent, c_SecondComponent})
+                        {
+                            std::atomic<size_t>& bestEdgeIndex{mBestEdgeIndexes[component]};
+                            size_t currentBestEdgeIndex{bestEdgeIndex.load(std::memory_order_relaxed)};
+
+                            // on failure currentBestEdgeIndex gets reloaded so the comparison is repeated
+                            while ((scNullEdgeIndex == currentBestEdgeIndex ||
+                                    isBetterEdge(edgeIndex, currentBestEdgeIndex)) &&
+                                   !bestEdgeIndex.compare_exchange_weak(currentBestEdgeIndex, edgeIndex,
+                                                                        std::memory_order_relaxed))
+                            {
+                            }
+                        }
+                    }
+
+                    return c_IsInactive;
+                })};
+
+            activeEdgeIndexes.erase(c_InactiveEdgesIt, activeEdgeIndexes.end());
+        });
+
+        _runInParallel([this, &getNodesRange, &addedEdgeIndexes](size_t taskIndex) {
+            const auto [c_FirstNode, c_LastNode]{getNodesRange(taskIndex)};
+
+            for (Node node{c_FirstNode}; node < c_LastNode; ++node)
+            {
+                const size_t c_BestEdgeIndex{mBestEdgeIndexes[node].exchange(scNullEdgeIndex)};
+
+                if (c_BestEdgeIndex != scNullEdgeIndex)
+                {
+                    const Edge& c_Edge{mEdges[c_BestEdgeIndex].mEdge};
+
+                    // fails if the other component selected the same edge and has already added it
+                    if (_uniteComponents(c_Edge.first, c_Edge.second))
+                    {
+                        addedEdgeIndexes[taskIndex].push_back(c_BestEdgeIndex);
+                    }
+                }
+            }
+        });
+
+        const size_t c_PreviousTreeEdgesCount{treeEdgeIndexes.size()};
+
+        for (auto& currentAddedEdgeIndexes : addedEdgeIndexes)
+        {
+            treeEdgeIndexes.insert(treeEdgeIndexes.end(), currentAddedEdgeIndexes.cbegin(),
+                                   currentAddedEdgeIndexes.cend());
+            currentAddedEdgeIndexes.clear();
+        }
+
+        edgesAdded = treeEdgeIndexes.size() > c_PreviousTreeEdgesCount;
+    }
+
+    // the edges are appended in the order Kruskal would have added them
+    std::sort(treeEdgeIndexes.begin(), treeEdgeIndexes.end(), isBetterEdge);
+
+    for (const size_t edgeIndex : treeEdgeIndexes)
+    {
+        tree.push_back(mEdges[edgeIndex].mEdge);
+    }
+}
+
+void BoruvkaEngine::_reset()
+{
+    BaseEngine::_reset();
+
+    mEdges.clear();
+    mParents.clear();
+    mBestEdgeIndexes.clear();
+    mComponents.clear();
+    mActiveEdgeIndexes.clear();
+}
+
+void BoruvkaEngine::_runInParallel(const std::function<void(size_t)>& task) const
+{
+    std::vector<std::thread> threads;
+    threads.reserve(mThreadsCount - 1);
+
+    for (size_t taskIndex{1}; taskIndex < mThreadsCount; ++taskIndex)
+    {
+        threads.emplace_back(task, taskIndex);
+    }
+
+    task(0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/* Lock-free find with path halving: the parent of each visited node is replaced by its grandparent (if no other thread
+   modified it meanwhile). Components are always linked from the higher numbered root to the lower numbered one so
+   the parent of a node is never higher numbered than the node itself (no loops, even with concurrent updates).
+*/
+Node BoruvkaEngine::_findRoot(Node node)
+{
+    for (;;)
+    {
+        Node parent{mParents[node].load(std::memory_order_relaxed)};
+
+        if (parent == node)
+        {
+            break;
+        }
+
+        const Node c_GrandParent{mParents[parent].load(std::memory_order_relaxed)};
+
+        if (parent != c_GrandParent)
+        {
+            mParents[node].compare_exchange_weak(parent, c_GrandParent, std::memory_order_relaxed);
+        }
+
+        node = c_GrandParent;
+    }
+
+    return node;
+}
+
+// returns false if the nodes already belong to the same component
+bool BoruvkaEngine::_uniteComponents(Node firstNode, Node secondNode)
+{
+    bool success{false};
+
+    for (;;)
+    {
+        Node firstRoot{_findRoot(firstNode)};
+        Node secondRoot{_findRoot(secondNode)};
+
+        if (firstRoot == secondRoot)
+        {
+            break;
+        }
+
+        if (firstRoot < secondRoot)
+        {
+            std::swap(firstRoot, secondRoot);
+        }
+
+        // retry if the root has meanwhile been linked to another component by a different thread
+        if (mParents[firstRoot].compare_exchange_strong(firstRoot, secondRoot))
+        {
+            success = true;
+            break;
+        }
+    }
+
+    return success;
+}
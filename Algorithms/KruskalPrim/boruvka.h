@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "baseengine.h"
+
+/* Parallel Boruvka engine:
+   - in each round every component selects its best edge towards another component (edges scanned in parallel, best
+   edge per component updated lock-free by compare-and-swap), then the selected edges are added to the tree by
+   uniting the components (lock-free union-find)
+   - the number of components at least halves in each round, so O(log(V)) rounds are required
+   - ties between edges with the same cost are broken by edge number (edges numbered the same way as for
+   KruskalEngine), which makes the trees (edges and their order) identical to the Kruskal ones
+*/
+class BoruvkaEngine : public BaseEngine
+{
+public:
+    explicit BoruvkaEngine(size_t threadsCount = std::thread::hardware_concurrency());
+    bool buildTrees(const GraphMatrix& graphMatrix) override;
+
+    // allows skipping the matrix entirely (node numbers of the edges should be lower than the nodes count)
+    bool buildTrees(size_t nodesCount, WeightedEdges edges);
+
+    size_t getThreadsCount() const;
+
+private:
+    using EdgeIndexes = std::vector<size_t>;
+
+    void _buildGraph(const GraphMatrix& graphMatrix);
+    void _buildTreeFromGraph(bool isMinTree);
+    void _reset() override;
+
+    // each task gets its own index (from 0 to threads count - 1)
+    void _runInParallel(const std::function<void(size_t)>& task) const;
+
+    Node _findRoot(Node node);
+    bool _uniteComponents(Node firstNode, Node secondNode);
+
+    static constexpr size_t scNullEdgeIndex{std::numeric_limits<size_t>::max()};
+
+    size_t mThreadsCount;
+    WeightedEdges mEdges;
+    std::vector<std::atomic<Node>> mParents;
+    std::vector<std::atomic<size_t>> mBestEdgeIndexes;
+    std::vector<Node> mComponents;
+    std::vector<EdgeIndexes> mActiveEdgeIndexes; // edges connecting different components (one array per thread)
+};
@@ -0,0 +1,19 @@
+/* This is a small application that illustrates the Boruvka algorithm for determining the minimum/maximum cost tree. In
+   each step every component (initially each node is a component) selects its best edge towards another component and
+   the selected edges are added to the tree, which merges the components. The edges are processed by multiple threads.
+   Same input and output format as for the Kruskal and Prim applications.
+*/
+
+#include "boruvka.h"
+#include "utils.h"
+
+static const std::string c_InFile{Utilities::c_InputOutputDir + "kruskalpriminput.txt"};
+static const std::string c_OutFile{Utilities::c_InputOutputDir + "boruvkaoutput.txt"};
+
+extern int treeAppMain(const std::string& inputFile, const std::string& outputFile, BaseEngine& treeEngine);
+
+int main()
+{
+    BoruvkaEngine boruvkaEngine;
+    return treeAppMain(c_InFile, c_OutFile, boruvkaEngine);
+}
@@ -2,6 +2,7 @@
 
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "matrix.h"
 
@@ -10,3 +11,11 @@ using Edge = std::pair<Node, Node>;
 using Cost = size_t;
 using GraphMatrix = Matrix<Cost>;
 using Tree = std::list<Edge>;
+
+struct WeightedEdge
+{
+    Edge mEdge;
+    Cost mCost;
+};
+
+using WeightedEdges = std::vector<WeightedEdge>;
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "graphdatatypes.h"
+
+/* Binary heap of graph nodes prioritized by cost:
+   - the position of each node within the heap is tracked, which enables updating the cost of a node that is already
+   contained in the heap (decrease-key) in logarithmic time
+   - Compare determines which cost is "better" (std::less for minimum cost trees, std::greater for maximum cost trees),
+   the best one being located at the top of the heap
+   - each node number should be lower than the nodes count provided at construction
+*/
+template <typename Compare> class IndexedBinaryHeap
+{
+public:
+    explicit IndexedBinaryHeap(size_t nodesCount)
+        : mPositions(nodesCount, scNullPosition)
+    {
+    }
+
+    // inserts the node or updates its cost (only if the new cost is better), returns true if the heap has been modified
+    bool pushOrUpdate(Node node, Cost cost)
+    {
+        bool modified{false};
+
+        if (node < mPositions.size())
+        {
+            if (scNullPosition == mPositions[node])
+            {
+                mPositions[node] = mHeap.size();
+                mHeap.emplace_back(node, cost);
+                _siftUp(mHeap.size() - 1);
+                modified = true;
+            }
+            else if (const size_t c_Position{mPositions[node]}; mCompare(cost, mHeap[c_Position].second))
+            {
+                mHeap[c_Position].second = cost;
+                _siftUp(c_Position);
+                modified = true;
+            }
+        }
+        else
+        {
+            assert(false);
+        }
+
+        return modified;
+    }
+
+    std::pair<Node, Cost> pop()
+    {
+        assert(!mHeap.empty());
+
+        const std::pair<Node, Cost> c_Top{mHeap.front()};
+
+        _swap(0, mHeap.size() - 1);
+        mHeap.pop_back();
+        mPositions[c_Top.first] = scNullPosition;
+
+        if (!mHeap.empty())
+        {
+            _siftDown(0);
+        }
+
+        return c_Top;
+    }
+
+    bool isEmpty() const
+    {
+        return mHeap.empty();
+    }
+
+private:
+    void _siftUp(size_t position)
+    {
+        while (position > 0)
+        {
+            const size_t c_ParentPosition{(position - 1) / 2};
+
+            if (!mCompare(mHeap[position].second, mHeap[c_ParentPosition].second))
+            {
+                break;
+            }
+
+            _swap(position, c_ParentPosition);
+            position = c_ParentPosition;
+        }
+    }
+
+    void _siftDown(size_t position)
+    {
+        for (;;)
+        {
+            const size_t c_LeftChildPosition{2 * position + 1};
+            const size_t c_RightChildPosition{c_LeftChildPosition + 1};
+            size_t bestPosition{position};
+
+            if (c_LeftChildPosition < mHeap.size() &&
+                mCompare(mHeap[c_LeftChildPosition].second, mHeap[bestPosition].second))
+            {
+                bestPosition = c_LeftChildPosition;
+            }
+
+            if (c_RightChildPosition < mHeap.size() &&
+                mCompare(mHeap[c_RightChildPosition].second, mHeap[bestPosition].second))
+            {
+                bestPosition = c_RightChildPosition;
+            }
+
+            if (bestPosition == position)
+            {
+                break;
+            }
+
+            _swap(position, bestPosition);
+            position = bestPosition;
+        }
+    }
+
+    void _swap(size_t firstPosition, size_t secondPosition)
+    {
+        std::swap(mHeap[firstPosition], mHeap[secondPosition]);
+        mPositions[mHeap[firstPosition].first] = firstPosition;
+        mPositions[mHeap[secondPosition].first] = secondPosition;
+    }
+
+    static constexpr size_t scNullPosition{std::numeric_limits<size_t>::max()};
+
+    std::vector<std::pair<Node, Cost>> mHeap;
+    std::vector<size_t> mPositions;
+    Compare mCompare;
+};
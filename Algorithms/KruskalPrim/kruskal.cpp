@@ -1,4 +1,5 @@
 #include "kruskal.h"
+#include "instrumentation.h"
 
 KruskalEngine::KruskalEngine()
     : BaseEngine{"Kruskal"}
@@ -27,6 +28,9 @@ bool KruskalEngine::buildTrees(const GraphMatrix& graphMatrix)
 
 void KruskalEngine::_buildGraph(const GraphMatrix& graphMatrix)
 {
+    // the edges are sorted by cost while being inserted into the map
+    INSTRUMENT_SCOPE("KruskalEngine::sortEdges");
+
     const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
 
     if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
@@ -46,6 +50,8 @@ void KruskalEngine::_buildGraph(const GraphMatrix& graphMatrix)
                 }
             }
         }
+
+        INSTRUMENT_COUNT("KruskalEngine::edgesCount", mEdgeCostsMap.size());
     }
     else
     {
@@ -57,6 +63,8 @@ void KruskalEngine::_buildGraph(const GraphMatrix& graphMatrix)
  */
 void KruskalEngine::_buildMinTreeFromGraph()
 {
+    INSTRUMENT_SCOPE("KruskalEngine::buildMinTree");
+
     if (mNodesCount > 0)
     {
         _buildEmptyComponents();
@@ -83,6 +91,8 @@ void KruskalEngine::_buildMinTreeFromGraph()
 
 void KruskalEngine::_buildMaxTreeFromGraph()
 {
+    INSTRUMENT_SCOPE("KruskalEngine::buildMaxTree");
+
     assert(mNodesCount > 0);
 
     if (mNodesCount > 0)
@@ -4,6 +4,7 @@
    (cost). The output is a list of edges that create the loop-free tree connecting all nodes at minimum cost.
 */
 
+#include "instrumentation.h"
 #include "kruskal.h"
 #include "utils.h"
 
@@ -15,5 +16,9 @@ extern int treeAppMain(const std::string& inputFile, const std::string& outputFi
 int main()
 {
     KruskalEngine kruskalEngine;
-    return treeAppMain(c_InFile, c_OutFile, kruskalEngine);
+    const int c_Result{treeAppMain(c_InFile, c_OutFile, kruskalEngine)};
+
+    INSTRUMENT_DUMP(Utilities::c_InputOutputDir + "kruskal");
+
+    return c_Result;
 }
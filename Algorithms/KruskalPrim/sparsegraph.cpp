@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <cassert>
+
+#include "sparsegraph.h"
+
+SparseGraph::SparseGraph(const GraphMatrix& graphMatrix)
+{
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        WeightedEdges edges;
+
+        for (matrix_size_t row{0}; row < c_RowsCount - 1; ++row)
+        {
+            for (GraphMatrix::ConstZIterator it{graphMatrix.getConstZIterator(row, row + 1)};
+                 it != graphMatrix.constZRowEnd(row); ++it)
+            {
+                if (*it != 0)
+                {
+                    edges.push_back(WeightedEdge{Edge{*it.getRowNr(), *it.getColumnNr()}, *it});
+                }
+            }
+        }
+
+        build(c_RowsCount, edges);
+    }
+}
+
+bool SparseGraph::build(size_t nodesCount, const WeightedEdges& edges)
+{
+    bool success{false};
+
+    clear();
+
+    do
+    {
+        if (nodesCount == 0)
+        {
+            break;
+        }
+
+        const bool c_AreEdgesValid{std::all_of(edges.cbegin(), edges.cend(), [nodesCount](const WeightedEdge& edge) {
+            const auto& [first, second]{edge.mEdge};
+            return first < nodesCount && second < nodesCount && first != second;
+        })};
+
+        if (!c_AreEdgesValid)
+        {
+            break;
+        }
+
+        // count the neighbors of each node, then convert the counts into offsets
+        mOffsets.assign(nodesCount + 1, 0);
+
+        for (const auto& edge : edges)
+        {
+            ++mOffsets[edge.mEdge.first + 1];
+            ++mOffsets[edge.mEdge.second + 1];
+        }
+
+        for (Node node{0}; node < nodesCount; ++node)
+        {
+            mOffsets[node + 1] += mOffsets[node];
+        }
+
+        mNeighbors.resize(mOffsets.back());
+        std::vector<size_t> insertionOffsets{mOffsets.cbegin(), mOffsets.cend() - 1};
+
+        for (const auto& edge : edges)
+        {
+            const auto& [first, second]{edge.mEdge};
+
+            mNeighbors[insertionOffsets[first]++] = Neighbor{second, edge.mCost};
+            mNeighbors[insertionOffsets[second]++] = Neighbor{first, edge.mCost};
+        }
+
+        bool hasDuplicateEdges{false};
+
+        for (Node node{0}; node < nodesCount && !hasDuplicateEdges; ++node)
+        {
+            const auto c_NeighborsBeginIt{mNeighbors.begin() + mOffsets[node]};
+            const auto c_NeighborsEndIt{mNeighbors.begin() + mOffsets[node + 1]};
+
+            std::sort(c_NeighborsBeginIt, c_NeighborsEndIt,
+                      [](const Neighbor& first, const Neighbor& second) { return first.mNode < second.mNode; });
+
+            hasDuplicateEdges = std::adjacent_find(c_NeighborsBeginIt, c_NeighborsEndIt,
+                                                   [](const Neighbor& first, const Neighbor& second) {
+                                                       return first.mNode == second.mNode;
+                                                   }) != c_NeighborsEndIt;
+        }
+
+        if (hasDuplicateEdges)
+        {
+            clear();
+            break;
+        }
+
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+void SparseGraph::clear()
+{
+    mOffsets.clear();
+    mNeighbors.clear();
+}
+
+std::span<const SparseGraph::Neighbor> SparseGraph::getNeighbors(Node node) const
+{
+    std::span<const Neighbor> result;
+
+    if (node < getNodesCount())
+    {
+        result = std::span<const Neighbor>{mNeighbors.data() + mOffsets[node], mOffsets[node + 1] - mOffsets[node]};
+    }
+    else
+    {
+        assert(false);
+    }
+
+    return result;
+}
+
+std::optional<Cost> SparseGraph::getEdgeCost(const Edge& edge) const
+{
+    std::optional<Cost> result;
+
+    if (edge.first < getNodesCount() && edge.second < getNodesCount())
+    {
+        const std::span<const Neighbor> c_Neighbors{getNeighbors(edge.first)};
+
+        const auto c_It{std::lower_bound(c_Neighbors.begin(), c_Neighbors.end(), edge.second,
+                                         [](const Neighbor& neighbor, Node node) { return neighbor.mNode < node; })};
+
+        if (c_It != c_Neighbors.end() && c_It->mNode == edge.second)
+        {
+            result = c_It->mCost;
+        }
+    }
+
+    return result;
+}
+
+size_t SparseGraph::getNodesCount() const
+{
+    return mOffsets.empty() ? 0 : mOffsets.size() - 1;
+}
+
+size_t SparseGraph::getEdgesCount() const
+{
+    return mNeighbors.size() / 2;
+}
+
+bool SparseGraph::isEmpty() const
+{
+    return mOffsets.empty();
+}
+
+std::istream& operator>>(std::istream& in, SparseGraph& graph)
+{
+    size_t nodesCount{0};
+    WeightedEdges edges;
+    bool isInputValid{false};
+
+    do
+    {
+        in >> nodesCount;
+
+        if (in.fail() || nodesCount == 0)
+        {
+            break;
+        }
+
+        isInputValid = true;
+
+        for (;;)
+        {
+            Node first{0};
+            Node second{0};
+            Cost cost{0};
+
+            if (!(in >> first))
+            {
+                // reaching the end of input is the only acceptable way of ending the edges list
+                isInputValid = in.eof();
+                break;
+            }
+
+            in >> second >> cost;
+
+            if (in.fail() || first == 0 || second == 0 || cost == 0)
+            {
+                isInputValid = false;
+                break;
+            }
+
+            edges.push_back(WeightedEdge{Edge{first - 1, second - 1}, cost});
+        }
+    } while (false);
+
+    if (!isInputValid || !graph.build(nodesCount, edges))
+    {
+        graph.clear();
+    }
+
+    return in;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <iostream>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "graphdatatypes.h"
+
+/* Compressed sparse row (CSR) representation of an undirected graph:
+   - the neighbors of all nodes are stored in a single array, the neighbors of node i being located between mOffsets[i]
+   and mOffsets[i + 1]
+   - memory usage is proportional to the number of edges (instead of nodes count squared as for GraphMatrix)
+   - each edge is stored twice (once for each of its nodes), the neighbors of each node are sorted by node number
+   - parallel edges and self-loops are not allowed (a GraphMatrix cannot contain them either)
+*/
+class SparseGraph
+{
+public:
+    struct Neighbor
+    {
+        Node mNode;
+        Cost mCost;
+    };
+
+    explicit SparseGraph() = default;
+
+    // only the upper half of the matrix is taken into account (same as for the Kruskal engines), 0 means no edge
+    explicit SparseGraph(const GraphMatrix& graphMatrix);
+
+    // returns false (graph remains empty) for invalid edges: node numbers out of range, self-loops, duplicates
+    bool build(size_t nodesCount, const WeightedEdges& edges);
+    void clear();
+
+    std::span<const Neighbor> getNeighbors(Node node) const;
+    std::optional<Cost> getEdgeCost(const Edge& edge) const;
+
+    size_t getNodesCount() const;
+    size_t getEdgesCount() const;
+    bool isEmpty() const;
+
+private:
+    std::vector<size_t> mOffsets;
+    std::vector<Neighbor> mNeighbors;
+};
+
+/* Edge list format:
+   - first number is the nodes count
+   - followed by one line per edge: first node, second node, cost (nodes numbered from 1, cost should be positive)
+   - the graph is cleared if the input is invalid
+*/
+std::istream& operator>>(std::istream& in, SparseGraph& graph);
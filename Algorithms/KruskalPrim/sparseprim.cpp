@@ -0,0 +1,103 @@
+#include <cassert>
+#include <functional>
+
+#include "indexedbinaryheap.h"
+#include "sparseprim.h"
+
+SparsePrimEngine::SparsePrimEngine()
+    : BaseEngine{"Sparse Prim"}
+{
+}
+
+bool SparsePrimEngine::buildTrees(const GraphMatrix& graphMatrix)
+{
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+    bool success{false};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        success = buildTrees(SparseGraph{graphMatrix});
+    }
+    else
+    {
+        _reset();
+    }
+
+    return success;
+}
+
+bool SparsePrimEngine::buildTrees(const SparseGraph& graph)
+{
+    bool success{false};
+
+    _reset();
+
+    if (!graph.isEmpty())
+    {
+        mNodesCount = graph.getNodesCount();
+
+        _buildTreeFromGraph<std::less<Cost>>(graph, mMinTree);
+        _buildTreeFromGraph<std::greater<Cost>>(graph, mMaxTree);
+
+        success = true;
+    }
+
+    return success;
+}
+
+template <typename Compare> void SparsePrimEngine::_buildTreeFromGraph(const SparseGraph& graph, Tree& tree)
+{
+    assert(tree.empty() && mNodesCount == graph.getNodesCount());
+
+    IndexedBinaryHeap<Compare> heap{mNodesCount};
+
+    mPrecedingNodes.assign(mNodesCount, scNullNode);
+    mIsAddedToTree.assign(mNodesCount, false);
+
+    // each node not reached from previous start nodes begins a new tree (graph broken into separate parts)
+    for (Node startNode{0}; startNode < mNodesCount; ++startNode)
+    {
+        if (mIsAddedToTree[startNode])
+        {
+            continue;
+        }
+
+        Node currentNode{startNode};
+        mIsAddedToTree[currentNode] = true;
+
+        for (;;)
+        {
+            for (const auto& neighbor : graph.getNeighbors(currentNode))
+            {
+                if (!mIsAddedToTree[neighbor.mNode] && heap.pushOrUpdate(neighbor.mNode, neighbor.mCost))
+                {
+                    mPrecedingNodes[neighbor.mNode] = currentNode;
+                }
+            }
+
+            if (heap.isEmpty())
+            {
+                break;
+            }
+
+            currentNode = heap.pop().first;
+            mIsAddedToTree[currentNode] = true;
+        }
+    }
+
+    for (Node node{0}; node < mNodesCount; ++node)
+    {
+        if (const Node c_PrecedingNode{mPrecedingNodes[node]}; c_PrecedingNode != scNullNode)
+        {
+            tree.push_back(Edge{c_PrecedingNode, node});
+        }
+    }
+}
+
+void SparsePrimEngine::_reset()
+{
+    BaseEngine::_reset();
+
+    mPrecedingNodes.clear();
+    mIsAddedToTree.clear();
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "baseengine.h"
+#include "sparsegraph.h"
+
+/* Prim variant intended for large sparse graphs:
+   - the graph is stored as adjacency lists (CSR) instead of a matrix
+   - the next node to be added to the tree is retrieved from a binary heap (decrease-key when a neighbor gets a better
+   cost) instead of scanning all nodes, which results in O(E * log(V)) complexity instead of O(V^2)
+   - for graphs broken into separate parts a tree is built for each part (same as for PrimEngine)
+*/
+class SparsePrimEngine : public BaseEngine
+{
+public:
+    explicit SparsePrimEngine();
+    bool buildTrees(const GraphMatrix& graphMatrix) override;
+    bool buildTrees(const SparseGraph& graph);
+
+private:
+    template <typename Compare> void _buildTreeFromGraph(const SparseGraph& graph, Tree& tree);
+    void _reset() override;
+
+    static constexpr Node scNullNode{std::numeric_limits<Node>::max()};
+
+    std::vector<Node> mPrecedingNodes;
+    std::vector<bool> mIsAddedToTree;
+};
@@ -0,0 +1,19 @@
+/* Same as the Prim application, however the graph is provided as an edge list (instead of a matrix) and stored as
+   adjacency lists. The next node to be added is retrieved from a heap instead of scanning all nodes. This makes the
+   application suitable for very large sparse graphs (e.g. millions of nodes).
+*/
+
+#include "sparseprim.h"
+#include "utils.h"
+
+static const std::string c_InFile{Utilities::c_InputOutputDir + "sparsegraphinput.txt"};
+static const std::string c_OutFile{Utilities::c_InputOutputDir + "sparseprimoutput.txt"};
+
+extern int sparseTreeAppMain(const std::string& inputFile, const std::string& outputFile,
+                             SparsePrimEngine& treeEngine);
+
+int main()
+{
+    SparsePrimEngine sparsePrimEngine;
+    return sparseTreeAppMain(c_InFile, c_OutFile, sparsePrimEngine);
+}
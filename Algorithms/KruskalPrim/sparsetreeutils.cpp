@@ -0,0 +1,101 @@
+#include <cassert>
+#include <fstream>
+
+#include "sparseprim.h"
+#include "utils.h"
+
+static void writeTreeToFile(std::ofstream& out, const SparseGraph& graph, const Tree& tree)
+{
+    if (out.is_open())
+    {
+        Cost totalCost{0};
+
+        if (!tree.empty())
+        {
+            for (const auto& edge : tree)
+            {
+                const std::optional<Cost> c_CurrentEdgeCost{graph.getEdgeCost(edge)};
+                assert(c_CurrentEdgeCost.has_value());
+
+                totalCost += c_CurrentEdgeCost.value_or(0);
+
+                out << "(" << (edge.first + 1) << "," << (edge.second + 1)
+                    << ") - cost: " << c_CurrentEdgeCost.value_or(0) << "\n";
+            }
+
+            out << "\nTotal cost: " << totalCost << "\n\n";
+        }
+        else
+        {
+            out << "No edges could be found\n";
+        }
+    }
+    else
+    {
+        assert(false);
+    }
+}
+
+// same as treeAppMain, however the graph is read as an edge list (see sparsegraph.h for the format)
+int sparseTreeAppMain(const std::string& inputFile, const std::string& outputFile, SparsePrimEngine& treeEngine)
+{
+    const std::string c_AlgorithmName{treeEngine.getName()};
+
+    std::ifstream in{inputFile};
+    std::ofstream out{outputFile};
+
+    Utilities::clearScreen();
+
+    if (in.is_open() && out.is_open())
+    {
+        SparseGraph graph;
+        in >> graph;
+
+        if (!graph.isEmpty())
+        {
+            bool success{treeEngine.buildTrees(graph)};
+
+            if (success)
+            {
+                out << "The " << c_AlgorithmName << " MINIMUM cost tree edges are: \n\n";
+
+                writeTreeToFile(out, graph, treeEngine.getMinTree());
+
+                out << "========================================\n\n";
+                out << "The " << c_AlgorithmName << " MAXIMUM cost tree edges are: \n\n";
+
+                writeTreeToFile(out, graph, treeEngine.getMaxTree());
+
+                const size_t c_RequiredEdgesCount{graph.getNodesCount() - 1};
+
+                if (c_RequiredEdgesCount == treeEngine.getMinTree().size())
+                {
+                    std::cout << c_AlgorithmName << " minimum and maximum cost trees successfully written to: \n\n"
+                              << outputFile << "\n\n";
+                }
+                else
+                {
+                    std::cout << "The " << c_AlgorithmName
+                              << " minimum and maximum cost trees have been incompletely built (insufficient edges "
+                                 "provided)\n\n";
+                    std::cout << "Please check input file: \n\n" << inputFile << "\n\n";
+                }
+            }
+            else
+            {
+                std::cerr << "Invalid input provided\n\nPlease check input file: \n\n" << inputFile << "\n\n";
+            }
+        }
+        else
+        {
+            std::cerr << "Error! The graph is either empty or invalid\n\nPlease check input file: \n\n"
+                      << inputFile << "\n\n";
+        }
+    }
+    else
+    {
+        std::cerr << "Error in opening input and/or output file\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <numeric>
+
+#include "unionfindkruskal.h"
+
+static constexpr size_t c_RadixBitsCount{8};
+static constexpr size_t c_RadixBucketsCount{size_t{1} << c_RadixBitsCount};
+
+UnionFindKruskalEngine::UnionFindKruskalEngine()
+    : BaseEngine{"Union-find Kruskal"}
+{
+}
+
+bool UnionFindKruskalEngine::buildTrees(const GraphMatrix& graphMatrix)
+{
+    bool success{false};
+
+    _reset();
+
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        _buildGraph(graphMatrix);
+        _sortEdgesByCost();
+        _buildMinTreeFromGraph();
+        _buildMaxTreeFromGraph();
+
+        success = true;
+    }
+
+    return success;
+}
+
+bool UnionFindKruskalEngine::buildTrees(size_t nodesCount, WeightedEdges edges)
+{
+    bool success{false};
+
+    _reset();
+
+    const bool c_AreEdgesValid{std::all_of(edges.cbegin(), edges.cend(), [nodesCount](const WeightedEdge& edge) {
+        return edge.mEdge.first < nodesCount && edge.mEdge.second < nodesCount;
+    })};
+
+    if (nodesCount > 0 && c_AreEdgesValid)
+    {
+        mNodesCount = nodesCount;
+        mEdges = std::move(edges);
+
+        _sortEdgesByCost();
+        _buildMinTreeFromGraph();
+        _buildMaxTreeFromGraph();
+
+        success = true;
+    }
+
+    return success;
+}
+
+/* Edges are added in the same order as for KruskalEngine (row by row, upper half of the matrix), which (along with the
+   stability of the sorting algorithm) ensures the same tree is obtained when multiple edges have the same cost.
+*/
+void UnionFindKruskalEngine::_buildGraph(const GraphMatrix& graphMatrix)
+{
+    const matrix_size_t c_RowsCount{graphMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == graphMatrix.getNrOfColumns())
+    {
+        mNodesCount = c_RowsCount;
+
+        for (matrix_size_t row{0}; row < c_RowsCount - 1; ++row)
+        {
+            for (Matrix<Cost>::ConstZIterator it{graphMatrix.getConstZIterator(row, row + 1)};
+                 it != graphMatrix.constZRowEnd(row); ++it)
+            {
+                if (*it != 0)
+                {
+                    mEdges.push_back(WeightedEdge{Edge{*it.getRowNr(), *it.getColumnNr()}, *it});
+                }
+            }
+        }
+    }
+    else
+    {
+        assert(false);
+    }
+}
+
+/* LSD radix sort (stable), one byte of the cost per pass:
+   - only the bytes up to the most significant one of the highest cost are taken into account
+   - passes for which all edges have the same byte value are skipped (nothing would change)
+*/
+void UnionFindKruskalEngine::_sortEdgesByCost()
+{
+    if (mEdges.size() > 1)
+    {
+        const Cost c_MaxCost{
+            std::max_element(mEdges.cbegin(), mEdges.cend(), [](const WeightedEdge& first, const WeightedEdge& second) {
+                return first.mCost < second.mCost;
+            })->mCost};
+
+        WeightedEdges buffer(mEdges.size());
+
+        for (size_t shift{0}; shift < sizeof(Cost) * 8 && (c_MaxCost >> shift) > 0; shift += c_RadixBitsCount)
+        {
+            std::array<size_t, c_RadixBucketsCount> bucketOffsets{};
+
+            for (const auto& edge : mEdges)
+            {
+                ++bucketOffsets[(edge.mCost >> shift) & (c_RadixBucketsCount - 1)];
+            }
+
+            if (std::find(bucketOffsets.cbegin(), bucketOffsets.cend(), mEdges.size()) != bucketOffsets.cend())
+            {
+                continue;
+            }
+
+            std::exclusive_scan(bucketOffsets.cbegin(), bucketOffsets.cend(), bucketOffsets.begin(), size_t{0});
+
+            for (const auto& edge : mEdges)
+            {
+                buffer[bucketOffsets[(edge.mCost >> shift) & (c_RadixBucketsCount - 1)]++] = edge;
+            }
+
+            mEdges.swap(buffer);
+        }
+    }
+}
+
+void UnionFindKruskalEngine::_buildMinTreeFromGraph()
+{
+    assert(mNodesCount > 0);
+
+    if (mNodesCount > 0)
+    {
+        _buildDisjointSets();
+
+        size_t requiredEdgesCount{mNodesCount - 1};
+
+        for (auto it{mEdges.cbegin()}; it != mEdges.cend() && requiredEdgesCount > 0; ++it)
+        {
+            if (_addEdgeToTree(it->mEdge))
+            {
+                mMinTree.push_back(it->mEdge);
+                --requiredEdgesCount;
+            }
+        }
+    }
+}
+
+void UnionFindKruskalEngine::_buildMaxTreeFromGraph()
+{
+    assert(mNodesCount > 0);
+
+    if (mNodesCount > 0)
+    {
+        _buildDisjointSets();
+
+        size_t requiredEdgesCount{mNodesCount - 1};
+
+        for (auto it{mEdges.crbegin()}; it != mEdges.crend() && requiredEdgesCount > 0; ++it)
+        {
+            if (_addEdgeToTree(it->mEdge))
+            {
+                mMaxTree.push_back(it->mEdge);
+                --requiredEdgesCount;
+            }
+        }
+    }
+}
+
+// initially each node is the root of its own set
+void UnionFindKruskalEngine::_buildDisjointSets()
+{
+    mParents.resize(mNodesCount);
+    std::iota(mParents.begin(), mParents.end(), Node{0});
+
+    mRanks.assign(mNodesCount, 0);
+}
+
+void UnionFindKruskalEngine::_reset()
+{
+    BaseEngine::_reset();
+
+    mEdges.clear();
+    mParents.clear();
+    mRanks.clear();
+}
+
+/* An edge can only be added if its nodes belong to different sets (otherwise a loop would be created). In this case the
+   sets are united by attaching the root of the lower rank tree to the root of the higher rank one.
+*/
+bool UnionFindKruskalEngine::_addEdgeToTree(const Edge& edge)
+{
+    bool success{false};
+
+    Node firstRoot{_findRoot(edge.first)};
+    Node secondRoot{_findRoot(edge.second)};
+
+    if (firstRoot != secondRoot)
+    {
+        if (mRanks[firstRoot] < mRanks[secondRoot])
+        {
+            std::swap(firstRoot, secondRoot);
+        }
+
+        mParents[secondRoot] = firstRoot;
+
+        if (mRanks[firstRoot] == mRanks[secondRoot])
+        {
+            ++mRanks[firstRoot];
+        }
+
+        success = true;
+    }
+
+    return success;
+}
+
+// path halving: each visited node gets linked to its grandparent, which flattens the tree while searching for the root
+Node UnionFindKruskalEngine::_findRoot(Node node)
+{
+    while (mParents[node] != node)
+    {
+        mParents[node] = mParents[mParents[node]];
+        node = mParents[node];
+    }
+
+    return node;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "baseengine.h"
+
+/* Kruskal variant intended for large graphs:
+   - the edges are stored in a flat array that gets sorted only once (radix sort by cost) and is then traversed in both
+   directions for building the minimum and the maximum cost tree
+   - the components are handled by using a disjoint set (union-find) with path compression and union by rank
+   - the resulting trees are identical to the ones built by KruskalEngine (same edges, same order)
+*/
+class UnionFindKruskalEngine : public BaseEngine
+{
+public:
+    explicit UnionFindKruskalEngine();
+    bool buildTrees(const GraphMatrix& graphMatrix) override;
+
+    // allows skipping the matrix entirely (node numbers of the edges should be lower than the nodes count)
+    bool buildTrees(size_t nodesCount, WeightedEdges edges);
+
+private:
+    void _buildGraph(const GraphMatrix& graphMatrix);
+    void _sortEdgesByCost();
+    void _buildMinTreeFromGraph();
+    void _buildMaxTreeFromGraph();
+    void _buildDisjointSets();
+    void _reset() override;
+
+    bool _addEdgeToTree(const Edge& edge);
+    Node _findRoot(Node node);
+
+    WeightedEdges mEdges;
+    std::vector<Node> mParents;
+    std::vector<uint8_t> mRanks;
+};
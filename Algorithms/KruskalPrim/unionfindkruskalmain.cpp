@@ -0,0 +1,18 @@
+/* Same as the Kruskal application, however the trees are built by using a disjoint set (union-find) instead of merging
+   lists of nodes and the edges are sorted once (radix sort) instead of being stored in an ordered map. This makes the
+   application suitable for graphs with a very large number of edges.
+*/
+
+#include "unionfindkruskal.h"
+#include "utils.h"
+
+static const std::string c_InFile{Utilities::c_InputOutputDir + "kruskalpriminput.txt"};
+static const std::string c_OutFile{Utilities::c_InputOutputDir + "unionfindkruskaloutput.txt"};
+
+extern int treeAppMain(const std::string& inputFile, const std::string& outputFile, BaseEngine& treeEngine);
+
+int main()
+{
+    UnionFindKruskalEngine unionFindKruskalEngine;
+    return treeAppMain(c_InFile, c_OutFile, unionFindKruskalEngine);
+}
@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cassert>
+
+#include "countriesgraph.h"
+
+CountriesGraph::CountriesGraph(const Matrix<bool>& neighbourhoodMatrix)
+{
+    const matrix_size_t c_RowsCount{neighbourhoodMatrix.getNrOfRows()};
+
+    if (c_RowsCount > 0 && c_RowsCount == neighbourhoodMatrix.getNrOfColumns())
+    {
+        Neighbourships neighbourships;
+
+        // the matrix is symmetric so only the upper half is taken into account
+        for (matrix_size_t row{0}; row < c_RowsCount - 1; ++row)
+        {
+            for (Matrix<bool>::ConstZIterator it{neighbourhoodMatrix.getConstZIterator(row, row + 1)};
+                 it != neighbourhoodMatrix.constZRowEnd(row); ++it)
+            {
+                if (*it)
+                {
+                    neighbourships.emplace_back(*it.getRowNr(), *it.getColumnNr());
+                }
+            }
+        }
+
+        build(c_RowsCount, neighbourships);
+    }
+}
+
+bool CountriesGraph::build(size_t countriesCount, const Neighbourships& neighbourships)
+{
+    bool success{false};
+
+    clear();
+
+    do
+    {
+        if (countriesCount == 0)
+        {
+            break;
+        }
+
+        const bool c_AreNeighbourshipsValid{std::all_of(
+            neighbourships.cbegin(), neighbourships.cend(), [countriesCount](const Neighbourship& neighbourship) {
+                const auto& [first, second]{neighbourship};
+                return first < countriesCount && second < countriesCount && first != second;
+            })};
+
+        if (!c_AreNeighbourshipsValid)
+        {
+            break;
+        }
+
+        // count the neighbours of each country, then convert the counts into offsets
+        m_Offsets.assign(countriesCount + 1, 0);
+
+        for (const auto& [first, second] : neighbourships)
+        {
+            ++m_Offsets[first + 1];
+            ++m_Offsets[second + 1];
+        }
+
+        for (Country country{0}; country < countriesCount; ++country)
+        {
+            m_MaxNeighboursCount = std::max(m_MaxNeighboursCount, m_Offsets[country + 1]);
+            m_Offsets[country + 1] += m_Offsets[country];
+        }
+
+        m_Neighbours.resize(m_Offsets.back());
+        std::vector<size_t> insertionOffsets{m_Offsets.cbegin(), m_Offsets.cend() - 1};
+
+        for (const auto& [first, second] : neighbourships)
+        {
+            m_Neighbours[insertionOffsets[first]++] = second;
+            m_Neighbours[insertionOffsets[second]++] = first;
+        }
+
+        bool hasDuplicateNeighbourships{false};
+
+        for (Country country{0}; country < countriesCount && !hasDuplicateNeighbourships; ++country)
+        {
+            const auto c_NeighboursBeginIt{m_Neighbours.begin() + m_Offsets[country]};
+            const auto c_NeighboursEndIt{m_Neighbours.begin() + m_Offsets[country + 1]};
+
+            std::sort(c_NeighboursBeginIt, c_NeighboursEndIt);
+            hasDuplicateNeighbourships =
+                std::adjacent_find(c_NeighboursBeginIt, c_NeighboursEndIt) != c_NeighboursEndIt;
+        }
+
+        if (hasDuplicateNeighbourships)
+        {
+            clear();
+            break;
+        }
+
+        success = true;
+    } while (false);
+
+    return success;
+}
+
+void CountriesGraph::clear()
+{
+    m_Offsets.clear();
+    m_Neighbours.clear();
+    m_MaxNeighboursCount = 0;
+}
+
+bool CountriesGraph::areNeighbours(Country first, Country second) const
+{
+    bool result{false};
+
+    if (first < getCountriesCount() && second < getCountriesCount())
+    {
+        const std::span<const Country> c_Neighbours{getNeighbours(first)};
+        result = std::binary_search(c_Neighbours.begin(), c_Neighbours.end(), second);
+    }
+
+    return result;
+}
+
+std::span<const CountriesGraph::Country> CountriesGraph::getNeighbours(Country country) const
+{
+    std::span<const Country> result;
+
+    if (country < getCountriesCount())
+    {
+        result = std::span<const Country>{m_Neighbours.data() + m_Offsets[country],
+                                          m_Offsets[country + 1] - m_Offsets[country]};
+    }
+    else
+    {
+        assert(false);
+    }
+
+    return result;
+}
+
+size_t CountriesGraph::getCountriesCount() const
+{
+    return m_Offsets.empty() ? 0 : m_Offsets.size() - 1;
+}
+
+size_t CountriesGraph::getNeighbourshipsCount() const
+{
+    return m_Neighbours.size() / 2;
+}
+
+size_t CountriesGraph::getMaxNeighboursCount() const
+{
+    return m_MaxNeighboursCount;
+}
+
+bool CountriesGraph::isEmpty() const
+{
+    return m_Offsets.empty();
+}
+
+std::istream& operator>>(std::istream& in, CountriesGraph& graph)
+{
+    size_t countriesCount{0};
+    CountriesGraph::Neighbourships neighbourships;
+    bool isInputValid{false};
+
+    do
+    {
+        in >> countriesCount;
+
+        if (in.fail() || countriesCount == 0)
+        {
+            break;
+        }
+
+        isInputValid = true;
+
+        for (;;)
+        {
+            CountriesGraph::Country first{0};
+            CountriesGraph::Country second{0};
+
+            if (!(in >> first))
+            {
+                // reaching the end of input is the only acceptable way of ending the neighbourships list
+                isInputValid = in.eof();
+                break;
+            }
+
+            in >> second;
+
+            if (in.fail())
+            {
+                isInputValid = false;
+                break;
+            }
+
+            neighbourships.emplace_back(first, second);
+        }
+    } while (false);
+
+    if (!isInputValid || !graph.build(countriesCount, neighbourships))
+    {
+        graph.clear();
+    }
+
+    return in;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <iostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "matrix.h"
+
+/* Neighbourhood graph of the countries to be coloured:
+   - the neighbours of each country are stored in a single array (compressed sparse row format), sorted by country
+   index, so they can be traversed without scanning all other countries (and neighbourhood queries are binary searches)
+   - self-neighbourships and duplicate neighbourships are not allowed
+*/
+class CountriesGraph
+{
+public:
+    using Country = size_t;
+    using Neighbourship = std::pair<Country, Country>;
+    using Neighbourships = std::vector<Neighbourship>;
+
+    explicit CountriesGraph() = default;
+
+    // the matrix should be a valid neighbourhood matrix (see MapColouringUtils::isValidNeighbourhoodMatrix())
+    explicit CountriesGraph(const Matrix<bool>& neighbourhoodMatrix);
+
+    // returns false (graph remains empty) for invalid neighbourships: out of range, self-neighbourships, duplicates
+    bool build(size_t countriesCount, const Neighbourships& neighbourships);
+    void clear();
+
+    bool areNeighbours(Country first, Country second) const;
+    std::span<const Country> getNeighbours(Country country) const;
+
+    size_t getCountriesCount() const;
+    size_t getNeighbourshipsCount() const;
+    size_t getMaxNeighboursCount() const;
+    bool isEmpty() const;
+
+private:
+    std::vector<size_t> m_Offsets;
+    std::vector<Country> m_Neighbours;
+    size_t m_MaxNeighboursCount{0};
+};
+
+/* Neighbourships list format:
+   - first number is the countries count
+   - followed by one line per neighbourship: first country, second country (countries numbered from 0)
+   - the graph is cleared if the input is invalid
+*/
+std::istream& operator>>(std::istream& in, CountriesGraph& graph);
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+
+#include "graphcolouring.h"
+
+using Country = CountriesGraph::Country;
+using namespace GraphColouring;
+
+static constexpr size_t c_BitsPerWord{64};
+static constexpr size_t c_CountriesPerChunk{4096};
+
+// the chunks are claimed dynamically by the threads so the load remains balanced if the neighbours counts vary
+static void processChunksInParallel(size_t countriesCount, size_t threadsCount,
+                                    const std::function<void(size_t, size_t, size_t)>& processChunk)
+{
+    std::atomic<size_t> nextChunkBegin{0};
+
+    auto processChunks{[&](size_t threadIndex) {
+        for (;;)
+        {
+            const size_t c_ChunkBegin{nextChunkBegin.fetch_add(c_CountriesPerChunk)};
+
+            if (c_ChunkBegin >= countriesCount)
+            {
+                break;
+            }
+
+            processChunk(threadIndex, c_ChunkBegin, std::min(c_ChunkBegin + c_CountriesPerChunk, countriesCount));
+        }
+    }};
+
+    std::vector<std::thread> threads;
+
+    for (size_t threadIndex{1}; threadIndex < threadsCount; ++threadIndex)
+    {
+        threads.emplace_back(processChunks, threadIndex);
+    }
+
+    processChunks(0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/* One bitmask per country, bit i being set if colour i is used by at least one of the coloured neighbours:
+   - a country cannot get a colour larger than its neighbours count (all lower colours would need to be in use by the
+   neighbours), so the masks have a fixed size which is determined by the maximum neighbours count
+   - all masks are stored within the same array
+*/
+class ForbiddenColours
+{
+public:
+    explicit ForbiddenColours(size_t countriesCount, size_t maxNeighboursCount)
+        : m_WordsPerCountry{maxNeighboursCount / c_BitsPerWord + 1}
+        , m_Masks(countriesCount * m_WordsPerCountry, 0)
+    {
+    }
+
+    // returns true if the colour was not forbidden before for the given country
+    bool forbid(Country country, Colour colour)
+    {
+        assert(colour < m_WordsPerCountry * c_BitsPerWord);
+
+        uint64_t& word{m_Masks[country * m_WordsPerCountry + colour / c_BitsPerWord]};
+        const uint64_t c_Bit{uint64_t{1} << (colour % c_BitsPerWord)};
+        const bool c_IsNewlyForbidden{(word & c_Bit) == 0};
+
+        word |= c_Bit;
+
+        return c_IsNewlyForbidden;
+    }
+
+    Colour getFirstAllowedColour(Country country) const
+    {
+        Colour result{c_NoColour};
+        const uint64_t* const c_Mask{m_Masks.data() + country * m_WordsPerCountry};
+
+        for (size_t wordIndex{0}; wordIndex < m_WordsPerCountry; ++wordIndex)
+        {
+            if (c_Mask[wordIndex] != ~uint64_t{0})
+            {
+                result = wordIndex * c_BitsPerWord + static_cast<size_t>(std::countr_one(c_Mask[wordIndex]));
+                break;
+            }
+        }
+
+        assert(result != c_NoColour);
+
+        return result;
+    }
+
+private:
+    size_t m_WordsPerCountry;
+    std::vector<uint64_t> m_Masks;
+};
+
+struct DSaturCandidate
+{
+    size_t m_Saturation;
+    size_t m_UncolouredNeighboursCount;
+    Country m_Country;
+
+    // lower priority: lower saturation, less uncoloured neighbours, higher index
+    bool operator<(const DSaturCandidate& other) const
+    {
+        return m_Saturation != other.m_Saturation ? m_Saturation < other.m_Saturation
+               : m_UncolouredNeighboursCount != other.m_UncolouredNeighboursCount
+                   ? m_UncolouredNeighboursCount < other.m_UncolouredNeighboursCount
+                   : m_Country > other.m_Country;
+    }
+};
+
+Colours GraphColouring::colourGreedily(const CountriesGraph& graph)
+{
+    const size_t c_CountriesCount{graph.getCountriesCount()};
+
+    Colours colours(c_CountriesCount, c_NoColour);
+    ForbiddenColours forbiddenColours{c_CountriesCount, graph.getMaxNeighboursCount()};
+
+    for (Country country{0}; country < c_CountriesCount; ++country)
+    {
+        const Colour c_Colour{forbiddenColours.getFirstAllowedColour(country)};
+        colours[country] = c_Colour;
+
+        // neighbours are sorted by index so the uncoloured ones are located at the end
+        const std::span<const Country> c_Neighbours{graph.getNeighbours(country)};
+
+        for (auto it{std::upper_bound(c_Neighbours.begin(), c_Neighbours.end(), country)}; it != c_Neighbours.end();
+             ++it)
+        {
+            forbiddenColours.forbid(*it, c_Colour);
+        }
+    }
+
+    return colours;
+}
+
+Colours GraphColouring::colourWithDSatur(const CountriesGraph& graph)
+{
+    const size_t c_CountriesCount{graph.getCountriesCount()};
+
+    Colours colours(c_CountriesCount, c_NoColour);
+    ForbiddenColours forbiddenColours{c_CountriesCount, graph.getMaxNeighboursCount()};
+    std::vector<size_t> saturations(c_CountriesCount, 0);
+    std::vector<size_t> uncolouredNeighboursCounts(c_CountriesCount);
+
+    // outdated candidates are not removed from queue when the saturation or uncoloured neighbours count of a country
+    // changes (a new candidate is added instead) but discarded when reaching the top
+    std::priority_queue<DSaturCandidate> candidates;
+
+    for (Country country{0}; country < c_CountriesCount; ++country)
+    {
+        uncolouredNeighboursCounts[country] = graph.getNeighbours(country).size();
+        candidates.push(DSaturCandidate{0, uncolouredNeighboursCounts[country], country});
+    }
+
+    while (!candidates.empty())
+    {
+        const DSaturCandidate c_Candidate{candidates.top()};
+        const Country c_Country{c_Candidate.m_Country};
+
+        candidates.pop();
+
+        const bool c_IsOutdated{colours[c_Country] != c_NoColour ||
+                                c_Candidate.m_Saturation != saturations[c_Country] ||
+                                c_Candidate.m_UncolouredNeighboursCount != uncolouredNeighboursCounts[c_Country]};
+
+        if (c_IsOutdated)
+        {
+            continue;
+        }
+
+        const Colour c_Colour{forbiddenColours.getFirstAllowedColour(c_Country)};
+        colours[c_Country] = c_Colour;
+
+        for (const Country neighbour : graph.getNeighbours(c_Country))
+        {
+            if (colours[neighbour] == c_NoColour)
+            {
+                --uncolouredNeighboursCounts[neighbour];
+
+                if (forbiddenColours.forbid(neighbour, c_Colour))
+                {
+                    ++saturations[neighbour];
+                }
+
+                candidates.push(
+                    DSaturCandidate{saturations[neighbour], uncolouredNeighboursCounts[neighbour], neighbour});
+            }
+        }
+    }
+
+    return colours;
+}
+
+Colours GraphColouring::colourInParallel(const CountriesGraph& graph, size_t threadsCount)
+{
+    const size_t c_CountriesCount{graph.getCountriesCount()};
+    const size_t c_ChunksCount{(c_CountriesCount + c_CountriesPerChunk - 1) / c_CountriesPerChunk};
+    const size_t c_ThreadsCount{std::max<size_t>(std::min(c_ChunksCount, threadsCount), 1)};
+
+    std::vector<std::atomic<Colour>> sharedColours(c_CountriesCount);
+
+    for (auto& colour : sharedColours)
+    {
+        colour.store(c_NoColour, std::memory_order_relaxed);
+    }
+
+    /* Each thread marks the colours used by the neighbours of the currently coloured country within its own array:
+       - colour i is forbidden if markers[i] equals the marker of the current country
+       - a new marker value is used for each coloured country so the array doesn't need to be reset
+    */
+    std::vector<std::vector<size_t>> forbiddenColourMarkers(
+        c_ThreadsCount, std::vector<size_t>(graph.getMaxNeighboursCount() + 1, 0));
+    std::vector<size_t> currentMarkers(c_ThreadsCount, 0);
+    std::vector<std::vector<Country>> threadConflicts(c_ThreadsCount);
+
+    std::vector<Country> uncolouredCountries(c_CountriesCount);
+    std::iota(uncolouredCountries.begin(), uncolouredCountries.end(), 0);
+
+    while (!uncolouredCountries.empty())
+    {
+        // speculative colouring (concurrently coloured neighbours are not taken into account)
+        auto colourChunk{[&](size_t threadIndex, size_t begin, size_t end) {
+            std::vector<size_t>& markers{forbiddenColourMarkers[threadIndex]};
+            size_t& currentMarker{currentMarkers[threadIndex]};
+
+            for (size_t index{begin}; index < end; ++index)
+            {
+                const Country c_Country{uncolouredCountries[index]};
+                ++currentMarker;
+
+                for (const Country neighbour : graph.getNeighbours(c_Country))
+                {
+                    const Colour c_NeighbourColour{sharedColours[neighbour].load(std::memory_order_relaxed)};
+
+                    // a country cannot get a colour larger than its neighbours count
+                    if (c_NeighbourColour < markers.size())
+                    {
+                        markers[c_NeighbourColour] = currentMarker;
+                    }
+                }
+
+                Colour colour{0};
+
+                while (markers[colour] == currentMarker)
+                {
+                    ++colour;
+                }
+
+                sharedColours[c_Country].store(colour, std::memory_order_relaxed);
+            }
+        }};
+
+        processChunksInParallel(uncolouredCountries.size(), c_ThreadsCount, colourChunk);
+
+        // conflicts detection: the higher index country of each conflicting pair is recoloured
+        auto detectConflictsInChunk{[&](size_t threadIndex, size_t begin, size_t end) {
+            for (size_t index{begin}; index < end; ++index)
+            {
+                const Country c_Country{uncolouredCountries[index]};
+                const Colour c_Colour{sharedColours[c_Country].load(std::memory_order_relaxed)};
+                const std::span<const Country> c_Neighbours{graph.getNeighbours(c_Country)};
+
+                // neighbours are sorted by index
+                const bool c_HasConflict{std::any_of(
+                    c_Neighbours.begin(), std::lower_bound(c_Neighbours.begin(), c_Neighbours.end(), c_Country),
+                    [&sharedColours, c_Colour](Country neighbour) {
+                        return sharedColours[neighbour].load(std::memory_order_relaxed) == c_Colour;
+                    })};
+
+                if (c_HasConflict)
+                {
+                    threadConflicts[threadIndex].push_back(c_Country);
+                }
+            }
+        }};
+
+        processChunksInParallel(uncolouredCountries.size(), c_ThreadsCount, detectConflictsInChunk);
+
+        uncolouredCountries.clear();
+
+        for (auto& conflicts : threadConflicts)
+        {
+            uncolouredCountries.insert(uncolouredCountries.end(), conflicts.cbegin(), conflicts.cend());
+            conflicts.clear();
+        }
+
+        std::sort(uncolouredCountries.begin(), uncolouredCountries.end());
+    }
+
+    Colours colours(c_CountriesCount);
+
+    for (Country country{0}; country < c_CountriesCount; ++country)
+    {
+        colours[country] = sharedColours[country].load(std::memory_order_relaxed);
+    }
+
+    return colours;
+}
+
+size_t GraphColouring::getColoursCount(const Colours& colours)
+{
+    // the algorithms use all colours between 0 and the maximum one
+    return colours.empty() ? 0 : *std::max_element(colours.cbegin(), colours.cend()) + 1;
+}
+
+bool GraphColouring::isValidColouring(const CountriesGraph& graph, const Colours& colours)
+{
+    bool isValid{colours.size() == graph.getCountriesCount()};
+
+    for (Country country{0}; isValid && country < colours.size(); ++country)
+    {
+        const std::span<const Country> c_Neighbours{graph.getNeighbours(country)};
+        const Colour c_Colour{colours[country]};
+
+        isValid = c_Colour != c_NoColour &&
+                  std::none_of(c_Neighbours.begin(), c_Neighbours.end(),
+                               [&colours, c_Colour](Country neighbour) { return colours[neighbour] == c_Colour; });
+    }
+
+    return isValid;
+}
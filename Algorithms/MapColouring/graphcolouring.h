@@ -0,0 +1,45 @@
+#pragma once
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "countriesgraph.h"
+
+/* Colouring algorithms for the countries graph (neighbouring countries get different colours):
+   - the colours are represented as indexes starting from 0, the colour of each country being stored at the country
+   index
+   - for the sequential algorithms the colours used by the already coloured neighbours of each country are tracked
+   within a bitmask (per country), so the lowest available colour is found by scanning a few words instead of all
+   previously coloured countries
+   - all algorithms are greedy so the optimal solution is not guaranteed
+*/
+namespace GraphColouring
+{
+using Colour = size_t;
+using Colours = std::vector<Colour>;
+
+static constexpr Colour c_NoColour{std::numeric_limits<Colour>::max()};
+
+// countries are coloured in index order, each one getting the lowest colour not used by its neighbours
+Colours colourGreedily(const CountriesGraph& graph);
+
+/* DSatur: the next country to be coloured is the one having the largest number of different colours among its
+   neighbours (saturation), ties being broken by the number of uncoloured neighbours and then by the lowest index;
+   usually requires less colours than the index order greedy colouring
+*/
+Colours colourWithDSatur(const CountriesGraph& graph);
+
+/* Speculative parallel colouring (suitable for very large graphs):
+   - the countries are distributed among threads and each of them gets the lowest colour not used by its neighbours;
+   as neighbours might be coloured at the same time by different threads, they could get the same colour
+   - the conflicting countries (having the same colour as a lower index neighbour) are collected and recoloured in the
+   next round, which is repeated until no conflicts remain
+   - the number of used colours is similar to the index order greedy colouring, however the exact colouring might
+   differ between runs
+*/
+Colours colourInParallel(const CountriesGraph& graph, size_t threadsCount = std::thread::hardware_concurrency());
+
+size_t getColoursCount(const Colours& colours);
+bool isValidColouring(const CountriesGraph& graph, const Colours& colours);
+} // namespace GraphColouring
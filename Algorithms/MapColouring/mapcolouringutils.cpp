@@ -1,5 +1,3 @@
-#include <cassert>
-
 #include "mapcolouringutils.h"
 
 bool MapColouringUtils::isValidNeighbourhoodMatrix(Matrix<bool> neighbours)
@@ -22,28 +20,15 @@ bool MapColouringUtils::isValidNeighbourhoodMatrix(Matrix<bool> neighbours)
     return isValid;
 }
 
-std::optional<matrix_size_t> MapColouringUtils::getFirstAvailableColour(const Matrix<bool>& availableColours)
+void MapColouringUtils::printCountryColoursToFile(std::ofstream& output, const GraphColouring::Colours& countryColours)
 {
-    // lowest index colour that is not used by a country
-    std::optional<matrix_size_t> firstAvailableColour;
+    output << countryColours.size() << " countries, " << GraphColouring::getColoursCount(countryColours) << " colours"
+           << std::endl
+           << std::endl;
+    output << "Colour mapping ordered by country index:" << std::endl << std::endl;
 
-    if (availableColours.getNrOfRows() == 1)
-    {
-        // choose colour with lowest index that is not in use by a neighbor
-        for (Matrix<bool>::ConstZIterator colourIt{availableColours.constZBegin()};
-             colourIt != availableColours.constZEnd(); ++colourIt)
-        {
-            if (false == *colourIt)
-            {
-                firstAvailableColour = *colourIt.getColumnNr();
-                break;
-            }
-        }
-    }
-    else
+    for (size_t country{0}; country < countryColours.size(); ++country)
     {
-        assert(false && "Invalid colour availability matrix");
+        output << "Country " << country << " - Colour " << countryColours[country] << std::endl;
     }
-
-    return firstAvailableColour;
 }
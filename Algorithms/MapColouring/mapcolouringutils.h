@@ -1,9 +1,12 @@
 #pragma once
 
+#include <fstream>
+
+#include "graphcolouring.h"
 #include "matrix.h"
 
 namespace MapColouringUtils
 {
 bool isValidNeighbourhoodMatrix(Matrix<bool> neighbours);
-std::optional<matrix_size_t> getFirstAvailableColour(const Matrix<bool>& availableColours);
+void printCountryColoursToFile(std::ofstream& output, const GraphColouring::Colours& countryColours);
 } // namespace MapColouringUtils
@@ -0,0 +1,51 @@
+/* Same as the MapColouring application, however:
+   - the neighbourships are provided as a list (instead of a matrix), see countriesgraph.h for the format
+   - the countries are coloured by multiple threads (speculative colouring, see graphcolouring.h)
+
+   This makes the application suitable for very large neighbourhood graphs (e.g. millions of countries).
+*/
+
+#include <cassert>
+#include <fstream>
+
+#include "graphcolouring.h"
+#include "mapcolouringutils.h"
+#include "utils.h"
+
+static const std::string c_InFile{Utilities::c_InputOutputDir + "neighbourshipsinput.txt"};
+static const std::string c_OutFile{Utilities::c_InputOutputDir + "parallelcountriesoutput.txt"};
+
+int main()
+{
+    std::ifstream in{c_InFile};
+    std::ofstream out{c_OutFile};
+
+    Utilities::clearScreen();
+
+    if (in.is_open() && out.is_open())
+    {
+        CountriesGraph countriesGraph;
+        in >> countriesGraph;
+
+        if (!countriesGraph.isEmpty())
+        {
+            const GraphColouring::Colours c_CountryColours{GraphColouring::colourInParallel(countriesGraph)};
+            assert(GraphColouring::isValidColouring(countriesGraph, c_CountryColours));
+
+            MapColouringUtils::printCountryColoursToFile(out, c_CountryColours);
+
+            std::cout << "Country neighbourships read from: " << c_InFile << std::endl;
+            std::cout << "Determined colour mapping of countries written to: " << c_OutFile << std::endl << std::endl;
+        }
+        else
+        {
+            std::cerr << "Invalid input. Please check input file: " << c_InFile << std::endl << std::endl;
+        }
+    }
+    else
+    {
+        std::cerr << "Error in opening input and/or output file" << std::endl << std::endl;
+    }
+
+    return 0;
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
 #include "matrixutils.h"
 
 /* Unidimensional gathering:
@@ -168,3 +173,355 @@ std::tuple<MatrixPoint, MatrixPoint, matrix_size_t> gatherMatrixElements(
 
     return {innerRectStartingPoint, innerRectEndingPoint, gatheredElementsCount};
 }
+
+/* Bidimensional gathering with reusable buffers:
+   - same results as gatherMatrixElements(): the elements end up in the same positions and the same inner rectangle
+   and gathered elements count are returned
+   - instead of using std::stable_partition (which allocates a temporary buffer on each call) the elements of each
+   row/column range are moved into a scratch buffer and then moved back in gathered order; the buffers are kept between
+   gather() calls
+   - the columns are processed in tiles (groups of adjacent columns) that are copied row-by-row into the scratch buffer,
+   so the matrix is never traversed column-by-column (no strided access)
+   - the rows (and the column tiles) are independent from each other so they can be distributed among multiple threads;
+   in this case the predicate should be safe to be called concurrently
+*/
+
+template <typename DataType>
+class MatrixGatherer
+{
+public:
+    using Predicate = std::function<bool(const DataType&)>;
+
+    // tile columns count computed from the number of rows to be gathered if 0
+    explicit MatrixGatherer(size_t threadsCount = 1, matrix_size_t tileColumnsCount = 0);
+
+    std::tuple<MatrixPoint, MatrixPoint, matrix_size_t> gather(Matrix<DataType>& matrix, MatrixPoint startingPoint,
+                                                               MatrixPoint endingPoint, MatrixPoint gatheringPoint,
+                                                               const Predicate& predicate);
+
+private:
+    struct ScratchBuffer
+    {
+        std::vector<DataType> m_Elements;
+        std::vector<uint8_t> m_PredicateResults;
+        std::vector<matrix_size_t> m_SourceIndexes;
+    };
+
+    // inner rectangle bounds (rows or columns) and gathered elements count resulting from a group of rows or tiles
+    struct PartialResult
+    {
+        matrix_size_t m_InnerRectStart;
+        matrix_size_t m_InnerRectEnd;
+        matrix_size_t m_GatheredElementsCount;
+    };
+
+    template <typename Function>
+    void _runInParallel(matrix_size_t jobsCount, size_t elementsCount, Function function);
+
+    void _gatherRows(Matrix<DataType>& matrix, matrix_size_t firstRowNr, matrix_size_t lastRowNr,
+                     matrix_size_t startingColumnNr, matrix_size_t endingColumnNr, matrix_size_t gatheringColumnNr,
+                     const Predicate& predicate, ScratchBuffer& buffer, PartialResult& result);
+
+    void _gatherColumnsTile(Matrix<DataType>& matrix, matrix_size_t firstColumnNr, matrix_size_t lastColumnNr,
+                            matrix_size_t startingRowNr, matrix_size_t endingRowNr, matrix_size_t gatheringRowNr,
+                            const Predicate& predicate, ScratchBuffer& buffer, PartialResult& result);
+
+    static std::pair<matrix_size_t, matrix_size_t> _computeSourceIndexes(const uint8_t* pPredicateResults,
+                                                                         matrix_size_t elementsCount,
+                                                                         matrix_size_t gatheringIndex,
+                                                                         matrix_size_t* pSourceIndexes);
+
+    static constexpr size_t c_TileSizeInBytes{256 * 1024};
+    static constexpr size_t c_MinElementsCountPerThread{16 * 1024};
+
+    size_t m_ThreadsCount;
+    matrix_size_t m_TileColumnsCount;
+    std::vector<ScratchBuffer> m_ScratchBuffers;
+    std::vector<PartialResult> m_PartialResults;
+};
+
+template <typename DataType>
+MatrixGatherer<DataType>::MatrixGatherer(size_t threadsCount, matrix_size_t tileColumnsCount)
+    : m_ThreadsCount{std::max<size_t>(threadsCount, 1)}
+    , m_TileColumnsCount{tileColumnsCount}
+    , m_ScratchBuffers(m_ThreadsCount)
+    , m_PartialResults(m_ThreadsCount)
+{
+}
+
+template <typename DataType>
+std::tuple<MatrixPoint, MatrixPoint, matrix_size_t> MatrixGatherer<DataType>::gather(Matrix<DataType>& matrix,
+                                                                                     MatrixPoint startingPoint,
+                                                                                     MatrixPoint endingPoint,
+                                                                                     MatrixPoint gatheringPoint,
+                                                                                     const Predicate& predicate)
+{
+    MatrixPoint innerRectStartingPoint{0u, 0u};
+    MatrixPoint innerRectEndingPoint{0u, 0u};
+    matrix_size_t gatheredElementsCount{0u};
+
+    if (!matrix.isEmpty())
+    {
+        // same normalization as for gatherMatrixElements()
+        startingPoint.first =
+            std::clamp(startingPoint.first.has_value() ? *startingPoint.first : 0u, 0u, matrix.getNrOfRows());
+        startingPoint.second =
+            std::clamp(startingPoint.second.has_value() ? *startingPoint.second : 0u, 0u, matrix.getNrOfColumns());
+        endingPoint.first =
+            std::clamp(endingPoint.first.has_value() ? *endingPoint.first : 0u, 0u, matrix.getNrOfRows());
+        endingPoint.second =
+            std::clamp(endingPoint.second.has_value() ? *endingPoint.second : 0u, 0u, matrix.getNrOfColumns());
+
+        matrix_size_t const c_OuterRectStartingRowNr{std::min(*startingPoint.first, *endingPoint.first)};
+        matrix_size_t const c_OuterRectEndingRowNr{std::max(*startingPoint.first, *endingPoint.first)};
+        matrix_size_t const c_OuterRectStartingColumnNr{std::min(*startingPoint.second, *endingPoint.second)};
+        matrix_size_t const c_OuterRectEndingColumnNr{std::max(*startingPoint.second, *endingPoint.second)};
+
+        gatheringPoint.first = std::clamp(gatheringPoint.first.has_value() ? *gatheringPoint.first : 0u,
+                                          c_OuterRectStartingRowNr, c_OuterRectEndingRowNr);
+        gatheringPoint.second = std::clamp(gatheringPoint.second.has_value() ? *gatheringPoint.second : 0u,
+                                           c_OuterRectStartingColumnNr, c_OuterRectEndingColumnNr);
+
+        const matrix_size_t c_RowsCount{c_OuterRectEndingRowNr - c_OuterRectStartingRowNr};
+        const matrix_size_t c_ColumnsCount{c_OuterRectEndingColumnNr - c_OuterRectStartingColumnNr};
+        const size_t c_ElementsCount{static_cast<size_t>(c_RowsCount) * c_ColumnsCount};
+
+        // row-by-row gathering (each job handles a group of consecutive rows)
+        for (auto& result : m_PartialResults)
+        {
+            result = {c_OuterRectEndingColumnNr, c_OuterRectStartingColumnNr, 0u};
+        }
+
+        _runInParallel(c_RowsCount, c_ElementsCount,
+                       [&](size_t threadIndex, matrix_size_t firstJobIndex, matrix_size_t lastJobIndex) {
+                           _gatherRows(matrix, c_OuterRectStartingRowNr + firstJobIndex,
+                                       c_OuterRectStartingRowNr + lastJobIndex, c_OuterRectStartingColumnNr,
+                                       c_OuterRectEndingColumnNr, *gatheringPoint.second, predicate,
+                                       m_ScratchBuffers[threadIndex], m_PartialResults[threadIndex]);
+                       });
+
+        matrix_size_t innerRectStartingColumnNr{c_OuterRectEndingColumnNr};
+        matrix_size_t innerRectEndingColumnNr{c_OuterRectStartingColumnNr};
+
+        for (const auto& result : m_PartialResults)
+        {
+            innerRectStartingColumnNr = std::min(innerRectStartingColumnNr, result.m_InnerRectStart);
+            innerRectEndingColumnNr = std::max(innerRectEndingColumnNr, result.m_InnerRectEnd);
+            gatheredElementsCount += result.m_GatheredElementsCount;
+        }
+
+        // column-by-column gathering (each job handles a tile of consecutive columns)
+        const matrix_size_t c_TileColumnsCount{
+            m_TileColumnsCount > 0
+                ? m_TileColumnsCount
+                : static_cast<matrix_size_t>(std::max<size_t>(
+                      c_TileSizeInBytes / (std::max<size_t>(c_RowsCount, 1) * sizeof(DataType)), 1))};
+        const matrix_size_t c_TilesCount{(c_ColumnsCount + c_TileColumnsCount - 1) / c_TileColumnsCount};
+
+        for (auto& result : m_PartialResults)
+        {
+            result = {c_OuterRectEndingRowNr, c_OuterRectStartingRowNr, 0u};
+        }
+
+        _runInParallel(c_TilesCount, c_ElementsCount,
+                       [&](size_t threadIndex, matrix_size_t firstJobIndex, matrix_size_t lastJobIndex) {
+                           for (matrix_size_t tileIndex{firstJobIndex}; tileIndex < lastJobIndex; ++tileIndex)
+                           {
+                               const matrix_size_t c_FirstColumnNr{c_OuterRectStartingColumnNr +
+                                                                   tileIndex * c_TileColumnsCount};
+
+                               _gatherColumnsTile(
+                                   matrix, c_FirstColumnNr,
+                                   std::min(c_FirstColumnNr + c_TileColumnsCount, c_OuterRectEndingColumnNr),
+                                   c_OuterRectStartingRowNr, c_OuterRectEndingRowNr, *gatheringPoint.first,
+                                   predicate, m_ScratchBuffers[threadIndex], m_PartialResults[threadIndex]);
+                           }
+                       });
+
+        matrix_size_t innerRectStartingRowNr{c_OuterRectEndingRowNr};
+        matrix_size_t innerRectEndingRowNr{c_OuterRectStartingRowNr};
+
+        for (const auto& result : m_PartialResults)
+        {
+            innerRectStartingRowNr = std::min(innerRectStartingRowNr, result.m_InnerRectStart);
+            innerRectEndingRowNr = std::max(innerRectEndingRowNr, result.m_InnerRectEnd);
+        }
+
+        if (innerRectStartingRowNr != innerRectEndingRowNr && innerRectStartingColumnNr != innerRectEndingColumnNr)
+        {
+            innerRectStartingPoint = {innerRectStartingRowNr, innerRectStartingColumnNr};
+            innerRectEndingPoint = {innerRectEndingRowNr, innerRectEndingColumnNr};
+        }
+        else
+        {
+            innerRectStartingPoint = gatheringPoint;
+            innerRectEndingPoint = gatheringPoint;
+        }
+    }
+
+    return {innerRectStartingPoint, innerRectEndingPoint, gatheredElementsCount};
+}
+
+// the jobs are split into contiguous groups, one per thread; no threads are created if there is too little work
+template <typename DataType>
+template <typename Function>
+void MatrixGatherer<DataType>::_runInParallel(matrix_size_t jobsCount, size_t elementsCount, Function function)
+{
+    const size_t c_ThreadsCount{std::min({m_ThreadsCount, static_cast<size_t>(jobsCount),
+                                          std::max<size_t>(elementsCount / c_MinElementsCountPerThread, 1)})};
+
+    if (c_ThreadsCount <= 1)
+    {
+        function(0, 0, jobsCount);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(c_ThreadsCount - 1);
+
+        for (size_t threadIndex{1}; threadIndex < c_ThreadsCount; ++threadIndex)
+        {
+            threads.emplace_back(function, threadIndex,
+                                 static_cast<matrix_size_t>(jobsCount * threadIndex / c_ThreadsCount),
+                                 static_cast<matrix_size_t>(jobsCount * (threadIndex + 1) / c_ThreadsCount));
+        }
+
+        function(0, 0, static_cast<matrix_size_t>(jobsCount / c_ThreadsCount));
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+template <typename DataType>
+void MatrixGatherer<DataType>::_gatherRows(Matrix<DataType>& matrix, matrix_size_t firstRowNr, matrix_size_t lastRowNr,
+                                           matrix_size_t startingColumnNr, matrix_size_t endingColumnNr,
+                                           matrix_size_t gatheringColumnNr, const Predicate& predicate,
+                                           ScratchBuffer& buffer, PartialResult& result)
+{
+    const matrix_size_t c_ColumnsCount{endingColumnNr - startingColumnNr};
+
+    buffer.m_SourceIndexes.resize(c_ColumnsCount);
+
+    for (matrix_size_t rowNr{firstRowNr}; rowNr < lastRowNr; ++rowNr)
+    {
+        std::pair<matrix_size_t, matrix_size_t> gatheredRange{0u, 0u};
+
+        if (c_ColumnsCount > 0)
+        {
+            buffer.m_Elements.clear();
+            buffer.m_PredicateResults.clear();
+
+            auto it{matrix.getZIterator(rowNr, startingColumnNr)};
+
+            for (matrix_size_t index{0}; index < c_ColumnsCount; ++index, ++it)
+            {
+                buffer.m_Elements.push_back(std::move(*it));
+                buffer.m_PredicateResults.push_back(predicate(buffer.m_Elements.back()) ? 1 : 0);
+            }
+
+            gatheredRange = _computeSourceIndexes(buffer.m_PredicateResults.data(), c_ColumnsCount,
+                                                  gatheringColumnNr - startingColumnNr, buffer.m_SourceIndexes.data());
+            it = matrix.getZIterator(rowNr, startingColumnNr);
+
+            for (matrix_size_t index{0}; index < c_ColumnsCount; ++index, ++it)
+            {
+                *it = std::move(buffer.m_Elements[buffer.m_SourceIndexes[index]]);
+            }
+        }
+
+        result.m_InnerRectStart = std::min(result.m_InnerRectStart, startingColumnNr + gatheredRange.first);
+        result.m_InnerRectEnd = std::max(result.m_InnerRectEnd, startingColumnNr + gatheredRange.second);
+        result.m_GatheredElementsCount += gatheredRange.second - gatheredRange.first;
+    }
+}
+
+/* The tile is stored row-by-row in the scratch buffer (as in the matrix) while the predicate results and the source
+   indexes are stored column-by-column, so each column is gathered by using contiguous ranges of them.
+*/
+template <typename DataType>
+void MatrixGatherer<DataType>::_gatherColumnsTile(Matrix<DataType>& matrix, matrix_size_t firstColumnNr,
+                                                  matrix_size_t lastColumnNr, matrix_size_t startingRowNr,
+                                                  matrix_size_t endingRowNr, matrix_size_t gatheringRowNr,
+                                                  const Predicate& predicate, ScratchBuffer& buffer,
+                                                  PartialResult& result)
+{
+    const matrix_size_t c_RowsCount{endingRowNr - startingRowNr};
+    const matrix_size_t c_ColumnsCount{lastColumnNr - firstColumnNr};
+    const size_t c_ElementsCount{static_cast<size_t>(c_RowsCount) * c_ColumnsCount};
+
+    buffer.m_Elements.clear();
+    buffer.m_PredicateResults.resize(c_ElementsCount);
+    buffer.m_SourceIndexes.resize(c_ElementsCount);
+
+    for (matrix_size_t rowIndex{0}; rowIndex < c_RowsCount; ++rowIndex)
+    {
+        auto it{matrix.getZIterator(startingRowNr + rowIndex, firstColumnNr)};
+
+        for (matrix_size_t columnIndex{0}; columnIndex < c_ColumnsCount; ++columnIndex, ++it)
+        {
+            buffer.m_Elements.push_back(std::move(*it));
+            buffer.m_PredicateResults[static_cast<size_t>(columnIndex) * c_RowsCount + rowIndex] =
+                predicate(buffer.m_Elements.back()) ? 1 : 0;
+        }
+    }
+
+    for (matrix_size_t columnIndex{0}; columnIndex < c_ColumnsCount; ++columnIndex)
+    {
+        const size_t c_ColumnOffset{static_cast<size_t>(columnIndex) * c_RowsCount};
+        const auto [c_GatheredRangeStart, c_GatheredRangeEnd]{_computeSourceIndexes(
+            buffer.m_PredicateResults.data() + c_ColumnOffset, c_RowsCount, gatheringRowNr - startingRowNr,
+            buffer.m_SourceIndexes.data() + c_ColumnOffset)};
+
+        result.m_InnerRectStart = std::min(result.m_InnerRectStart, startingRowNr + c_GatheredRangeStart);
+        result.m_InnerRectEnd = std::max(result.m_InnerRectEnd, startingRowNr + c_GatheredRangeEnd);
+    }
+
+    for (matrix_size_t rowIndex{0}; rowIndex < c_RowsCount; ++rowIndex)
+    {
+        auto it{matrix.getZIterator(startingRowNr + rowIndex, firstColumnNr)};
+
+        for (matrix_size_t columnIndex{0}; columnIndex < c_ColumnsCount; ++columnIndex, ++it)
+        {
+            const size_t c_SourceRowIndex{
+                buffer.m_SourceIndexes[static_cast<size_t>(columnIndex) * c_RowsCount + rowIndex]};
+            *it = std::move(buffer.m_Elements[c_SourceRowIndex * c_ColumnsCount + columnIndex]);
+        }
+    }
+}
+
+/* Equivalent of the two std::stable_partition calls from gatherSequenceElements(): for each destination index the
+   index of the source element is written. Returns the gathered range (indexes relative to the sequence start).
+*/
+template <typename DataType>
+std::pair<matrix_size_t, matrix_size_t> MatrixGatherer<DataType>::_computeSourceIndexes(
+    const uint8_t* pPredicateResults, matrix_size_t elementsCount, matrix_size_t gatheringIndex,
+    matrix_size_t* pSourceIndexes)
+{
+    const auto c_GatheredRangeStart{
+        static_cast<matrix_size_t>(std::count(pPredicateResults, pPredicateResults + gatheringIndex, 0))};
+    const auto c_GatheredRangeEnd{static_cast<matrix_size_t>(
+        gatheringIndex + std::count(pPredicateResults + gatheringIndex, pPredicateResults + elementsCount, 1))};
+
+    // before the gathering index: non-matching elements first
+    matrix_size_t nonMatchingIndex{0};
+    matrix_size_t matchingIndex{c_GatheredRangeStart};
+
+    for (matrix_size_t index{0}; index < gatheringIndex; ++index)
+    {
+        pSourceIndexes[pPredicateResults[index] ? matchingIndex++ : nonMatchingIndex++] = index;
+    }
+
+    // after the gathering index: matching elements first
+    matchingIndex = gatheringIndex;
+    nonMatchingIndex = c_GatheredRangeEnd;
+
+    for (matrix_size_t index{gatheringIndex}; index < elementsCount; ++index)
+    {
+        pSourceIndexes[pPredicateResults[index] ? matchingIndex++ : nonMatchingIndex++] = index;
+    }
+
+    return {c_GatheredRangeStart, c_GatheredRangeEnd};
+}
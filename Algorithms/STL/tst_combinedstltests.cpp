@@ -21,10 +21,14 @@ private slots:
     void testGatherAlgorithmStdVector();
     void testGatherAlgorithmStdList();
     void testGatherAlgorithmMatrix();
+    void testMatrixGatherer();
+    void testParallelMatrixGatherer();
 
     void testGatherAlgorithmStdVector_data();
     void testGatherAlgorithmStdList_data();
     void testGatherAlgorithmMatrix_data();
+    void testMatrixGatherer_data();
+    void testParallelMatrixGatherer_data();
 
 private:
     const IntMatrix mPrimaryIntMatrix;
@@ -126,6 +130,71 @@ void CombinedSTLTests::testGatherAlgorithmMatrix()
     QVERIFY(gatheringStartingPoint == gatheringStartingPointRef && gatheringEndingPoint == gatheringEndingPointRef && gatheredElementsCount == gatheredElementsCountRef);
 }
 
+void CombinedSTLTests::testMatrixGatherer()
+{
+    QFETCH(IntMatrix, intMatrix);
+    QFETCH(MatrixPoint, startingPoint);
+    QFETCH(MatrixPoint, endingPoint);
+    QFETCH(MatrixPoint, gatheringPoint);
+    QFETCH(std::function<bool(const int&)>, predicate);
+    QFETCH(IntMatrix, intMatrixRef);
+    QFETCH(MatrixPoint, gatheringStartingPointRef);
+    QFETCH(MatrixPoint, gatheringEndingPointRef);
+    QFETCH(matrix_size_t, gatheredElementsCountRef);
+
+    // same gatherer used multiple times (the scratch buffers are being reused), both with tiles of a single column and with tiles covering the whole matrix
+    for (const matrix_size_t tileColumnsCount : {1u, 2u, 0u})
+    {
+        MatrixGatherer<int> gatherer{1, tileColumnsCount};
+
+        for (int run{0}; run < 2; ++run)
+        {
+            IntMatrix matrix{intMatrix};
+            const auto&[gatheringStartingPoint, gatheringEndingPoint, gatheredElementsCount]{gatherer.gather(matrix, startingPoint, endingPoint, gatheringPoint, predicate)};
+
+            QVERIFY(intMatrixRef == matrix);
+            QVERIFY(gatheringStartingPoint == gatheringStartingPointRef && gatheringEndingPoint == gatheringEndingPointRef && gatheredElementsCount == gatheredElementsCountRef);
+        }
+    }
+}
+
+void CombinedSTLTests::testParallelMatrixGatherer()
+{
+    QFETCH(size_t, threadsCount);
+    QFETCH(matrix_size_t, tileColumnsCount);
+    QFETCH(MatrixPoint, startingPoint);
+    QFETCH(MatrixPoint, endingPoint);
+    QFETCH(MatrixPoint, gatheringPoint);
+
+    // the matrix should be large enough for the work to get split among threads (see MatrixGatherer::_runInParallel())
+    IntMatrix intMatrix{{240, 300}, 0};
+
+    for (matrix_size_t rowNr{0}; rowNr < intMatrix.getNrOfRows(); ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < intMatrix.getNrOfColumns(); ++columnNr)
+        {
+            intMatrix.at(rowNr, columnNr) = static_cast<int>((rowNr * 31 + columnNr * 17) % 23) - 11;
+        }
+    }
+
+    std::function<bool(const int&)> isNegativeInt{[](const int& element) {return element < 0;}};
+
+    // the single threaded gathering algorithm provides the reference results
+    IntMatrix intMatrixRef{intMatrix};
+    const auto&[gatheringStartingPointRef, gatheringEndingPointRef, gatheredElementsCountRef]{gatherMatrixElements(intMatrixRef, startingPoint, endingPoint, gatheringPoint, isNegativeInt)};
+
+    MatrixGatherer<int> gatherer{threadsCount, tileColumnsCount};
+
+    for (int run{0}; run < 2; ++run)
+    {
+        IntMatrix matrix{intMatrix};
+        const auto&[gatheringStartingPoint, gatheringEndingPoint, gatheredElementsCount]{gatherer.gather(matrix, startingPoint, endingPoint, gatheringPoint, isNegativeInt)};
+
+        QVERIFY(intMatrixRef == matrix);
+        QVERIFY(gatheringStartingPoint == gatheringStartingPointRef && gatheringEndingPoint == gatheringEndingPointRef && gatheredElementsCount == gatheredElementsCountRef);
+    }
+}
+
 void CombinedSTLTests::testGatherAlgorithmStdVector_data()
 {
     QTest::addColumn<IntVector>("intVector");
@@ -679,6 +748,34 @@ void CombinedSTLTests::testGatherAlgorithmMatrix_data()
     QTest::newRow("11b") << IntMatrix{} << MatrixPoint{std::nullopt, std::nullopt} << MatrixPoint{0, 0} << MatrixPoint{0, std::nullopt} << isNegativeInt << IntMatrix{} << MatrixPoint{0, 0} << MatrixPoint{0, 0} << 0u;
 }
 
+void CombinedSTLTests::testMatrixGatherer_data()
+{
+    testGatherAlgorithmMatrix_data();
+}
+
+void CombinedSTLTests::testParallelMatrixGatherer_data()
+{
+    QTest::addColumn<size_t>("threadsCount");
+    QTest::addColumn<matrix_size_t>("tileColumnsCount");
+    QTest::addColumn<MatrixPoint>("startingPoint");
+    QTest::addColumn<MatrixPoint>("endingPoint");
+    QTest::addColumn<MatrixPoint>("gatheringPoint");
+
+    // tiles of 1 and 7 columns: more tiles than threads; tile columns count 0: computed (less tiles than threads)
+    QTest::newRow("1a") << size_t{2} << 1u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{120, 150};
+    QTest::newRow("1b") << size_t{2} << 7u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{120, 150};
+    QTest::newRow("1c") << size_t{2} << 0u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{120, 150};
+    QTest::newRow("2a") << size_t{3} << 1u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{0, 0};
+    QTest::newRow("2b") << size_t{3} << 7u << MatrixPoint{240, 300} << MatrixPoint{0, 0} << MatrixPoint{240, 300};
+    QTest::newRow("2c") << size_t{3} << 0u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{std::nullopt, std::nullopt};
+    QTest::newRow("3a") << size_t{4} << 1u << MatrixPoint{5, 3} << MatrixPoint{237, 298} << MatrixPoint{17, 250};
+    QTest::newRow("3b") << size_t{4} << 7u << MatrixPoint{237, 298} << MatrixPoint{5, 3} << MatrixPoint{200, 9};
+    QTest::newRow("3c") << size_t{4} << 0u << MatrixPoint{5, 3} << MatrixPoint{237, 298} << MatrixPoint{100, 100};
+    QTest::newRow("4a") << size_t{8} << 1u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{60, 225};
+    QTest::newRow("4b") << size_t{8} << 7u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{180, 75};
+    QTest::newRow("4c") << size_t{8} << 0u << MatrixPoint{0, 0} << MatrixPoint{240, 300} << MatrixPoint{240, 0};
+}
+
 QTEST_APPLESS_MAIN(CombinedSTLTests)
 
 #include "tst_combinedstltests.moc"
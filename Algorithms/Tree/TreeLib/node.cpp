@@ -1,8 +1,45 @@
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <functional>
+#include <numeric>
+#include <thread>
 
 #include "node.h"
 
+// below this count it is cheaper to process a tree level on a single thread than to spawn additional threads
+static constexpr size_t c_MinNodesPerThread{1024};
+
+// number of independent subtrees gathered per thread before inverting in parallel (threads that finish their subtrees
+// early pick up the remaining ones, so an unbalanced tree does not keep a single thread busy)
+static constexpr size_t c_SubtreesPerThread{8};
+
+// runs the task for each index from 0 to tasksCount - 1, one thread per task (first task runs on the calling thread)
+static void runTasksInParallel(size_t tasksCount, const std::function<void(size_t)>& task)
+{
+    std::vector<std::thread> threads;
+
+    if (tasksCount > 1)
+    {
+        threads.reserve(tasksCount - 1);
+
+        for (size_t taskIndex{1}; taskIndex < tasksCount; ++taskIndex)
+        {
+            threads.emplace_back(task, taskIndex);
+        }
+    }
+
+    if (tasksCount > 0)
+    {
+        task(0);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
 Node::Node(NodeValue value)
     : m_Value{value}
 {
@@ -52,27 +89,35 @@ void Node::_invertSuccessorsRecursively()
 void Node::_invertSuccessorsIteratively()
 {
     std::reverse(m_Children.begin(), m_Children.end());
-    std::vector<NodeSp> currentDepthNodes{m_Children.begin(), m_Children.end()};
+
+    // raw pointers are sufficient for traversing (the nodes are owned by their parents), no need to bump ref counts
+    std::vector<Node*> currentDepthNodes;
+    currentDepthNodes.reserve(m_Children.size());
+
+    for (auto& child : m_Children)
+    {
+        currentDepthNodes.push_back(child.get());
+    }
 
     for (; !currentDepthNodes.empty();)
     {
-        std::vector<NodeSp> newDepthNodes;
+        std::vector<Node*> newDepthNodes;
 
-        for (auto& node : currentDepthNodes)
+        for (auto pNode : currentDepthNodes)
         {
-            if (!node)
+            if (!pNode)
             {
                 assert(false);
-                currentDepthNodes.clear();
+                newDepthNodes.clear();
                 break;
             }
 
-            auto& children = node->m_Children;
+            auto& children = pNode->m_Children;
             std::reverse(children.begin(), children.end());
 
             for (auto& child : children)
             {
-                newDepthNodes.push_back(child);
+                newDepthNodes.push_back(child.get());
             }
         }
 
@@ -80,6 +125,62 @@ void Node::_invertSuccessorsIteratively()
     }
 }
 
+void Node::_invertSuccessorsInParallel(size_t threadsCount)
+{
+    threadsCount = std::max<size_t>(threadsCount, 1);
+    std::reverse(m_Children.begin(), m_Children.end());
+
+    std::vector<Node*> subtreeRoots;
+    subtreeRoots.reserve(m_Children.size());
+
+    for (auto& child : m_Children)
+    {
+        subtreeRoots.push_back(child.get());
+    }
+
+    // descend level by level (inverting on the way) until enough independent subtrees are available for all threads
+    for (const size_t c_RequiredSubtreesCount{threadsCount * c_SubtreesPerThread};
+         !subtreeRoots.empty() && subtreeRoots.size() < c_RequiredSubtreesCount;)
+    {
+        std::vector<Node*> newDepthNodes;
+
+        for (auto pNode : subtreeRoots)
+        {
+            if (!pNode)
+            {
+                assert(false);
+                newDepthNodes.clear();
+                break;
+            }
+
+            auto& children = pNode->m_Children;
+            std::reverse(children.begin(), children.end());
+
+            for (auto& child : children)
+            {
+                newDepthNodes.push_back(child.get());
+            }
+        }
+
+        subtreeRoots = std::move(newDepthNodes);
+    }
+
+    std::atomic<size_t> nextSubtreeIndex{0};
+
+    runTasksInParallel(std::min(threadsCount, subtreeRoots.size()), [&subtreeRoots, &nextSubtreeIndex](size_t) {
+        for (size_t index{nextSubtreeIndex++}; index < subtreeRoots.size(); index = nextSubtreeIndex++)
+        {
+            Node* const pSubtreeRoot{subtreeRoots[index]};
+            assert(pSubtreeRoot);
+
+            if (pSubtreeRoot)
+            {
+                pSubtreeRoot->_invertSuccessorsIteratively();
+            }
+        }
+    });
+}
+
 std::vector<ConstNodeSp> Node::_getFlattenedSuccessors() const
 {
     std::vector<ConstNodeSp> result{m_Children.cbegin(), m_Children.cend()};
@@ -111,3 +212,64 @@ std::vector<ConstNodeSp> Node::_getFlattenedSuccessors() const
 
     return result;
 }
+
+NodeValues Node::_getFlattenedValuesInParallel(size_t threadsCount) const
+{
+    threadsCount = std::max<size_t>(threadsCount, 1);
+
+    NodeValues result{m_Value};
+    std::vector<const Node*> currentDepthNodes{this};
+
+    for (; !currentDepthNodes.empty();)
+    {
+        const size_t c_CurrentDepthNodesCount{currentDepthNodes.size()};
+        const size_t c_ChunksCount{std::clamp<size_t>(c_CurrentDepthNodesCount / c_MinNodesPerThread, 1, threadsCount)};
+        const size_t c_ChunkSize{(c_CurrentDepthNodesCount + c_ChunksCount - 1) / c_ChunksCount};
+
+        auto getChunkBegin = [&](size_t chunkIndex) {
+            return std::min(chunkIndex * c_ChunkSize, c_CurrentDepthNodesCount);
+        };
+
+        // first pass: count the children of each chunk in order to know where each chunk should write its values
+        std::vector<size_t> chunkOffsets(c_ChunksCount + 1, 0);
+
+        runTasksInParallel(c_ChunksCount, [&](size_t chunkIndex) {
+            size_t childrenCount{0};
+
+            for (size_t index{getChunkBegin(chunkIndex)}; index < getChunkBegin(chunkIndex + 1); ++index)
+            {
+                childrenCount += currentDepthNodes[index]->m_Children.size();
+            }
+
+            chunkOffsets[chunkIndex + 1] = childrenCount;
+        });
+
+        std::partial_sum(chunkOffsets.cbegin(), chunkOffsets.cend(), chunkOffsets.begin());
+
+        const size_t c_FirstValueIndex{result.size()};
+        result.resize(c_FirstValueIndex + chunkOffsets.back());
+
+        std::vector<const Node*> newDepthNodes(chunkOffsets.back(), nullptr);
+
+        // second pass: each chunk writes the values of the children straight into its own slice of the result
+        runTasksInParallel(c_ChunksCount, [&](size_t chunkIndex) {
+            size_t outputIndex{chunkOffsets[chunkIndex]};
+
+            for (size_t index{getChunkBegin(chunkIndex)}; index < getChunkBegin(chunkIndex + 1); ++index)
+            {
+                for (const auto& child : currentDepthNodes[index]->m_Children)
+                {
+                    assert(child);
+
+                    result[c_FirstValueIndex + outputIndex] = child->m_Value;
+                    newDepthNodes[outputIndex] = child.get();
+                    ++outputIndex;
+                }
+            }
+        });
+
+        currentDepthNodes = std::move(newDepthNodes);
+    }
+
+    return result;
+}
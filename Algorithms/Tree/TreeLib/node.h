@@ -26,9 +26,13 @@ protected:
 
     void _invertSuccessorsRecursively();
     void _invertSuccessorsIteratively();
+    void _invertSuccessorsInParallel(size_t threadsCount);
 
     std::vector<ConstNodeSp> _getFlattenedSuccessors() const;
 
+    // values of this node and its successors (breadth-first), each tree level being split among the available threads
+    NodeValues _getFlattenedValuesInParallel(size_t threadsCount) const;
+
 private:
     NodeValue m_Value;
     std::vector<std::shared_ptr<Node>> m_Children;
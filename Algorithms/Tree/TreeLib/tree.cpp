@@ -36,6 +36,14 @@ void Tree::invertIteratively()
     }
 }
 
+void Tree::invertInParallel(size_t threadsCount)
+{
+    if (m_Root)
+    {
+        m_Root->_invertSuccessorsInParallel(threadsCount);
+    }
+}
+
 void Tree::clear()
 {
     if (m_Root)
@@ -62,6 +70,11 @@ NodeValues Tree::getNodeValues() const
     return nodeValues;
 }
 
+NodeValues Tree::getNodeValuesInParallel(size_t threadsCount) const
+{
+    return m_Root ? m_Root->_getFlattenedValuesInParallel(threadsCount) : NodeValues{};
+}
+
 NodeWp Tree::getRootNode() const
 {
     return m_Root;
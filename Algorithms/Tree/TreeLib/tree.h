@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <thread>
 
 #include "node.h"
 
@@ -17,10 +18,12 @@ public:
 
     void invertRecursively();
     void invertIteratively();
+    void invertInParallel(size_t threadsCount = std::thread::hardware_concurrency());
 
     void clear();
 
     NodeValues getNodeValues() const;
+    NodeValues getNodeValuesInParallel(size_t threadsCount = std::thread::hardware_concurrency()) const;
     NodeWp getRootNode() const;
     size_t size() const;
     bool empty() const;
@@ -10,10 +10,13 @@ class TreeTests : public QObject
 private slots:
     void testRecursiveInversion();
     void testIterativeInversion();
+    void testParallelInversion();
+    void testParallelInversionOfWideTree();
     void testAddRootNode();
 
     void testRecursiveInversion_data();
     void testIterativeInversion_data();
+    void testParallelInversion_data();
 
 private:
     void _buildInversionTestTable();
@@ -78,6 +81,81 @@ void TreeTests::testIterativeInversion()
     QVERIFY(tree->empty());
 }
 
+void TreeTests::testParallelInversion()
+{
+    QFETCH(TreeSp, tree);
+    QFETCH(NodeValues, treeValues);
+    QFETCH(NodeValues, invertedTreeValues);
+
+    QVERIFY(tree);
+    QVERIFY(tree->getNodeValuesInParallel(4) == treeValues);
+
+    tree->invertInParallel(4);
+    QVERIFY(tree->getNodeValuesInParallel(4) == invertedTreeValues);
+    QVERIFY(tree->getNodeValues() == invertedTreeValues);
+
+    tree->invertInParallel(1);
+    QVERIFY(tree->getNodeValuesInParallel(1) == treeValues);
+
+    tree->clear();
+
+    QVERIFY(tree->getNodeValuesInParallel().empty());
+    QVERIFY(tree->empty());
+}
+
+void TreeTests::testParallelInversionOfWideTree()
+{
+    // each level beyond the first one should contain enough nodes to be split among multiple threads
+    Tree tree{0};
+    NodeValue nextValue{1};
+    std::vector<NodeSp> currentDepthNodes{tree.getRootNode().lock()};
+
+    for (size_t depth{0}; depth < 3; ++depth)
+    {
+        std::vector<NodeSp> newDepthNodes;
+
+        for (const auto& node : currentDepthNodes)
+        {
+            QVERIFY(node);
+
+            const size_t c_ChildrenCount{depth == 0 ? 64u : static_cast<size_t>(nextValue % 5 + 30)};
+            NodeValues childValues;
+
+            for (size_t childIndex{0}; childIndex < c_ChildrenCount; ++childIndex)
+            {
+                childValues.push_back(nextValue++);
+            }
+
+            node->createAndAppendChildren(childValues);
+
+            for (size_t childIndex{0}; childIndex < c_ChildrenCount; ++childIndex)
+            {
+                newDepthNodes.push_back(node->getChildAtIndex(childIndex).lock());
+            }
+        }
+
+        currentDepthNodes = std::move(newDepthNodes);
+    }
+
+    const NodeValues c_TreeValues{tree.getNodeValues()};
+    QVERIFY(c_TreeValues.size() == static_cast<size_t>(nextValue));
+
+    tree.invertIteratively();
+    const NodeValues c_InvertedTreeValues{tree.getNodeValues()};
+    tree.invertIteratively();
+
+    for (const size_t threadsCount : {1u, 2u, 3u, 8u})
+    {
+        QVERIFY(tree.getNodeValuesInParallel(threadsCount) == c_TreeValues);
+
+        tree.invertInParallel(threadsCount);
+        QVERIFY(tree.getNodeValuesInParallel(threadsCount) == c_InvertedTreeValues);
+
+        tree.invertInParallel(threadsCount);
+        QVERIFY(tree.getNodeValues() == c_TreeValues);
+    }
+}
+
 void TreeTests::testAddRootNode()
 {
     Tree tree;
@@ -128,6 +206,11 @@ void TreeTests::testIterativeInversion_data()
     _buildInversionTestTable();
 }
 
+void TreeTests::testParallelInversion_data()
+{
+    _buildInversionTestTable();
+}
+
 void TreeTests::_buildInversionTestTable()
 {
     QTest::addColumn<TreeSp>("tree");
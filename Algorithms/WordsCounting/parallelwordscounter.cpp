@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "parallelwordscounter.h"
+
+// below this size it is not worth splitting the content among multiple threads
+static constexpr size_t c_MinChunkSize{size_t{1} << 20};
+
+/* Same word rules as for WordsCounter:
+   - alphanumeric characters and '-' / '\'' (joiners) are part of words, all other characters are separators
+   - joiners are trimmed from the beginning and end of each word
+*/
+enum class CharClass : unsigned char
+{
+    SEPARATOR,
+    ALPHANUMERIC,
+    JOINER
+};
+
+static constexpr std::array<CharClass, 256> c_CharClassTable{[]() {
+    std::array<CharClass, 256> charClassTable{};
+    charClassTable.fill(CharClass::SEPARATOR);
+
+    for (size_t index{'0'}; index <= '9'; ++index)
+    {
+        charClassTable[index] = CharClass::ALPHANUMERIC;
+    }
+
+    for (size_t index{'a'}; index <= 'z'; ++index)
+    {
+        charClassTable[index] = CharClass::ALPHANUMERIC;
+        charClassTable[index - 'a' + 'A'] = CharClass::ALPHANUMERIC;
+    }
+
+    charClassTable['-'] = CharClass::JOINER;
+    charClassTable['\''] = CharClass::JOINER;
+
+    return charClassTable;
+}()};
+
+static CharClass getCharClass(char ch)
+{
+    return c_CharClassTable[static_cast<unsigned char>(ch)];
+}
+
+ParallelWordsCounter::ParallelWordsCounter(size_t threadsCount)
+    : m_ThreadsCount{std::max<size_t>(threadsCount, 1)}
+{
+}
+
+void ParallelWordsCounter::countWords(std::string_view content)
+{
+    m_WordHashMap.clear();
+
+    const size_t c_ChunksCount{std::clamp<size_t>(content.size() / c_MinChunkSize, 1, m_ThreadsCount)};
+
+    if (c_ChunksCount > 1)
+    {
+        // chunk boundaries are moved forward to the next separator so no word is split between two chunks
+        std::vector<size_t> chunkBoundaries(c_ChunksCount + 1, content.size());
+        chunkBoundaries.front() = 0;
+
+        for (size_t chunkIndex{1}; chunkIndex < c_ChunksCount; ++chunkIndex)
+        {
+            size_t boundary{std::max(chunkIndex * content.size() / c_ChunksCount, chunkBoundaries[chunkIndex - 1])};
+
+            while (boundary < content.size() && getCharClass(content[boundary]) != CharClass::SEPARATOR)
+            {
+                ++boundary;
+            }
+
+            chunkBoundaries[chunkIndex] = boundary;
+        }
+
+        std::vector<WordHashMap> chunkWordHashMaps(c_ChunksCount);
+        std::vector<std::thread> threads;
+        threads.reserve(c_ChunksCount);
+
+        for (size_t chunkIndex{0}; chunkIndex < c_ChunksCount; ++chunkIndex)
+        {
+            threads.emplace_back(&ParallelWordsCounter::_countChunkWords,
+                                 content.substr(chunkBoundaries[chunkIndex],
+                                                chunkBoundaries[chunkIndex + 1] - chunkBoundaries[chunkIndex]),
+                                 std::ref(chunkWordHashMaps[chunkIndex]));
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        m_WordHashMap = std::move(chunkWordHashMaps.front());
+
+        for (auto it{chunkWordHashMaps.cbegin() + 1}; it != chunkWordHashMaps.cend(); ++it)
+        {
+            m_WordHashMap.merge(*it);
+        }
+    }
+    else
+    {
+        _countChunkWords(content, m_WordHashMap);
+    }
+}
+
+WordOccurrencesMap ParallelWordsCounter::getOccurrencesMap() const
+{
+    return m_WordHashMap.getOccurrencesMap();
+}
+
+const WordHashMap& ParallelWordsCounter::getWordHashMap() const
+{
+    return m_WordHashMap;
+}
+
+void ParallelWordsCounter::_countChunkWords(std::string_view chunk, WordHashMap& wordHashMap)
+{
+    const size_t c_ChunkSize{chunk.size()};
+
+    for (size_t index{0}; index < c_ChunkSize;)
+    {
+        while (index < c_ChunkSize && getCharClass(chunk[index]) == CharClass::SEPARATOR)
+        {
+            ++index;
+        }
+
+        size_t wordStart{index};
+
+        while (index < c_ChunkSize && getCharClass(chunk[index]) != CharClass::SEPARATOR)
+        {
+            ++index;
+        }
+
+        size_t wordEnd{index};
+
+        while (wordStart < wordEnd && getCharClass(chunk[wordStart]) == CharClass::JOINER)
+        {
+            ++wordStart;
+        }
+
+        while (wordEnd > wordStart && getCharClass(chunk[wordEnd - 1]) == CharClass::JOINER)
+        {
+            --wordEnd;
+        }
+
+        if (wordStart < wordEnd)
+        {
+            wordHashMap.addOccurrences(chunk.substr(wordStart, wordEnd - wordStart));
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string_view>
+#include <thread>
+
+#include "wordhashmap.h"
+
+/* Alternative to WordsCounter intended for large amounts of text (same words and counts are obtained):
+   - the text is provided as a single buffer and the words are retrieved as views into it (no line copies, no string
+   streams); the separators are determined by using a character class table
+   - the text is split into chunks (at separator boundaries) that are counted in parallel, each thread having its own
+   hash map, the maps being merged once all chunks are counted
+   - the alphabetically ordered map is only built on request
+*/
+class ParallelWordsCounter
+{
+public:
+    explicit ParallelWordsCounter(size_t threadsCount = std::thread::hardware_concurrency());
+
+    // the content is only accessed during this call (no reference to it is kept)
+    void countWords(std::string_view content);
+
+    WordOccurrencesMap getOccurrencesMap() const;
+    const WordHashMap& getWordHashMap() const;
+
+private:
+    static void _countChunkWords(std::string_view chunk, WordHashMap& wordHashMap);
+
+    size_t m_ThreadsCount;
+    WordHashMap m_WordHashMap;
+};
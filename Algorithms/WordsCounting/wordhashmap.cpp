@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+
+#include "wordhashmap.h"
+
+// ASCII only lower case conversion (same as tolower() for the default "C" locale)
+static constexpr std::array<char, 256> c_LowerCaseTable{[]() {
+    std::array<char, 256> lowerCaseTable{};
+
+    for (size_t index{0}; index < lowerCaseTable.size(); ++index)
+    {
+        lowerCaseTable[index] = static_cast<char>(index >= 'A' && index <= 'Z' ? index - 'A' + 'a' : index);
+    }
+
+    return lowerCaseTable;
+}()};
+
+static char toLowerCase(char ch)
+{
+    return c_LowerCaseTable[static_cast<unsigned char>(ch)];
+}
+
+WordHashMap::WordHashMap(size_t initialCapacity)
+    : m_Slots(std::bit_ceil(std::max<size_t>(initialCapacity, 2)))
+    , m_WordsCount{0}
+{
+}
+
+void WordHashMap::addOccurrences(std::string_view word, Occurrences occurrences)
+{
+    if (!word.empty() && occurrences > 0)
+    {
+        _addOccurrences(word, _computeHash(word), occurrences);
+    }
+}
+
+// the words of the merged map are already in lower case and their hashes already computed
+void WordHashMap::merge(const WordHashMap& wordHashMap)
+{
+    assert(this != &wordHashMap);
+
+    for (const auto& slot : wordHashMap.m_Slots)
+    {
+        if (slot.m_Occurrences > 0)
+        {
+            _addOccurrences(wordHashMap._getWord(slot), slot.m_Hash, slot.m_Occurrences);
+        }
+    }
+}
+
+void WordHashMap::clear()
+{
+    std::fill(m_Slots.begin(), m_Slots.end(), Slot{});
+    m_WordsArena.clear();
+    m_WordsCount = 0;
+}
+
+WordOccurrencesMap WordHashMap::getOccurrencesMap() const
+{
+    WordOccurrencesMap occurrencesMap;
+
+    for (const auto& slot : m_Slots)
+    {
+        if (slot.m_Occurrences > 0)
+        {
+            occurrencesMap.emplace(_getWord(slot), slot.m_Occurrences);
+        }
+    }
+
+    return occurrencesMap;
+}
+
+size_t WordHashMap::getWordsCount() const
+{
+    return m_WordsCount;
+}
+
+Occurrences WordHashMap::getTotalOccurrences() const
+{
+    Occurrences totalOccurrences{0};
+
+    for (const auto& slot : m_Slots)
+    {
+        totalOccurrences += slot.m_Occurrences;
+    }
+
+    return totalOccurrences;
+}
+
+void WordHashMap::_addOccurrences(std::string_view word, size_t hash, Occurrences occurrences)
+{
+    // keep the load factor below 1/2 so the probing sequences remain short
+    if (2 * (m_WordsCount + 1) > m_Slots.size())
+    {
+        _grow();
+    }
+
+    const size_t c_Mask{m_Slots.size() - 1};
+
+    for (size_t index{hash & c_Mask};; index = (index + 1) & c_Mask)
+    {
+        Slot& slot{m_Slots[index]};
+
+        if (0 == slot.m_Occurrences)
+        {
+            slot.m_Hash = hash;
+            slot.m_WordOffset = m_WordsArena.size();
+            slot.m_WordSize = word.size();
+            slot.m_Occurrences = occurrences;
+
+            std::transform(word.cbegin(), word.cend(), std::back_inserter(m_WordsArena), toLowerCase);
+            ++m_WordsCount;
+            break;
+        }
+
+        if (slot.m_Hash == hash && _areEqualIgnoringCase(word, _getWord(slot)))
+        {
+            slot.m_Occurrences += occurrences;
+            break;
+        }
+    }
+}
+
+void WordHashMap::_grow()
+{
+    std::vector<Slot> slots(2 * m_Slots.size());
+    const size_t c_Mask{slots.size() - 1};
+
+    for (const auto& slot : m_Slots)
+    {
+        if (slot.m_Occurrences > 0)
+        {
+            size_t index{slot.m_Hash & c_Mask};
+
+            while (slots[index].m_Occurrences > 0)
+            {
+                index = (index + 1) & c_Mask;
+            }
+
+            slots[index] = slot;
+        }
+    }
+
+    m_Slots = std::move(slots);
+}
+
+std::string_view WordHashMap::_getWord(const Slot& slot) const
+{
+    return std::string_view{m_WordsArena}.substr(slot.m_WordOffset, slot.m_WordSize);
+}
+
+// FNV-1a computed on the lower case characters (words differing only by case get the same hash)
+size_t WordHashMap::_computeHash(std::string_view word)
+{
+    uint64_t hash{14695981039346656037ull};
+
+    for (const char ch : word)
+    {
+        hash ^= static_cast<unsigned char>(toLowerCase(ch));
+        hash *= 1099511628211ull;
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+bool WordHashMap::_areEqualIgnoringCase(std::string_view word, std::string_view lowerCaseWord)
+{
+    return word.size() == lowerCaseWord.size() &&
+           std::equal(word.cbegin(), word.cend(), lowerCaseWord.cbegin(),
+                      [](char first, char second) { return toLowerCase(first) == second; });
+}
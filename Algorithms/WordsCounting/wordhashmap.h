@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "wordscounter.h"
+
+/* Hash map dedicated to counting words:
+   - open addressing with linear probing, the slots being stored in a single array (no allocation per word)
+   - the words (keys) are stored in lower case, one after the other, in a character arena; the slots only contain the
+   offset and size of the word within the arena
+   - lookup is case insensitive so the words to be counted can be passed as views into the original text (no copy is
+   made unless the word is new)
+*/
+class WordHashMap
+{
+public:
+    explicit WordHashMap(size_t initialCapacity = 1024);
+
+    void addOccurrences(std::string_view word, Occurrences occurrences = 1);
+    void merge(const WordHashMap& wordHashMap);
+    void clear();
+
+    // sorted alphabetically (same as for WordsCounter)
+    WordOccurrencesMap getOccurrencesMap() const;
+
+    size_t getWordsCount() const;
+    Occurrences getTotalOccurrences() const;
+
+private:
+    struct Slot
+    {
+        size_t m_Hash{0};
+        size_t m_WordOffset{0};
+        size_t m_WordSize{0};
+        Occurrences m_Occurrences{0}; // 0 means the slot is empty
+    };
+
+    void _addOccurrences(std::string_view word, size_t hash, Occurrences occurrences);
+    void _grow();
+    std::string_view _getWord(const Slot& slot) const;
+
+    static size_t _computeHash(std::string_view word);
+    static bool _areEqualIgnoringCase(std::string_view word, std::string_view lowerCaseWord);
+
+    std::vector<Slot> m_Slots;
+    std::string m_WordsArena;
+    size_t m_WordsCount;
+};
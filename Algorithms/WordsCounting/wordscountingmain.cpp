@@ -1,31 +1,24 @@
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
+#include "parallelwordscounter.h"
 #include "utils.h"
-#include "wordscounter.h"
 
 static const std::string c_InFile{Utilities::c_InputOutputDir + "wordscountinginput.txt"};
 static const std::string c_OutFile{Utilities::c_InputOutputDir + "wordscountingoutput.txt"};
 
-FileContent readInputFileContent(std::ifstream& in)
+// the whole file is read into a single buffer (the words are counted directly from it)
+std::string readInputFileContent(std::ifstream& in)
 {
-    FileContent content;
+    std::ostringstream content;
 
     if (in.is_open())
     {
-        while (!in.eof())
-        {
-            Line currentLine;
-            getline(in, currentLine);
-
-            if (!currentLine.empty())
-            {
-                content.push_back(currentLine);
-            }
-        }
+        content << in.rdbuf();
     }
 
-    return content;
+    return std::move(content).str();
 }
 
 void writeOutputFileContent(const WordOccurrencesMap& occurrencesMap, std::ofstream& out)
@@ -65,10 +58,12 @@ int main()
 
     if (in.is_open() && out.is_open())
     {
-        FileContent content{readInputFileContent(in)};
-        WordsCounter wordsCounter(std::move(content));
+        const std::string c_Content{readInputFileContent(in)};
+
+        ParallelWordsCounter wordsCounter;
+        wordsCounter.countWords(c_Content);
 
-        const WordOccurrencesMap& c_OccurrencesMap{wordsCounter.getOccurrencesMap()};
+        const WordOccurrencesMap c_OccurrencesMap{wordsCounter.getOccurrencesMap()};
         writeOutputFileContent(c_OccurrencesMap, out);
 
         std::cout << "Input file: " << c_InFile << "\n";
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+#include "benchmarkrunner.h"
+#include "utils.h"
+
+BenchmarkRunner::BenchmarkRunner(size_t repetitionsCount, std::string nameFilter)
+    : m_RepetitionsCount{std::max<size_t>(repetitionsCount, 1)}
+    , m_NameFilter{std::move(nameFilter)}
+{
+}
+
+bool BenchmarkRunner::run(const std::string& name, const std::string& parameters, const Action& execute,
+                          const Action& prepare)
+{
+    bool shouldRun{name.find(m_NameFilter) != std::string::npos};
+
+    if (shouldRun)
+    {
+        std::vector<std::chrono::nanoseconds> durations;
+        durations.reserve(m_RepetitionsCount);
+
+        // first execution is for warming up only
+        for (size_t repetition{0}; repetition <= m_RepetitionsCount; ++repetition)
+        {
+            if (prepare)
+            {
+                prepare();
+            }
+
+            const auto c_StartTime{std::chrono::steady_clock::now()};
+            execute();
+            const auto c_EndTime{std::chrono::steady_clock::now()};
+
+            if (repetition > 0)
+            {
+                durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(c_EndTime - c_StartTime));
+            }
+        }
+
+        std::sort(durations.begin(), durations.end());
+
+        const size_t c_MiddleIndex{durations.size() / 2};
+        const std::chrono::nanoseconds c_MedianDuration{
+            durations.size() % 2 == 1 ? durations[c_MiddleIndex]
+                                      : (durations[c_MiddleIndex - 1] + durations[c_MiddleIndex]) / 2};
+        const std::chrono::nanoseconds c_TotalDuration{
+            std::accumulate(durations.cbegin(), durations.cend(), std::chrono::nanoseconds{0})};
+
+        m_Results.push_back(Result{name, parameters, durations.size(), durations.front(), c_MedianDuration,
+                                   c_TotalDuration / static_cast<std::chrono::nanoseconds::rep>(durations.size()),
+                                   durations.back()});
+
+        _printResult(m_Results.back());
+    }
+
+    return shouldRun;
+}
+
+const std::vector<BenchmarkRunner::Result>& BenchmarkRunner::getResults() const
+{
+    return m_Results;
+}
+
+bool BenchmarkRunner::writeResultsToFile(const std::filesystem::path& filePath, uint32_t seed) const
+{
+    std::ofstream out{filePath};
+
+    if (out.is_open())
+    {
+        out << "{\n";
+        out << "    \"seed\": " << seed << ",\n";
+        out << "    \"repetitions\": " << m_RepetitionsCount << ",\n";
+        out << "    \"benchmarks\": [";
+
+        for (size_t resultIndex{0}; resultIndex < m_Results.size(); ++resultIndex)
+        {
+            const Result& c_Result{m_Results[resultIndex]};
+
+            out << (resultIndex > 0 ? ",\n" : "\n");
+            out << "        {\n";
+            out << "            \"name\": \"" << Utilities::escapeJsonString(c_Result.m_Name) << "\",\n";
+            out << "            \"parameters\": \"" << Utilities::escapeJsonString(c_Result.m_Parameters) << "\",\n";
+            out << "            \"repetitions\": " << c_Result.m_RepetitionsCount << ",\n";
+            out << "            \"min_ns\": " << c_Result.m_MinDuration.count() << ",\n";
+            out << "            \"median_ns\": " << c_Result.m_MedianDuration.count() << ",\n";
+            out << "            \"mean_ns\": " << c_Result.m_MeanDuration.count() << ",\n";
+            out << "            \"max_ns\": " << c_Result.m_MaxDuration.count() << "\n";
+            out << "        }";
+        }
+
+        out << (m_Results.empty() ? "]\n" : "\n    ]\n");
+        out << "}\n";
+    }
+
+    return out.is_open() && out.good();
+}
+
+void BenchmarkRunner::_printResult(const Result& result)
+{
+    auto toMilliseconds{[](std::chrono::nanoseconds duration) {
+        return std::chrono::duration<double, std::milli>{duration}.count();
+    }};
+
+    std::cout << std::left << std::setw(44) << result.m_Name << std::setw(28) << result.m_Parameters << std::right
+              << std::fixed << std::setprecision(3) << std::setw(12) << toMilliseconds(result.m_MinDuration)
+              << std::setw(12) << toMilliseconds(result.m_MedianDuration) << std::setw(12)
+              << toMilliseconds(result.m_MaxDuration) << "\n";
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+/* Runs timed benchmarks and collects their results:
+   - each benchmark is run once for warming up (caches, allocator) and then the required number of times (repetitions)
+   - the (optional) preparation step is run before each execution without being timed, so algorithms that modify their
+   input can start from the same data each time
+   - the minimum, median, mean and maximum durations are reported for each benchmark (the minimum being the most stable
+   value for comparing different commits)
+   - the benchmarks can be filtered by name (only the ones containing the filter string are run)
+   - the results are written to a JSON file so they can be compared between runs (commits)
+*/
+class BenchmarkRunner
+{
+public:
+    struct Result
+    {
+        std::string m_Name;
+        std::string m_Parameters;
+        size_t m_RepetitionsCount;
+        std::chrono::nanoseconds m_MinDuration;
+        std::chrono::nanoseconds m_MedianDuration;
+        std::chrono::nanoseconds m_MeanDuration;
+        std::chrono::nanoseconds m_MaxDuration;
+    };
+
+    using Action = std::function<void()>;
+
+    explicit BenchmarkRunner(size_t repetitionsCount, std::string nameFilter = "");
+
+    // returns false if the benchmark got filtered out
+    bool run(const std::string& name, const std::string& parameters, const Action& execute, const Action& prepare = {});
+
+    const std::vector<Result>& getResults() const;
+    bool writeResultsToFile(const std::filesystem::path& filePath, uint32_t seed) const;
+
+private:
+    static void _printResult(const Result& result);
+
+    size_t m_RepetitionsCount;
+    std::string m_NameFilter;
+    std::vector<Result> m_Results;
+};
@@ -0,0 +1,658 @@
+/* Timed benchmarks for the Algorithms and Utilities libraries:
+   - the input data is randomly generated with a fixed seed (each benchmark group using its own generator), so it is
+   identical between runs and commits, no matter which benchmarks are filtered out
+   - the results are displayed and also written to a JSON file, so they can be compared between commits
+
+   Usage: Benchmarks [-r REPETITIONS] [-f NAME_FILTER] [-o OUTPUT_FILE]
+
+   - REPETITIONS: number of timed executions of each benchmark (default: 5)
+   - NAME_FILTER: only the benchmarks containing this string in their name are run (e.g. "Kruskal")
+   - OUTPUT_FILE: JSON results file (default: benchmarkresults.json in the input/output directory)
+*/
+
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "benchmarkrunner.h"
+#include "boruvka.h"
+#include "chesstable.h"
+#include "csvparser.h"
+#include "datagenerators.h"
+#include "dataorderingengine.h"
+#include "gather.h"
+#include "graphcolouring.h"
+#include "huffmanblockcompressor.h"
+#include "knighttoursolver.h"
+#include "kruskal.h"
+#include "matrixutils.h"
+#include "prim.h"
+#include "sparseprim.h"
+#include "unionfindkruskal.h"
+#include "utils.h"
+
+static constexpr uint32_t c_Seed{2024};
+static constexpr size_t c_DefaultRepetitionsCount{5};
+static const std::string c_DefaultOutFile{Utilities::c_InputOutputDir + "benchmarkresults.json"};
+
+static std::string getSizeParameters(size_t first, size_t second)
+{
+    return std::to_string(first) + "x" + std::to_string(second);
+}
+
+static void benchmarkDataOrdering(BenchmarkRunner& runner)
+{
+    std::mt19937 generator{c_Seed};
+    DataOrderingEngine engine;
+
+    for (const auto& [wordsCount, wordSize] : {std::pair<size_t, size_t>{256, 16}, {1024, 32}, {2048, 64}})
+    {
+        const DataSet c_DataSet{DataGenerators::generateDataSet(wordsCount, wordSize, generator)};
+        const std::string c_Parameters{getSizeParameters(wordsCount, wordSize) + " bits"};
+
+        runner.run("DataOrderingEngine::setDataSet", c_Parameters, [&engine, &c_DataSet]() {
+            engine.setDataSet(c_DataSet);
+        });
+
+        engine.setDataSet(c_DataSet);
+
+        runner.run("DataOrderingEngine::greedyMin", c_Parameters, [&engine]() {
+            engine.performGreedyMinSimplified();
+        });
+
+        runner.run("DataOrderingEngine::greedyMinWithInversion", c_Parameters, [&engine]() {
+            engine.performGreedyMinSimplifiedUsingInversion();
+        });
+
+        // a batch of words arrives and expires (the data set size stays the same between runs)
+        static constexpr size_t c_UpdatedWordsCount{16};
+
+        const DataSet c_UpdatedWords{DataGenerators::generateDataSet(c_UpdatedWordsCount, wordSize, generator)};
+        std::vector<OrderingIndex> updatedWordIndexes(c_UpdatedWordsCount);
+        std::iota(updatedWordIndexes.begin(), updatedWordIndexes.end(), static_cast<OrderingIndex>(wordsCount));
+
+        runner.run("DataOrderingEngine::addRemoveWords", c_Parameters,
+                   [&engine, &c_UpdatedWords, &updatedWordIndexes]() {
+                       engine.addWords(c_UpdatedWords, true);
+                       engine.removeWords(updatedWordIndexes);
+                   });
+    }
+
+    // wide words (buses) split into segments that are inverted separately
+    for (const auto& [wordsCount, wordSize] : {std::pair<size_t, size_t>{512, 128}, {1024, 256}})
+    {
+        static constexpr size_t c_SegmentsCount{4};
+
+        engine.setDataSet(DataGenerators::generateDataSet(wordsCount, wordSize, generator));
+
+        runner.run("DataOrderingEngine::segmentedGreedyMin",
+                   getSizeParameters(wordsCount, wordSize) + " bits, " + std::to_string(c_SegmentsCount) + " segments",
+                   [&engine]() { engine.performGreedyMinSimplifiedUsingSegmentedInversion(c_SegmentsCount); });
+    }
+
+    // the exact ordering is only feasible for small data sets
+    for (const size_t c_WordsCount : {12u, 16u, 20u})
+    {
+        static constexpr size_t c_WordSize{16};
+
+        engine.setDataSet(DataGenerators::generateDataSet(c_WordsCount, c_WordSize, generator));
+
+        runner.run("DataOrderingEngine::exactMinWithInversion",
+                   getSizeParameters(c_WordsCount, c_WordSize) + " bits",
+                   [&engine]() { engine.performExactMinUsingInversion(); });
+    }
+}
+
+static void benchmarkLexicographicalSort(BenchmarkRunner& runner)
+{
+    std::mt19937 generator{c_Seed};
+
+    for (const auto& [nrOfRows, nrOfColumns] : {std::pair<matrix_size_t, matrix_size_t>{1000, 10}, {4000, 20}})
+    {
+        const Matrix<int> c_Matrix{DataGenerators::generateIntMatrix(nrOfRows, nrOfColumns, 100, generator)};
+        const std::string c_Parameters{getSizeParameters(nrOfRows, nrOfColumns)};
+        Matrix<int> matrix;
+
+        for (const bool c_SortingPerRowRequired : {false, true})
+        {
+            runner.run(
+                c_SortingPerRowRequired ? "lexicographicalSort (rows sorted first)" : "lexicographicalSort",
+                c_Parameters,
+                [&matrix, c_SortingPerRowRequired]() {
+                    Utilities::lexicographicalSort(matrix, c_SortingPerRowRequired);
+                },
+                [&matrix, &c_Matrix]() { matrix = c_Matrix; });
+        }
+    }
+}
+
+static void benchmarkGatherMatrixElements(BenchmarkRunner& runner)
+{
+    std::mt19937 generator{c_Seed};
+    std::function<bool(const int&)> isEven{[](const int& element) { return element % 2 == 0; }};
+    std::vector<size_t> threadsCounts{1};
+
+    if (const size_t c_HardwareThreadsCount{std::thread::hardware_concurrency()}; c_HardwareThreadsCount > 1)
+    {
+        threadsCounts.push_back(c_HardwareThreadsCount);
+    }
+
+    for (const matrix_size_t c_MatrixSize : {100u, 1000u, 2000u})
+    {
+        const Matrix<int> c_Matrix{DataGenerators::generateIntMatrix(c_MatrixSize, c_MatrixSize, 1000, generator)};
+        Matrix<int> matrix;
+
+        runner.run(
+            "gatherMatrixElements", getSizeParameters(c_MatrixSize, c_MatrixSize),
+            [&matrix, &isEven, c_MatrixSize]() {
+                gatherMatrixElements(matrix, MatrixPoint{0u, 0u}, MatrixPoint{c_MatrixSize, c_MatrixSize},
+                                     MatrixPoint{c_MatrixSize / 2, c_MatrixSize / 2}, isEven);
+            },
+            [&matrix, &c_Matrix]() { matrix = c_Matrix; });
+
+        for (const size_t c_ThreadsCount : threadsCounts)
+        {
+            MatrixGatherer<int> gatherer{c_ThreadsCount};
+
+            runner.run(
+                "MatrixGatherer::gather (" + std::to_string(c_ThreadsCount) + " threads)",
+                getSizeParameters(c_MatrixSize, c_MatrixSize),
+                [&gatherer, &matrix, &isEven, c_MatrixSize]() {
+                    gatherer.gather(matrix, MatrixPoint{0u, 0u}, MatrixPoint{c_MatrixSize, c_MatrixSize},
+                                    MatrixPoint{c_MatrixSize / 2, c_MatrixSize / 2}, isEven);
+                },
+                [&matrix, &c_Matrix]() { matrix = c_Matrix; });
+        }
+    }
+}
+
+static void benchmarkHuffmanEncoder(BenchmarkRunner& runner)
+{
+    // a single encoding is too fast to be measured reliably
+    static constexpr size_t c_EncodingsCount{1000};
+    static constexpr size_t c_MaxCodeLength{11};
+
+    std::mt19937 generator{c_Seed};
+    HuffmanEncoder encoder;
+
+    for (const size_t c_CharsCount : {16u, 94u})
+    {
+        const EncodingInput c_EncodingInput{DataGenerators::generateHuffmanInput(c_CharsCount, generator)};
+
+        runner.run("HuffmanEncoder::encode",
+                   std::to_string(c_CharsCount) + " chars, " + std::to_string(c_EncodingsCount) + " times",
+                   [&encoder, &c_EncodingInput]() {
+                       for (size_t encodingIndex{0}; encodingIndex < c_EncodingsCount; ++encodingIndex)
+                       {
+                           encoder.encode(c_EncodingInput);
+                       }
+                   });
+
+        // the codes of the generated input exceed the limit, so the package-merge algorithm is also run
+        runner.run("HuffmanEncoder::encode (max 11 bits)",
+                   std::to_string(c_CharsCount) + " chars, " + std::to_string(c_EncodingsCount) + " times",
+                   [&encoder, &c_EncodingInput]() {
+                       for (size_t encodingIndex{0}; encodingIndex < c_EncodingsCount; ++encodingIndex)
+                       {
+                           encoder.encode(c_EncodingInput, c_MaxCodeLength);
+                       }
+                   });
+    }
+}
+
+static void benchmarkHuffmanBlockCompressor(BenchmarkRunner& runner)
+{
+    static constexpr size_t c_LinesCount{200000};
+    static constexpr size_t c_WordsPerLine{12};
+    static constexpr size_t c_VocabularySize{20000};
+    static constexpr size_t c_BlockSize{1 << 18};
+
+    std::mt19937 generator{c_Seed};
+    std::string text;
+
+    for (const std::string& c_Line :
+         DataGenerators::generateText(c_LinesCount, c_WordsPerLine, c_VocabularySize, generator))
+    {
+        text += c_Line + '\n';
+    }
+
+    const std::string c_TextSize{std::to_string(text.size() >> 20) + "MB, "};
+
+    // single thread vs. all hardware threads
+    std::vector<size_t> threadsCounts{1};
+
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        threadsCounts.push_back(std::thread::hardware_concurrency());
+    }
+
+    for (const auto& [codeTableMode, modeName] :
+         {std::pair{HuffmanBlockCompressor::CodeTableMode::SHARED, "shared"},
+          std::pair{HuffmanBlockCompressor::CodeTableMode::PER_BLOCK, "per block"}})
+    {
+        for (const size_t c_ThreadsCount : threadsCounts)
+        {
+            const HuffmanBlockCompressor c_Compressor{c_BlockSize, codeTableMode, c_ThreadsCount};
+            const std::string c_Parameters{c_TextSize + modeName + ", " + std::to_string(c_ThreadsCount) + " thr"};
+            CompressedData compressedData;
+            std::string decompressedText;
+
+            runner.run("HuffmanBlockCompressor::compress", c_Parameters, [&c_Compressor, &text, &compressedData]() {
+                c_Compressor.compress(text, compressedData);
+            });
+
+            runner.run("HuffmanBlockCompressor::decompress", c_Parameters,
+                       [&c_Compressor, &compressedData, &decompressedText]() {
+                           c_Compressor.decompress(compressedData, decompressedText);
+                       });
+        }
+    }
+}
+
+// powers of 2, up to the hardware threads count
+static std::vector<size_t> getThreadsCounts()
+{
+    std::vector<size_t> threadsCounts;
+
+    for (size_t threadsCount{1}; threadsCount <= std::max<size_t>(std::thread::hardware_concurrency(), 1);
+         threadsCount *= 2)
+    {
+        threadsCounts.push_back(threadsCount);
+    }
+
+    return threadsCounts;
+}
+
+/* The trees built by the benchmarked engine are checked after running the benchmark (not timed):
+   - their costs are compared with the ones of the reference trees, the trees themselves might differ as ties between
+   equal cost edges are broken differently by each engine
+   - an error is displayed if the trees are invalid (the benchmark results being still recorded)
+*/
+static void runTreesBenchmark(BenchmarkRunner& runner, const std::string& name, const std::string& parameters,
+                              const BaseEngine& engine, const std::function<bool()>& buildTrees,
+                              const std::function<const BaseEngine&()>& getReferenceEngine,
+                              const std::function<Cost(const Edge&)>& getEdgeCost)
+{
+    bool success{true};
+
+    auto getTreeCost{[&getEdgeCost](const Tree& tree) {
+        return std::accumulate(tree.cbegin(), tree.cend(), Cost{0},
+                               [&getEdgeCost](Cost cost, const Edge& edge) { return cost + getEdgeCost(edge); });
+    }};
+
+    if (runner.run(name, parameters, [&buildTrees, &success]() { success = buildTrees() && success; }))
+    {
+        const BaseEngine& c_ReferenceEngine{getReferenceEngine()};
+
+        if (!success || getTreeCost(engine.getMinTree()) != getTreeCost(c_ReferenceEngine.getMinTree()) ||
+            getTreeCost(engine.getMaxTree()) != getTreeCost(c_ReferenceEngine.getMaxTree()))
+        {
+            std::cerr << "Invalid trees built by " << name << " (" << parameters << ")\n";
+        }
+    }
+}
+
+static void benchmarkKruskalPrim(BenchmarkRunner& runner)
+{
+    static constexpr Cost c_MaxEdgeCost{1000};
+
+    std::mt19937 generator{c_Seed};
+    KruskalEngine kruskalEngine;
+    PrimEngine primEngine;
+    UnionFindKruskalEngine unionFindKruskalEngine;
+    BoruvkaEngine boruvkaEngine;
+
+    for (const auto& [nodesCount, density] : {std::pair<size_t, double>{200, 0.9}, {1000, 0.5}, {2000, 0.05}})
+    {
+        const GraphMatrix c_GraphMatrix{
+            DataGenerators::generateGraphMatrix(nodesCount, density, c_MaxEdgeCost, generator)};
+        std::ostringstream parameters;
+        parameters << nodesCount << " nodes, density " << std::fixed << std::setprecision(2) << density;
+
+        // built on first use (not required if all tree benchmarks are filtered out)
+        std::optional<UnionFindKruskalEngine> referenceEngine;
+
+        auto getReferenceEngine{[&referenceEngine, &c_GraphMatrix]() -> const BaseEngine& {
+            if (!referenceEngine)
+            {
+                referenceEngine.emplace();
+                referenceEngine->buildTrees(c_GraphMatrix);
+            }
+
+            return *referenceEngine;
+        }};
+
+        auto getEdgeCost{[&c_GraphMatrix](const Edge& edge) {
+            return c_GraphMatrix.at(static_cast<matrix_size_t>(edge.first), static_cast<matrix_size_t>(edge.second));
+        }};
+
+        runTreesBenchmark(
+            runner, "KruskalEngine::buildTrees", parameters.str(), kruskalEngine,
+            [&kruskalEngine, &c_GraphMatrix]() { return kruskalEngine.buildTrees(c_GraphMatrix); },
+            getReferenceEngine, getEdgeCost);
+
+        runTreesBenchmark(
+            runner, "PrimEngine::buildTrees", parameters.str(), primEngine,
+            [&primEngine, &c_GraphMatrix]() { return primEngine.buildTrees(c_GraphMatrix); }, getReferenceEngine,
+            getEdgeCost);
+
+        runTreesBenchmark(
+            runner, "UnionFindKruskalEngine::buildTrees", parameters.str(), unionFindKruskalEngine,
+            [&unionFindKruskalEngine, &c_GraphMatrix]() { return unionFindKruskalEngine.buildTrees(c_GraphMatrix); },
+            getReferenceEngine, getEdgeCost);
+
+        runTreesBenchmark(
+            runner, "BoruvkaEngine::buildTrees (" + std::to_string(boruvkaEngine.getThreadsCount()) + " threads)",
+            parameters.str(), boruvkaEngine,
+            [&boruvkaEngine, &c_GraphMatrix]() { return boruvkaEngine.buildTrees(c_GraphMatrix); },
+            getReferenceEngine, getEdgeCost);
+    }
+
+    // sparse graphs provided as edges (the large one doesn't fit into a cost matrix) to the engines supporting them
+    for (const auto& [nodesCount, density] : {std::pair<size_t, double>{2000, 0.004}, {1000000, 0.000008}})
+    {
+        const WeightedEdges c_Edges{DataGenerators::generateGraphEdges(nodesCount, density, c_MaxEdgeCost, generator)};
+        const std::string c_Parameters{std::to_string(nodesCount) + " nodes, " + std::to_string(c_Edges.size()) +
+                                       " edges"};
+
+        SparseGraph graph;
+        graph.build(nodesCount, c_Edges);
+
+        std::optional<UnionFindKruskalEngine> referenceEngine;
+
+        auto getReferenceEngine{[&referenceEngine, &c_Edges, nodesCount]() -> const BaseEngine& {
+            if (!referenceEngine)
+            {
+                referenceEngine.emplace();
+                referenceEngine->buildTrees(nodesCount, c_Edges);
+            }
+
+            return *referenceEngine;
+        }};
+
+        auto getEdgeCost{[&graph](const Edge& edge) { return graph.getEdgeCost(edge).value_or(0); }};
+
+        runTreesBenchmark(
+            runner, "UnionFindKruskalEngine::buildTrees", c_Parameters, unionFindKruskalEngine,
+            [&unionFindKruskalEngine, &c_Edges, nodesCount]() {
+                return unionFindKruskalEngine.buildTrees(nodesCount, c_Edges);
+            },
+            getReferenceEngine, getEdgeCost);
+
+        SparsePrimEngine sparsePrimEngine;
+
+        runTreesBenchmark(
+            runner, "SparsePrimEngine::buildTrees", c_Parameters, sparsePrimEngine,
+            [&sparsePrimEngine, &graph]() { return sparsePrimEngine.buildTrees(graph); }, getReferenceEngine,
+            getEdgeCost);
+
+        for (const size_t c_ThreadsCount : getThreadsCounts())
+        {
+            BoruvkaEngine edgesBoruvkaEngine{c_ThreadsCount};
+
+            runTreesBenchmark(
+                runner, "BoruvkaEngine::buildTrees (" + std::to_string(c_ThreadsCount) + " threads)",
+                c_Parameters, edgesBoruvkaEngine,
+                [&edgesBoruvkaEngine, &c_Edges, nodesCount]() {
+                    return edgesBoruvkaEngine.buildTrees(nodesCount, c_Edges);
+                },
+                getReferenceEngine, getEdgeCost);
+        }
+    }
+}
+
+// the colourings are checked after running each benchmark (not timed)
+static void benchmarkMapColouring(BenchmarkRunner& runner)
+{
+    using ColourGraph = std::function<GraphColouring::Colours(const CountriesGraph&)>;
+
+    std::mt19937 generator{c_Seed};
+    std::vector<std::pair<std::string, ColourGraph>> colouringAlgorithms{
+        {"colourGreedily", GraphColouring::colourGreedily},
+        {"colourWithDSatur", GraphColouring::colourWithDSatur}};
+
+    for (const size_t c_ThreadsCount : getThreadsCounts())
+    {
+        colouringAlgorithms.emplace_back(
+            "colourInParallel (" + std::to_string(c_ThreadsCount) + " threads)",
+            [c_ThreadsCount](const CountriesGraph& graph) {
+                return GraphColouring::colourInParallel(graph, c_ThreadsCount);
+            });
+    }
+
+    for (const size_t c_MapSize : {100u, 500u, 1000u})
+    {
+        const CountriesGraph::Neighbourships c_Neighbourships{
+            DataGenerators::generatePlanarMap(c_MapSize, c_MapSize, generator)};
+        const std::string c_Parameters{getSizeParameters(c_MapSize, c_MapSize) + " countries"};
+        CountriesGraph graph;
+
+        runner.run("CountriesGraph::build", c_Parameters, [&graph, &c_Neighbourships, c_MapSize]() {
+            graph.build(c_MapSize * c_MapSize, c_Neighbourships);
+        });
+
+        graph.build(c_MapSize * c_MapSize, c_Neighbourships);
+
+        for (const auto& [name, colourGraph] : colouringAlgorithms)
+        {
+            GraphColouring::Colours colours;
+
+            if (runner.run(name, c_Parameters, [&colours, &colourGraph, &graph]() { colours = colourGraph(graph); }) &&
+                !GraphColouring::isValidColouring(graph, colours))
+            {
+                std::cerr << "Invalid colouring: " << name << " (" << c_Parameters << ")\n";
+            }
+        }
+    }
+}
+
+// each table is traversed from the corners, the center and a few random positions
+static void benchmarkKnightTour(BenchmarkRunner& runner)
+{
+    static constexpr size_t c_RandomStartPositionsCount{4};
+
+    std::mt19937 generator{c_Seed};
+    KnightTourSolver solver;
+
+    for (const matrix_size_t c_TableSize : {8u, 50u, 200u, 500u})
+    {
+        std::vector<KnightTourSolver::StartPosition> startPositions{{0, 0},
+                                                                    {0, c_TableSize - 1},
+                                                                    {c_TableSize - 1, 0},
+                                                                    {c_TableSize - 1, c_TableSize - 1},
+                                                                    {c_TableSize / 2, c_TableSize / 2}};
+        std::uniform_int_distribution<matrix_size_t> positionDistribution{0, c_TableSize - 1};
+
+        for (size_t index{0}; index < c_RandomStartPositionsCount; ++index)
+        {
+            startPositions.emplace_back(positionDistribution(generator), positionDistribution(generator));
+        }
+
+        const std::string c_Parameters{getSizeParameters(c_TableSize, c_TableSize) + ", " +
+                                       std::to_string(startPositions.size()) + " starts"};
+        WarnsdorffEngine engine{c_TableSize, c_TableSize};
+
+        // a single traversal (no backtracking) might not cover the whole table
+        runner.run("WarnsdorffEngine::traverse", c_Parameters, [&engine, &startPositions]() {
+            for (const auto& [startRow, startColumn] : startPositions)
+            {
+                engine.traverse(startRow, startColumn);
+            }
+        });
+
+        size_t solvedCount{0};
+
+        if (runner.run("KnightTourSolver::solve", c_Parameters,
+                       [&solver, &startPositions, &solvedCount, c_TableSize]() {
+                           solvedCount = 0;
+
+                           for (const auto& startPosition : startPositions)
+                           {
+                               solvedCount += solver.solve(c_TableSize, c_TableSize, startPosition) ? 1 : 0;
+                           }
+                       }) &&
+            solvedCount < startPositions.size())
+        {
+            std::cerr << "Knight tour not found from all start positions (" << c_Parameters << ")\n";
+        }
+    }
+}
+
+static void benchmarkWordsCounter(BenchmarkRunner& runner)
+{
+    std::mt19937 generator{c_Seed};
+    WordsCounter wordsCounter;
+
+    for (const auto& [linesCount, vocabularySize] : {std::pair<size_t, size_t>{1000, 1000}, {20000, 20000}})
+    {
+        static constexpr size_t c_WordsPerLine{12};
+
+        const FileContent c_Content{
+            DataGenerators::generateText(linesCount, c_WordsPerLine, vocabularySize, generator)};
+        FileContent content;
+
+        runner.run(
+            "WordsCounter::countWords",
+            std::to_string(linesCount) + " lines, " + std::to_string(vocabularySize) + " words",
+            [&wordsCounter, &content]() { wordsCounter.countWords(std::move(content)); },
+            [&content, &c_Content]() { content = c_Content; });
+    }
+}
+
+static void benchmarkCSVParser(BenchmarkRunner& runner)
+{
+    // the parser handles at most 100 rows per file, so multiple files are parsed in a row
+    static constexpr size_t c_FilesCount{5};
+    static constexpr size_t c_RowsPerFile{100};
+
+    std::mt19937 generator{c_Seed};
+    const std::filesystem::path c_InputDir{std::filesystem::temp_directory_path() / "CPPExercisesBenchmarks"};
+    std::vector<std::filesystem::path> filePaths;
+    bool success{true};
+
+    std::filesystem::create_directories(c_InputDir);
+
+    for (size_t fileIndex{0}; success && fileIndex < c_FilesCount; ++fileIndex)
+    {
+        filePaths.push_back(c_InputDir / (std::to_string(fileIndex) + ".csv"));
+        success = DataGenerators::generateHostsCSVFile(filePaths.back(), c_RowsPerFile, generator);
+    }
+
+    if (success)
+    {
+        runner.run("CSVParser::parse",
+                   std::to_string(c_FilesCount) + " files, " + std::to_string(c_RowsPerFile) + " rows",
+                   [&filePaths]() {
+                       for (const auto& filePath : filePaths)
+                       {
+                           CSVParser parser{filePath};
+                           parser.parse();
+                       }
+                   });
+    }
+    else
+    {
+        std::cerr << "Error in writing the CSV input files, skipping CSVParser benchmark\n";
+    }
+
+    std::filesystem::remove_all(c_InputDir);
+}
+
+static void benchmarkChessTable(BenchmarkRunner& runner)
+{
+    for (const matrix_size_t c_TableSize : {8u, 100u, 1000u})
+    {
+        ChessTable chessTable{c_TableSize, c_TableSize};
+
+        runner.run("ChessTable::traverse", getSizeParameters(c_TableSize, c_TableSize), [&chessTable]() {
+            chessTable.traverse(1, 1);
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t repetitionsCount{c_DefaultRepetitionsCount};
+    std::string nameFilter;
+    std::string outFile{c_DefaultOutFile};
+    bool areArgumentsValid{true};
+    int exitCode{EXIT_SUCCESS};
+
+    for (int argIndex{1}; argIndex < argc; argIndex += 2)
+    {
+        const std::string c_Option{argv[argIndex]};
+
+        if (argIndex + 1 == argc)
+        {
+            areArgumentsValid = false;
+            break;
+        }
+
+        if (c_Option == "-r")
+        {
+            repetitionsCount = std::strtoul(argv[argIndex + 1], nullptr, 10);
+            areArgumentsValid = repetitionsCount > 0;
+        }
+        else if (c_Option == "-f")
+        {
+            nameFilter = argv[argIndex + 1];
+        }
+        else if (c_Option == "-o")
+        {
+            outFile = argv[argIndex + 1];
+        }
+        else
+        {
+            areArgumentsValid = false;
+        }
+
+        if (!areArgumentsValid)
+        {
+            break;
+        }
+    }
+
+    if (areArgumentsValid)
+    {
+        BenchmarkRunner runner{repetitionsCount, nameFilter};
+
+        std::cout << std::left << std::setw(44) << "Benchmark" << std::setw(28) << "Parameters" << std::right
+                  << std::setw(12) << "Min (ms)" << std::setw(12) << "Median (ms)" << std::setw(12) << "Max (ms)"
+                  << "\n\n";
+
+        benchmarkDataOrdering(runner);
+        benchmarkLexicographicalSort(runner);
+        benchmarkGatherMatrixElements(runner);
+        benchmarkHuffmanEncoder(runner);
+        benchmarkHuffmanBlockCompressor(runner);
+        benchmarkKruskalPrim(runner);
+        benchmarkMapColouring(runner);
+        benchmarkKnightTour(runner);
+        benchmarkWordsCounter(runner);
+        benchmarkCSVParser(runner);
+        benchmarkChessTable(runner);
+
+        if (runner.writeResultsToFile(outFile, c_Seed))
+        {
+            std::cout << "\nResults written to file: " << outFile << "\n";
+        }
+        else
+        {
+            std::cerr << "\nError in writing the results file: " << outFile << "\n";
+            exitCode = EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        std::cerr << "Invalid arguments. Usage: Benchmarks [-r REPETITIONS] [-f NAME_FILTER] [-o OUTPUT_FILE]\n";
+        exitCode = EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
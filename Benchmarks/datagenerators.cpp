@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <set>
+#include <string>
+
+#include "datagenerators.h"
+
+static constexpr char c_FirstPrintableChar{'!'};
+static constexpr char c_LastPrintableChar{'~'};
+
+// the words are combinations of syllables so they look like natural language (lowercase and capitalized)
+static std::vector<std::string> generateVocabulary(size_t vocabularySize, std::mt19937& generator)
+{
+    static const std::vector<std::string> c_Syllables{"ba", "ce", "di", "fo", "gu", "ha", "je", "ki", "lo", "mu",
+                                                      "na", "pe", "ri", "so", "tu", "va", "xe", "zi", "an", "or"};
+    std::uniform_int_distribution<size_t> syllableDistribution{0, c_Syllables.size() - 1};
+    std::uniform_int_distribution<size_t> syllablesCountDistribution{1, 4};
+    std::bernoulli_distribution isCapitalized{0.1};
+
+    std::vector<std::string> vocabulary;
+    vocabulary.reserve(vocabularySize);
+
+    for (size_t wordIndex{0}; wordIndex < vocabularySize; ++wordIndex)
+    {
+        std::string word;
+        const size_t c_SyllablesCount{syllablesCountDistribution(generator)};
+
+        for (size_t syllableIndex{0}; syllableIndex < c_SyllablesCount; ++syllableIndex)
+        {
+            word += c_Syllables[syllableDistribution(generator)];
+        }
+
+        if (isCapitalized(generator))
+        {
+            word.front() = static_cast<char>(std::toupper(static_cast<unsigned char>(word.front())));
+        }
+
+        vocabulary.push_back(std::move(word));
+    }
+
+    return vocabulary;
+}
+
+DataSet DataGenerators::generateDataSet(size_t wordsCount, size_t wordSize, std::mt19937& generator)
+{
+    std::bernoulli_distribution bitDistribution{0.5};
+    DataSet dataSet(wordsCount, DataWord(wordSize, false));
+
+    for (auto& word : dataSet)
+    {
+        for (auto bit : word)
+        {
+            bit = bitDistribution(generator);
+        }
+    }
+
+    return dataSet;
+}
+
+Matrix<int> DataGenerators::generateIntMatrix(matrix_size_t nrOfRows, matrix_size_t nrOfColumns, int maxValue,
+                                              std::mt19937& generator)
+{
+    std::uniform_int_distribution<int> valueDistribution{0, maxValue};
+    Matrix<int> matrix{nrOfRows, nrOfColumns, 0};
+
+    for (matrix_size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+        {
+            matrix.at(rowNr, columnNr) = valueDistribution(generator);
+        }
+    }
+
+    return matrix;
+}
+
+EncodingInput DataGenerators::generateHuffmanInput(size_t charsCount, std::mt19937& generator)
+{
+    const size_t c_PrintableCharsCount{static_cast<size_t>(c_LastPrintableChar - c_FirstPrintableChar + 1)};
+    const size_t c_CharsCount{std::clamp<size_t>(charsCount, 2, c_PrintableCharsCount)};
+
+    std::vector<char> chars(c_PrintableCharsCount);
+    std::iota(chars.begin(), chars.end(), c_FirstPrintableChar);
+    std::shuffle(chars.begin(), chars.end(), generator);
+
+    std::uniform_real_distribution<double> noiseDistribution{0.5, 1.5};
+    EncodingInput encodingInput{static_cast<matrix_size_t>(c_CharsCount), 2, ""};
+
+    for (size_t charIndex{0}; charIndex < c_CharsCount; ++charIndex)
+    {
+        const double c_Occurrences{1000000.0 * std::pow(0.9, static_cast<double>(charIndex)) *
+                                   noiseDistribution(generator)};
+
+        encodingInput.at(static_cast<matrix_size_t>(charIndex), 0) = std::string(1, chars[charIndex]);
+        encodingInput.at(static_cast<matrix_size_t>(charIndex), 1) =
+            std::to_string(std::max<long long>(std::llround(c_Occurrences), 1));
+    }
+
+    return encodingInput;
+}
+
+GraphMatrix DataGenerators::generateGraphMatrix(size_t nodesCount, double density, Cost maxCost,
+                                                std::mt19937& generator)
+{
+    std::bernoulli_distribution isConnected{density};
+    std::uniform_int_distribution<Cost> costDistribution{1, std::max<Cost>(maxCost, 1)};
+    GraphMatrix graphMatrix{static_cast<matrix_size_t>(nodesCount), static_cast<matrix_size_t>(nodesCount), 0};
+
+    for (matrix_size_t first{0}; first < nodesCount; ++first)
+    {
+        for (matrix_size_t second{first + 1}; second < nodesCount; ++second)
+        {
+            if (isConnected(generator))
+            {
+                const Cost c_Cost{costDistribution(generator)};
+
+                graphMatrix.at(first, second) = c_Cost;
+                graphMatrix.at(second, first) = c_Cost;
+            }
+        }
+    }
+
+    return graphMatrix;
+}
+
+WeightedEdges DataGenerators::generateGraphEdges(size_t nodesCount, double density, Cost maxCost,
+                                                std::mt19937& generator)
+{
+    WeightedEdges edges;
+    std::uniform_int_distribution<Cost> costDistribution{1, std::max<Cost>(maxCost, 1)};
+
+    if (density >= 0.5)
+    {
+        std::bernoulli_distribution isConnected{density};
+
+        for (Node first{0}; first < nodesCount; ++first)
+        {
+            for (Node second{first + 1}; second < nodesCount; ++second)
+            {
+                if (isConnected(generator))
+                {
+                    edges.push_back(WeightedEdge{Edge{first, second}, costDistribution(generator)});
+                }
+            }
+        }
+    }
+    else if (nodesCount > 1)
+    {
+        const size_t c_RequiredEdgesCount{
+            static_cast<size_t>(density * static_cast<double>(nodesCount) * static_cast<double>(nodesCount - 1) / 2)};
+        std::uniform_int_distribution<Node> nodeDistribution{0, nodesCount - 1};
+        std::set<Edge> addedEdges;
+
+        while (addedEdges.size() < c_RequiredEdgesCount)
+        {
+            Node first{nodeDistribution(generator)};
+            Node second{nodeDistribution(generator)};
+
+            if (first > second)
+            {
+                std::swap(first, second);
+            }
+
+            if (first != second && addedEdges.insert(Edge{first, second}).second)
+            {
+                edges.push_back(WeightedEdge{Edge{first, second}, costDistribution(generator)});
+            }
+        }
+
+        // otherwise equal cost edges would be handled differently than when reading them from matrix
+        std::sort(edges.begin(), edges.end(),
+                  [](const WeightedEdge& first, const WeightedEdge& second) { return first.mEdge < second.mEdge; });
+    }
+
+    return edges;
+}
+
+CountriesGraph::Neighbourships DataGenerators::generatePlanarMap(size_t rowsCount, size_t columnsCount,
+                                                                 std::mt19937& generator)
+{
+    static constexpr double c_NeighbourshipKeepingProbability{0.9};
+
+    CountriesGraph::Neighbourships neighbourships;
+
+    std::vector<CountriesGraph::Country> countries(rowsCount * columnsCount);
+    std::iota(countries.begin(), countries.end(), 0);
+    std::shuffle(countries.begin(), countries.end(), generator);
+
+    std::bernoulli_distribution shouldKeepNeighbourship{c_NeighbourshipKeepingProbability};
+    std::bernoulli_distribution isMainDiagonal{0.5};
+
+    auto addNeighbourship{[&](size_t firstRow, size_t firstColumn, size_t secondRow, size_t secondColumn) {
+        if (shouldKeepNeighbourship(generator))
+        {
+            neighbourships.emplace_back(countries[firstRow * columnsCount + firstColumn],
+                                        countries[secondRow * columnsCount + secondColumn]);
+        }
+    }};
+
+    for (size_t row{0}; row < rowsCount; ++row)
+    {
+        for (size_t column{0}; column < columnsCount; ++column)
+        {
+            if (column + 1 < columnsCount)
+            {
+                addNeighbourship(row, column, row, column + 1);
+            }
+
+            if (row + 1 < rowsCount)
+            {
+                addNeighbourship(row, column, row + 1, column);
+            }
+
+            // one diagonal per grid cell
+            if (row + 1 < rowsCount && column + 1 < columnsCount)
+            {
+                if (isMainDiagonal(generator))
+                {
+                    addNeighbourship(row, column, row + 1, column + 1);
+                }
+                else
+                {
+                    addNeighbourship(row, column + 1, row + 1, column);
+                }
+            }
+        }
+    }
+
+    return neighbourships;
+}
+
+FileContent DataGenerators::generateText(size_t linesCount, size_t wordsPerLine, size_t vocabularySize,
+                                         std::mt19937& generator)
+{
+    static const std::vector<std::string> c_Separators{" ", " ", " ", " ", ", ", ". ", "; ", " - ", "! ", "? "};
+
+    const std::vector<std::string> c_Vocabulary{generateVocabulary(std::max<size_t>(vocabularySize, 1), generator)};
+
+    // Zipf distribution: the probability of a word is inversely proportional to its rank
+    std::vector<double> weights(c_Vocabulary.size());
+
+    for (size_t rank{0}; rank < weights.size(); ++rank)
+    {
+        weights[rank] = 1.0 / static_cast<double>(rank + 1);
+    }
+
+    std::discrete_distribution<size_t> wordDistribution{weights.cbegin(), weights.cend()};
+    std::uniform_int_distribution<size_t> separatorDistribution{0, c_Separators.size() - 1};
+
+    FileContent content;
+    content.reserve(linesCount);
+
+    for (size_t lineIndex{0}; lineIndex < linesCount; ++lineIndex)
+    {
+        std::string line;
+
+        for (size_t wordIndex{0}; wordIndex < wordsPerLine; ++wordIndex)
+        {
+            line += c_Vocabulary[wordDistribution(generator)];
+            line += c_Separators[separatorDistribution(generator)];
+        }
+
+        content.push_back(std::move(line));
+    }
+
+    return content;
+}
+
+bool DataGenerators::generateHostsCSVFile(const std::filesystem::path& filePath, size_t rowsCount,
+                                          std::mt19937& generator)
+{
+    static constexpr char c_HexDigits[]{"0123456789ABCDEF"};
+
+    std::ofstream out{filePath};
+
+    if (out.is_open())
+    {
+        // all classes (A to D) covered, loopback (127) and network/broadcast addresses excluded so all rows are valid
+        std::uniform_int_distribution<int> firstByteDistribution{1, 238};
+        std::uniform_int_distribution<int> byteDistribution{1, 254};
+        std::uniform_int_distribution<int> hexDigitDistribution{0, 15};
+
+        for (size_t rowIndex{0}; rowIndex < rowsCount; ++rowIndex)
+        {
+            std::string macAddress;
+
+            for (size_t digitIndex{0}; digitIndex < 12; ++digitIndex)
+            {
+                macAddress += c_HexDigits[hexDigitDistribution(generator)];
+            }
+
+            const int c_FirstByte{firstByteDistribution(generator)};
+
+            // no new line after the last row (would be parsed as empty row)
+            out << (rowIndex > 0 ? "\n" : "") << "\"my_host" << rowIndex << "\",\"" << macAddress << "\",\""
+                << (c_FirstByte < 127 ? c_FirstByte : c_FirstByte + 1) << "." << byteDistribution(generator) << "."
+                << byteDistribution(generator) << "." << byteDistribution(generator) << "\"";
+        }
+    }
+
+    return out.is_open() && out.good();
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <filesystem>
+#include <random>
+
+#include "countriesgraph.h"
+#include "datautils.h"
+#include "graphdatatypes.h"
+#include "huffmanencoder.h"
+#include "matrix.h"
+#include "wordscounter.h"
+
+/* Generators of benchmark input data:
+   - all data is generated by using the provided random generator, so the input is reproducible when using a fixed
+   seed
+   - the data is generated in a format accepted by the benchmarked algorithms (e.g. Huffman input as character /
+   occurrences matrix)
+*/
+namespace DataGenerators
+{
+// random words with equal probability for 0 and 1 bits
+DataSet generateDataSet(size_t wordsCount, size_t wordSize, std::mt19937& generator);
+
+// elements uniformly distributed between 0 and maxValue
+Matrix<int> generateIntMatrix(matrix_size_t nrOfRows, matrix_size_t nrOfColumns, int maxValue,
+                              std::mt19937& generator);
+
+// printable characters with (roughly) geometrically decreasing occurrences, as in natural language text
+EncodingInput generateHuffmanInput(size_t charsCount, std::mt19937& generator);
+
+// symmetric cost matrix, each node pair being connected (non-zero cost) with the given probability
+GraphMatrix generateGraphMatrix(size_t nodesCount, double density, Cost maxCost, std::mt19937& generator);
+
+/* Edges of a graph with the given ratio of connected node pairs, sorted by nodes (same order as when reading them
+   from a cost matrix):
+   - for dense graphs each node pair is connected with the given probability
+   - for sparse graphs random node pairs are added until the required edges count is reached (large graphs being
+   supported this way, as the node pairs are not checked one by one)
+*/
+WeightedEdges generateGraphEdges(size_t nodesCount, double density, Cost maxCost, std::mt19937& generator);
+
+/* Planar map: the countries are placed on a grid, each one being the neighbour of the adjacent countries from the same
+   row and column and of one of the diagonally adjacent countries (triangulated grid):
+   - a few neighbourships are randomly removed
+   - the countries are randomly renumbered, so the index order doesn't follow the grid
+*/
+CountriesGraph::Neighbourships generatePlanarMap(size_t rowsCount, size_t columnsCount, std::mt19937& generator);
+
+// lines of words taken from a fixed vocabulary (Zipf distributed) and separated by spaces and punctuation
+FileContent generateText(size_t linesCount, size_t wordsPerLine, size_t vocabularySize, std::mt19937& generator);
+
+// hosts CSV file (hostname, MAC, IP), returns false if the file could not be written
+bool generateHostsCSVFile(const std::filesystem::path& filePath, size_t rowsCount, std::mt19937& generator);
+} // namespace DataGenerators
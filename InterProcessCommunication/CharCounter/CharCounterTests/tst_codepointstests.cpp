@@ -0,0 +1,266 @@
+// clang-format off
+#include <QTest>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include "concreteaggregators.h"
+#include "concreteparsers.h"
+
+using Bytes = std::vector<unsigned char>;
+
+class CodePointsTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testDecodeMultiByteSequence();
+    void testGetAsciiPrefixSize();
+    void testAverageAggregator();
+
+    void testDecodeMultiByteSequence_data();
+    void testGetAsciiPrefixSize_data();
+    void testAverageAggregator_data();
+};
+
+// the occurrences differ from file to file, so a lost or duplicated aggregation changes the averages
+static CodePointOccurrences getFileCodePointOccurrences(size_t fileIndex)
+{
+    CodePointOccurrences codePointOccurrences;
+
+    codePointOccurrences.add(U'a', fileIndex + 1);
+    codePointOccurrences.add(char32_t{0xE9}, 2 * fileIndex + 1);
+    codePointOccurrences.add(U'\U0001F600', fileIndex % 3);
+    codePointOccurrences.add(static_cast<char32_t>(0x400 + fileIndex % 16));
+
+    return codePointOccurrences;
+}
+
+static CharOccurrencesArray getFileCharOccurrences(size_t fileIndex)
+{
+    CharOccurrencesArray charOccurrences{};
+
+    charOccurrences['a'] = fileIndex + 1;
+    charOccurrences['0'] = fileIndex % 5;
+    charOccurrences[0xFF] = 3;
+
+    return charOccurrences;
+}
+
+// the bytes are copied into a buffer of exactly charsCount bytes, so reading beyond the end can be detected by sanitizers
+void CodePointsTests::testDecodeMultiByteSequence()
+{
+    QFETCH(Bytes, bytes);
+    QFETCH(size_t, charsCount);
+    QFETCH(size_t, sequenceSize);
+    QFETCH(char32_t, codePoint);
+
+    const std::unique_ptr<unsigned char[]> c_pBuffer{new unsigned char[charsCount]};
+    std::copy_n(bytes.cbegin(), charsCount, c_pBuffer.get());
+
+    char32_t decodedCodePoint{0};
+
+    QCOMPARE(CodePointsParser::decodeMultiByteSequence(c_pBuffer.get(), charsCount, decodedCodePoint), sequenceSize);
+
+    if (sequenceSize > 0)
+    {
+        QCOMPARE(static_cast<uint32_t>(decodedCodePoint), static_cast<uint32_t>(codePoint));
+    }
+}
+
+void CodePointsTests::testGetAsciiPrefixSize()
+{
+    QFETCH(size_t, charsCount);
+    QFETCH(size_t, bufferOffset);
+    QFETCH(std::vector<size_t>, nonAsciiPositions);
+    QFETCH(unsigned char, nonAsciiChar);
+
+    // the buffer is offset from an aligned allocation so unaligned loads are tested as well (ASCII chars include 0x00 and 0x7F)
+    std::vector<char> buffer(bufferOffset + charsCount);
+
+    for (size_t charIndex{0}; charIndex < charsCount; ++charIndex)
+    {
+        buffer[bufferOffset + charIndex] = static_cast<char>(charIndex % 0x80);
+    }
+
+    for (const size_t c_Position : nonAsciiPositions)
+    {
+        buffer[bufferOffset + c_Position] = static_cast<char>(nonAsciiChar);
+    }
+
+    const size_t c_ExpectedPrefixSize{nonAsciiPositions.empty() ? charsCount : *std::min_element(nonAsciiPositions.cbegin(), nonAsciiPositions.cend())};
+
+    QCOMPARE(CodePointsParser::getAsciiPrefixSize(buffer.data() + bufferOffset, charsCount), c_ExpectedPrefixSize);
+}
+
+void CodePointsTests::testAverageAggregator()
+{
+    QFETCH(size_t, threadsCount);
+    QFETCH(size_t, filesCount);
+
+    AverageAggregator codePointsAggregator;
+    AverageAggregator charsAggregator;
+    std::vector<std::thread> threads;
+
+    for (size_t threadIndex{0}; threadIndex < threadsCount; ++threadIndex)
+    {
+        threads.emplace_back([&codePointsAggregator, &charsAggregator, threadIndex, threadsCount, filesCount]() {
+            for (size_t fileIndex{threadIndex}; fileIndex < filesCount; fileIndex += threadsCount)
+            {
+                codePointsAggregator.aggregate(getFileCodePointOccurrences(fileIndex));
+                charsAggregator.aggregate(getFileCharOccurrences(fileIndex));
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CodePointOccurrences totalCodePointOccurrences;
+    CharOccurrencesArray totalCharOccurrences{};
+
+    for (size_t fileIndex{0}; fileIndex < filesCount; ++fileIndex)
+    {
+        getFileCodePointOccurrences(fileIndex).forEachOccurrence([&totalCodePointOccurrences](char32_t codePoint, size_t occurrences) {totalCodePointOccurrences.add(codePoint, occurrences);});
+
+        const CharOccurrencesArray c_FileCharOccurrences{getFileCharOccurrences(fileIndex)};
+
+        for (size_t byte{0}; byte < totalCharOccurrences.size(); ++byte)
+        {
+            totalCharOccurrences[byte] += c_FileCharOccurrences[byte];
+        }
+    }
+
+    // averages rounded up
+    size_t codePointsCount{0};
+    bool areCodePointAveragesCorrect{true};
+
+    totalCodePointOccurrences.forEachOccurrence([&codePointsAggregator, &codePointsCount, &areCodePointAveragesCorrect, filesCount](char32_t codePoint, size_t occurrences) {
+        areCodePointAveragesCorrect = areCodePointAveragesCorrect && codePointsAggregator.getCodePointOccurrences().get(codePoint) == (occurrences + filesCount - 1) / filesCount;
+        ++codePointsCount;
+    });
+
+    codePointsAggregator.getCodePointOccurrences().forEachOccurrence([&codePointsCount](char32_t, size_t) {--codePointsCount;});
+
+    QVERIFY(areCodePointAveragesCorrect);
+    QCOMPARE(codePointsCount, size_t{0});
+
+    for (size_t byte{0}; byte < totalCharOccurrences.size(); ++byte)
+    {
+        QCOMPARE(charsAggregator.getCharOccurrences()[byte], (totalCharOccurrences[byte] + filesCount - 1) / filesCount);
+    }
+}
+
+void CodePointsTests::testDecodeMultiByteSequence_data()
+{
+    QTest::addColumn<Bytes>("bytes");
+    QTest::addColumn<size_t>("charsCount");
+    QTest::addColumn<size_t>("sequenceSize");
+    QTest::addColumn<char32_t>("codePoint");
+
+    QTest::newRow("2 bytes: min code point") << Bytes{0xC2, 0x80} << size_t{2} << size_t{2} << char32_t{0x80};
+    QTest::newRow("2 bytes: e acute") << Bytes{0xC3, 0xA9} << size_t{2} << size_t{2} << char32_t{0xE9};
+    QTest::newRow("2 bytes: max code point") << Bytes{0xDF, 0xBF} << size_t{2} << size_t{2} << char32_t{0x7FF};
+    QTest::newRow("2 bytes: followed by ASCII") << Bytes{0xC3, 0xA9, 0x41} << size_t{3} << size_t{2} << char32_t{0xE9};
+    QTest::newRow("2 bytes: overlong NUL") << Bytes{0xC0, 0x80} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("2 bytes: overlong max") << Bytes{0xC1, 0xBF} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("2 bytes: ASCII continuation") << Bytes{0xC2, 0x41} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("2 bytes: lead byte continuation") << Bytes{0xC2, 0xC2} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("2 bytes: truncated at buffer end") << Bytes{0xC2} << size_t{1} << size_t{0} << char32_t{0};
+    QTest::newRow("2 bytes: truncated by chars count") << Bytes{0xC3, 0xA9} << size_t{1} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: min code point") << Bytes{0xE0, 0xA0, 0x80} << size_t{3} << size_t{3} << char32_t{0x800};
+    QTest::newRow("3 bytes: euro sign") << Bytes{0xE2, 0x82, 0xAC} << size_t{3} << size_t{3} << char32_t{0x20AC};
+    QTest::newRow("3 bytes: max code point") << Bytes{0xEF, 0xBF, 0xBF} << size_t{3} << size_t{3} << char32_t{0xFFFF};
+    QTest::newRow("3 bytes: overlong NUL") << Bytes{0xE0, 0x80, 0x80} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: overlong max") << Bytes{0xE0, 0x9F, 0xBF} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: before surrogates") << Bytes{0xED, 0x9F, 0xBF} << size_t{3} << size_t{3} << char32_t{0xD7FF};
+    QTest::newRow("3 bytes: first high surrogate") << Bytes{0xED, 0xA0, 0x80} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: last high surrogate") << Bytes{0xED, 0xAF, 0xBF} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: first low surrogate") << Bytes{0xED, 0xB0, 0x80} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: last low surrogate") << Bytes{0xED, 0xBF, 0xBF} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: after surrogates") << Bytes{0xEE, 0x80, 0x80} << size_t{3} << size_t{3} << char32_t{0xE000};
+    QTest::newRow("3 bytes: invalid second byte") << Bytes{0xE2, 0x41, 0xAC} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: invalid third byte") << Bytes{0xE2, 0x82, 0x41} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: truncated at buffer end (1 byte)") << Bytes{0xE2} << size_t{1} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: truncated at buffer end (2 bytes)") << Bytes{0xE2, 0x82} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("3 bytes: truncated by chars count") << Bytes{0xE2, 0x82, 0xAC} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: min code point") << Bytes{0xF0, 0x90, 0x80, 0x80} << size_t{4} << size_t{4} << char32_t{0x10000};
+    QTest::newRow("4 bytes: emoji") << Bytes{0xF0, 0x9F, 0x98, 0x80} << size_t{4} << size_t{4} << char32_t{0x1F600};
+    QTest::newRow("4 bytes: max code point") << Bytes{0xF4, 0x8F, 0xBF, 0xBF} << size_t{4} << size_t{4} << char32_t{0x10FFFF};
+    QTest::newRow("4 bytes: overlong max BMP") << Bytes{0xF0, 0x8F, 0xBF, 0xBF} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: overlong NUL") << Bytes{0xF0, 0x80, 0x80, 0x80} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: above max code point") << Bytes{0xF4, 0x90, 0x80, 0x80} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: lead byte F5") << Bytes{0xF5, 0x80, 0x80, 0x80} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: lead byte F7") << Bytes{0xF7, 0xBF, 0xBF, 0xBF} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: invalid fourth byte") << Bytes{0xF0, 0x9F, 0x98, 0xC0} << size_t{4} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: truncated at buffer end (3 bytes)") << Bytes{0xF0, 0x9F, 0x98} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("4 bytes: truncated by chars count") << Bytes{0xF0, 0x9F, 0x98, 0x80} << size_t{3} << size_t{0} << char32_t{0};
+    QTest::newRow("5 bytes lead byte") << Bytes{0xF8, 0x88, 0x80, 0x80, 0x80} << size_t{5} << size_t{0} << char32_t{0};
+    QTest::newRow("6 bytes lead byte") << Bytes{0xFC, 0x84, 0x80, 0x80, 0x80, 0x80} << size_t{6} << size_t{0} << char32_t{0};
+    QTest::newRow("byte FE") << Bytes{0xFE} << size_t{1} << size_t{0} << char32_t{0};
+    QTest::newRow("byte FF") << Bytes{0xFF} << size_t{1} << size_t{0} << char32_t{0};
+    QTest::newRow("first continuation byte") << Bytes{0x80, 0x80} << size_t{2} << size_t{0} << char32_t{0};
+    QTest::newRow("last continuation byte") << Bytes{0xBF} << size_t{1} << size_t{0} << char32_t{0};
+}
+
+/* The non-ASCII chars are placed around the 16 chars (SSE2) and 8 chars (SWAR) boundaries:
+   - the SSE2 loop processes the chars in blocks of 16, the remaining ones are processed in blocks of 8 then one by one
+   - without SSE2 the blocks of 8 chars are processed from the beginning of the buffer
+*/
+void CodePointsTests::testGetAsciiPrefixSize_data()
+{
+    QTest::addColumn<size_t>("charsCount");
+    QTest::addColumn<size_t>("bufferOffset");
+    QTest::addColumn<std::vector<size_t>>("nonAsciiPositions");
+    QTest::addColumn<unsigned char>("nonAsciiChar");
+
+    for (const size_t c_CharsCount : {0, 1, 7, 8, 9, 15, 16, 17, 23, 24, 25, 31, 32, 33, 40, 47, 48, 49, 64, 100})
+    {
+        for (const size_t c_BufferOffset : {0, 1, 7})
+        {
+            const std::string c_RowPrefix{std::to_string(c_CharsCount) + " chars, offset " + std::to_string(c_BufferOffset) + ": "};
+
+            QTest::newRow((c_RowPrefix + "ASCII only").c_str()) << c_CharsCount << c_BufferOffset << std::vector<size_t>{} << static_cast<unsigned char>(0x80);
+
+            for (const size_t c_Position : {0, 1, 7, 8, 9, 15, 16, 17, 23, 24, 31, 32, 33, 39, 47, 48, 63})
+            {
+                if (c_Position < c_CharsCount)
+                {
+                    QTest::newRow((c_RowPrefix + "non-ASCII char 0x80 at " + std::to_string(c_Position)).c_str()) << c_CharsCount << c_BufferOffset << std::vector<size_t>{c_Position} << static_cast<unsigned char>(0x80);
+                    QTest::newRow((c_RowPrefix + "non-ASCII char 0xFF at " + std::to_string(c_Position)).c_str()) << c_CharsCount << c_BufferOffset << std::vector<size_t>{c_Position} << static_cast<unsigned char>(0xFF);
+                }
+            }
+
+            if (c_CharsCount > 0)
+            {
+                QTest::newRow((c_RowPrefix + "non-ASCII char at end").c_str()) << c_CharsCount << c_BufferOffset << std::vector<size_t>{c_CharsCount - 1} << static_cast<unsigned char>(0xC3);
+            }
+
+            if (c_CharsCount > 20)
+            {
+                QTest::newRow((c_RowPrefix + "multiple non-ASCII chars").c_str()) << c_CharsCount << c_BufferOffset << std::vector<size_t>{c_CharsCount - 1, 18, 20} << static_cast<unsigned char>(0xE2);
+            }
+        }
+    }
+}
+
+void CodePointsTests::testAverageAggregator_data()
+{
+    QTest::addColumn<size_t>("threadsCount");
+    QTest::addColumn<size_t>("filesCount");
+
+    QTest::newRow("single thread, single file") << size_t{1} << size_t{1};
+    QTest::newRow("single thread") << size_t{1} << size_t{100};
+    QTest::newRow("2 threads") << size_t{2} << size_t{1000};
+    QTest::newRow("4 threads") << size_t{4} << size_t{1000};
+    QTest::newRow("8 threads") << size_t{8} << size_t{2000};
+    QTest::newRow("more threads than files") << size_t{8} << size_t{5};
+}
+
+QTEST_APPLESS_MAIN(CodePointsTests)
+
+#include "tst_codepointstests.moc"
+// clang-format on
@@ -0,0 +1,438 @@
+// clang-format off
+#include <QTest>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "parsingengine.h"
+#include "resultscache.h"
+
+using FileStatus = ResultsCache::FileStatus;
+using FileResult = ResultsCache::FileResult;
+
+enum class FileChange
+{
+    SIZE,
+    MODIFICATION_TIME,
+    INODE
+};
+
+class ResultsCacheTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testSaveAndLoad();
+    void testStaleEntries();
+    void testInvalidCacheFile();
+    void testMissingCacheFile();
+    void testKeyNormalization();
+    void testIsCacheFile();
+    void testCacheFileNotParsed();
+
+    void testStaleEntries_data();
+    void testInvalidCacheFile_data();
+    void testKeyNormalization_data();
+    void testIsCacheFile_data();
+};
+
+// created empty for each test and removed (along with its content) when going out of scope
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+        : m_Path{std::filesystem::temp_directory_path() / "CharCounterResultsCacheTests"}
+    {
+        std::filesystem::remove_all(m_Path);
+        std::filesystem::create_directories(m_Path);
+    }
+
+    ~TemporaryDirectory()
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(m_Path, errorCode);
+    }
+
+    std::string getFilePath(const std::string& fileName) const
+    {
+        return (m_Path / fileName).string();
+    }
+
+private:
+    std::filesystem::path m_Path;
+};
+
+static void writeFile(const std::string& filePath, const std::string& content)
+{
+    std::ofstream out{filePath, std::ios::binary};
+    out << content;
+}
+
+static FileResult getFileResult(size_t fileIndex)
+{
+    FileResult fileResult{{}, 0, fileIndex % 2 == 1};
+
+    for (size_t byte{fileIndex}; byte < fileResult.m_ByteOccurrences.size(); byte += fileIndex + 1)
+    {
+        fileResult.m_ByteOccurrences[byte] = byte * 1000 + fileIndex + 1;
+        fileResult.m_ParsedCharsCount += fileResult.m_ByteOccurrences[byte];
+    }
+
+    return fileResult;
+}
+
+static bool areResultsEqual(const FileResult& firstResult, const FileResult& secondResult)
+{
+    return firstResult.m_ByteOccurrences == secondResult.m_ByteOccurrences &&
+           firstResult.m_ParsedCharsCount == secondResult.m_ParsedCharsCount &&
+           firstResult.m_MaxCharsCountExceeded == secondResult.m_MaxCharsCountExceeded;
+}
+
+// the results of the first file contain all byte values, the results of the last file none
+void ResultsCacheTests::testSaveAndLoad()
+{
+    const TemporaryDirectory c_Directory;
+    const std::string c_CacheFilePath{c_Directory.getFilePath("results.cache")};
+    const std::vector<std::string> c_FilePaths{c_Directory.getFilePath("first.txt"), c_Directory.getFilePath("second file.txt"), c_Directory.getFilePath("third.txt"), c_Directory.getFilePath("empty.txt")};
+
+    for (size_t fileIndex{0}; fileIndex < c_FilePaths.size(); ++fileIndex)
+    {
+        writeFile(c_FilePaths[fileIndex], std::string(fileIndex + 1, 'a'));
+    }
+
+    {
+        ResultsCache resultsCache{c_CacheFilePath};
+        QVERIFY(resultsCache.load());
+
+        for (size_t fileIndex{0}; fileIndex < c_FilePaths.size(); ++fileIndex)
+        {
+            const std::optional<FileStatus> c_FileStatus{ResultsCache::getFileStatus(c_FilePaths[fileIndex])};
+            QVERIFY(c_FileStatus.has_value());
+            QVERIFY(!resultsCache.find(c_FilePaths[fileIndex], *c_FileStatus).has_value());
+
+            const FileResult c_FileResult{fileIndex + 1 < c_FilePaths.size() ? getFileResult(fileIndex) : FileResult{{}, 0, false}};
+            resultsCache.store(c_FilePaths[fileIndex], *c_FileStatus, c_FileResult);
+        }
+
+        QVERIFY(0 == resultsCache.getRetrievedResultsCount());
+        QVERIFY(resultsCache.save());
+        QVERIFY(std::filesystem::exists(c_CacheFilePath));
+        QVERIFY(!std::filesystem::exists(c_CacheFilePath + ".tmp"));
+    }
+
+    // all entries are retrieved after loading
+    {
+        ResultsCache resultsCache{c_CacheFilePath};
+        QVERIFY(resultsCache.load());
+
+        for (size_t fileIndex{0}; fileIndex < c_FilePaths.size(); ++fileIndex)
+        {
+            const std::optional<FileResult> c_FileResult{resultsCache.find(c_FilePaths[fileIndex], *ResultsCache::getFileStatus(c_FilePaths[fileIndex]))};
+            const FileResult c_ExpectedFileResult{fileIndex + 1 < c_FilePaths.size() ? getFileResult(fileIndex) : FileResult{{}, 0, false}};
+
+            QVERIFY(c_FileResult.has_value());
+            QVERIFY(areResultsEqual(*c_FileResult, c_ExpectedFileResult));
+        }
+
+        QVERIFY(c_FilePaths.size() == resultsCache.getRetrievedResultsCount());
+    }
+
+    // only the first file is used, the second one gets removed (so its entry should not be saved again)
+    {
+        ResultsCache resultsCache{c_CacheFilePath};
+        QVERIFY(resultsCache.load());
+        QVERIFY(resultsCache.find(c_FilePaths[0], *ResultsCache::getFileStatus(c_FilePaths[0])).has_value());
+
+        // no entries stored and none discarded: the cache file is not written again
+        const std::filesystem::file_time_type c_CacheModificationTime{std::filesystem::last_write_time(c_CacheFilePath) - std::chrono::hours{1}};
+        std::filesystem::last_write_time(c_CacheFilePath, c_CacheModificationTime);
+        QVERIFY(resultsCache.save());
+        QVERIFY(c_CacheModificationTime == std::filesystem::last_write_time(c_CacheFilePath));
+
+        const FileStatus c_RemovedFileStatus{*ResultsCache::getFileStatus(c_FilePaths[1])};
+        std::filesystem::remove(c_FilePaths[1]);
+        QVERIFY(resultsCache.save());
+        QVERIFY(c_CacheModificationTime != std::filesystem::last_write_time(c_CacheFilePath));
+
+        ResultsCache reloadedResultsCache{c_CacheFilePath};
+        QVERIFY(reloadedResultsCache.load());
+        QVERIFY(!reloadedResultsCache.find(c_FilePaths[1], c_RemovedFileStatus).has_value());
+
+        for (size_t fileIndex{0}; fileIndex < c_FilePaths.size(); ++fileIndex)
+        {
+            if (fileIndex != 1)
+            {
+                QVERIFY(reloadedResultsCache.find(c_FilePaths[fileIndex], *ResultsCache::getFileStatus(c_FilePaths[fileIndex])).has_value());
+            }
+        }
+    }
+}
+
+// only the tested status field should change, so each one is checked individually
+void ResultsCacheTests::testStaleEntries()
+{
+    QFETCH(FileChange, fileChange);
+
+    const TemporaryDirectory c_Directory;
+    const std::string c_CacheFilePath{c_Directory.getFilePath("results.cache")};
+    const std::string c_FilePath{c_Directory.getFilePath("file.txt")};
+    const FileResult c_FileResult{getFileResult(1)};
+
+    writeFile(c_FilePath, "abcdef");
+
+    const FileStatus c_FileStatus{*ResultsCache::getFileStatus(c_FilePath)};
+    const std::filesystem::file_time_type c_ModificationTime{std::filesystem::last_write_time(c_FilePath)};
+
+    {
+        ResultsCache resultsCache{c_CacheFilePath};
+        QVERIFY(resultsCache.load());
+        resultsCache.store(c_FilePath, c_FileStatus, c_FileResult);
+        QVERIFY(resultsCache.save());
+    }
+
+    switch (fileChange)
+    {
+    case FileChange::SIZE:
+        std::filesystem::resize_file(c_FilePath, 7);
+        std::filesystem::last_write_time(c_FilePath, c_ModificationTime);
+        break;
+    case FileChange::MODIFICATION_TIME:
+        std::filesystem::last_write_time(c_FilePath, c_ModificationTime + std::chrono::seconds{1});
+        break;
+    case FileChange::INODE:
+        writeFile(c_FilePath + ".new", "abcdef");
+        std::filesystem::rename(c_FilePath + ".new", c_FilePath);
+        std::filesystem::last_write_time(c_FilePath, c_ModificationTime);
+        break;
+    }
+
+    const FileStatus c_ChangedFileStatus{*ResultsCache::getFileStatus(c_FilePath)};
+
+    QVERIFY((FileChange::SIZE == fileChange) == (c_ChangedFileStatus.m_Size != c_FileStatus.m_Size));
+    QVERIFY((FileChange::MODIFICATION_TIME == fileChange) == (c_ChangedFileStatus.m_ModificationTime != c_FileStatus.m_ModificationTime));
+    QVERIFY((FileChange::INODE == fileChange) == (c_ChangedFileStatus.m_Inode != c_FileStatus.m_Inode));
+
+    {
+        ResultsCache resultsCache{c_CacheFilePath};
+        QVERIFY(resultsCache.load());
+        QVERIFY(!resultsCache.find(c_FilePath, c_ChangedFileStatus).has_value());
+        QVERIFY(0 == resultsCache.getRetrievedResultsCount());
+
+        // the stale entry is discarded when saving
+        QVERIFY(resultsCache.save());
+    }
+
+    ResultsCache resultsCache{c_CacheFilePath};
+    QVERIFY(resultsCache.load());
+    QVERIFY(!resultsCache.find(c_FilePath, c_FileStatus).has_value());
+}
+
+// the first entry is valid, so the cache should be emptied if any other line is invalid
+void ResultsCacheTests::testInvalidCacheFile()
+{
+    QFETCH(std::string, entries);
+    QFETCH(bool, isValid);
+
+    const TemporaryDirectory c_Directory;
+    const std::string c_CacheFilePath{c_Directory.getFilePath("results.cache")};
+    const FileStatus c_FileStatus{10, 20, 30};
+
+    writeFile(c_CacheFilePath, "CharCounterCache 1\n10 20 30 3 0 2 97 1 98 2 /dir/file.txt\n" + entries);
+
+    ResultsCache resultsCache{c_CacheFilePath};
+    QVERIFY(isValid == resultsCache.load());
+
+    const std::optional<FileResult> c_FileResult{resultsCache.find("/dir/file.txt", c_FileStatus)};
+    QVERIFY(isValid == c_FileResult.has_value());
+
+    if (isValid)
+    {
+        FileResult expectedFileResult{{}, 3, false};
+        expectedFileResult.m_ByteOccurrences['a'] = 1;
+        expectedFileResult.m_ByteOccurrences['b'] = 2;
+
+        QVERIFY(areResultsEqual(*c_FileResult, expectedFileResult));
+    }
+
+    // an invalid file gets replaced by a valid one
+    resultsCache.store("/dir/other.txt", c_FileStatus, getFileResult(2));
+    QVERIFY(resultsCache.save());
+
+    ResultsCache savedResultsCache{c_CacheFilePath};
+    QVERIFY(savedResultsCache.load());
+    QVERIFY(savedResultsCache.find("/dir/other.txt", c_FileStatus).has_value());
+}
+
+void ResultsCacheTests::testMissingCacheFile()
+{
+    const TemporaryDirectory c_Directory;
+    const std::string c_CacheFilePath{c_Directory.getFilePath("results.cache")};
+
+    ResultsCache resultsCache{c_CacheFilePath};
+    QVERIFY(resultsCache.load());
+    QVERIFY(!resultsCache.find("/dir/file.txt", FileStatus{10, 20, 30}).has_value());
+
+    // nothing stored, so no file should be created
+    QVERIFY(resultsCache.save());
+    QVERIFY(!std::filesystem::exists(c_CacheFilePath));
+
+    // an empty file has no header
+    writeFile(c_CacheFilePath, "");
+    QVERIFY(!resultsCache.load());
+}
+
+void ResultsCacheTests::testKeyNormalization()
+{
+    QFETCH(std::string, storedFilePath);
+    QFETCH(std::string, searchedFilePath);
+    QFETCH(bool, isFound);
+
+    const TemporaryDirectory c_Directory;
+    const FileStatus c_FileStatus{10, 20, 30};
+
+    ResultsCache resultsCache{c_Directory.getFilePath("results.cache")};
+    QVERIFY(resultsCache.load());
+
+    resultsCache.store(storedFilePath, c_FileStatus, getFileResult(0));
+    QVERIFY(isFound == resultsCache.find(searchedFilePath, c_FileStatus).has_value());
+
+    // the keys are the same after saving and loading again
+    QVERIFY(resultsCache.save());
+
+    ResultsCache loadedResultsCache{c_Directory.getFilePath("results.cache")};
+    QVERIFY(loadedResultsCache.load());
+    QVERIFY(isFound == loadedResultsCache.find(searchedFilePath, c_FileStatus).has_value());
+    QVERIFY(loadedResultsCache.find(storedFilePath, c_FileStatus).has_value());
+}
+
+void ResultsCacheTests::testIsCacheFile()
+{
+    QFETCH(std::string, cacheFilePath);
+    QFETCH(std::string, filePath);
+    QFETCH(bool, isCacheFile);
+
+    const ResultsCache c_ResultsCache{cacheFilePath};
+    QVERIFY(isCacheFile == c_ResultsCache.isCacheFile(filePath));
+}
+
+// the cache file is located within the parsed directory, so it would be parsed (and change the results) if not excluded
+void ResultsCacheTests::testCacheFileNotParsed()
+{
+    const TemporaryDirectory c_Directory;
+    const std::string c_CacheFilePath{c_Directory.getFilePath("results.cache")};
+    const std::string c_ParsedDirectoryPath{c_Directory.getFilePath("")};
+
+    writeFile(c_Directory.getFilePath("first.txt"), "abc12");
+    writeFile(c_Directory.getFilePath("second.txt"), "DEF");
+
+    // a leftover temporary file (e.g. from an interrupted run) should not be parsed either
+    writeFile(c_CacheFilePath + ".tmp", "xyz");
+
+    for (size_t run{0}; run < 3; ++run)
+    {
+        ParsingEngine parsingEngine{"-b", {c_ParsedDirectoryPath}, "-t", c_CacheFilePath};
+        parsingEngine.run();
+
+        QVERIFY(8 == parsingEngine.getTotalParsedDigitsCount());
+        QVERIFY(8 == parsingEngine.getTotalMatchingDigitsCount());
+        QVERIFY(1 == parsingEngine.getCharOccurrences()['a']);
+        QVERIFY(0 == parsingEngine.getCharOccurrences()['x']);
+        QVERIFY((run > 0 ? 2u : 0u) == parsingEngine.getCachedFilesCount());
+    }
+}
+
+void ResultsCacheTests::testStaleEntries_data()
+{
+    QTest::addColumn<FileChange>("fileChange");
+
+    QTest::newRow("size") << FileChange::SIZE;
+    QTest::newRow("modification time") << FileChange::MODIFICATION_TIME;
+    QTest::newRow("inode") << FileChange::INODE;
+}
+
+void ResultsCacheTests::testInvalidCacheFile_data()
+{
+    QTest::addColumn<std::string>("entries");
+    QTest::addColumn<bool>("isValid");
+
+    std::string allBytesEntry{"1 2 3 32640 0 256"};
+    std::string tooManyBytesEntry{"1 2 3 32640 0 257"};
+
+    for (size_t byte{0}; byte < 256; ++byte)
+    {
+        allBytesEntry += " " + std::to_string(byte) + " " + std::to_string(byte + 1);
+        tooManyBytesEntry += " " + std::to_string(byte) + " " + std::to_string(byte + 1);
+    }
+
+    tooManyBytesEntry += " 0 1";
+
+    QTest::newRow("no other entries") << std::string{} << true;
+    QTest::newRow("entry without occurrences") << std::string{"1 2 3 0 0 0 /dir/empty.txt\n"} << true;
+    QTest::newRow("max chars count exceeded") << std::string{"1 2 3 5 1 1 255 5 /dir/big.txt\n"} << true;
+    QTest::newRow("path containing spaces") << std::string{"1 2 3 5 0 1 32 5 /dir/a b.txt\n"} << true;
+    QTest::newRow("all byte values") << allBytesEntry + " /dir/all.txt\n" << true;
+    QTest::newRow("invalid header") << std::string{"CharCounterCache 2\n"} << false;
+    QTest::newRow("empty line") << std::string{"\n"} << false;
+    QTest::newRow("missing path") << std::string{"1 2 3 5 0 1 97 5 \n"} << false;
+    QTest::newRow("missing path and separator") << std::string{"1 2 3 5 0 1 97 5\n"} << false;
+    QTest::newRow("missing status") << std::string{"1 2 /dir/other.txt\n"} << false;
+    QTest::newRow("non-numeric size") << std::string{"x 2 3 5 0 1 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("negative size") << std::string{"-1 2 3 5 0 1 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("non-numeric occurrences") << std::string{"1 2 3 5 0 1 97 x /dir/other.txt\n"} << false;
+    QTest::newRow("double separator") << std::string{"1 2  3 5 0 1 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("byte value out of range") << std::string{"1 2 3 5 0 1 256 5 /dir/other.txt\n"} << false;
+    QTest::newRow("repeated byte value") << std::string{"1 2 3 10 0 2 97 5 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("zero occurrences") << std::string{"1 2 3 0 0 1 97 0 /dir/other.txt\n"} << false;
+    QTest::newRow("fewer byte values than count") << std::string{"1 2 3 5 0 2 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("byte values count exceeding byte values range") << tooManyBytesEntry + " /dir/other.txt\n" << false;
+    QTest::newRow("huge byte values count") << std::string{"1 2 3 5 0 18446744073709551615 97 5 /dir/other.txt\n"} << false;
+    QTest::newRow("valid entry after invalid one") << std::string{"1 2 3 5 0 1 256 5 /dir/other.txt\n1 2 3 0 0 0 /dir/empty.txt\n"} << false;
+}
+
+// the relative paths are resolved against the current directory (the paths don't need to exist)
+void ResultsCacheTests::testKeyNormalization_data()
+{
+    QTest::addColumn<std::string>("storedFilePath");
+    QTest::addColumn<std::string>("searchedFilePath");
+    QTest::addColumn<bool>("isFound");
+
+    const std::string c_CurrentDirectory{std::filesystem::current_path().lexically_normal().string()};
+    const std::string c_ParentDirectory{std::filesystem::current_path().parent_path().lexically_normal().string()};
+
+    QTest::newRow("same relative path") << std::string{"file.txt"} << std::string{"file.txt"} << true;
+    QTest::newRow("relative and absolute path") << std::string{"file.txt"} << c_CurrentDirectory + "/file.txt" << true;
+    QTest::newRow("absolute and relative path") << c_CurrentDirectory + "/dir/file.txt" << std::string{"dir/file.txt"} << true;
+    QTest::newRow("current directory segment") << std::string{"./file.txt"} << std::string{"file.txt"} << true;
+    QTest::newRow("inner current directory segment") << std::string{"dir/./file.txt"} << c_CurrentDirectory + "/dir/file.txt" << true;
+    QTest::newRow("parent directory segment") << std::string{"dir/../file.txt"} << std::string{"file.txt"} << true;
+    QTest::newRow("leading parent directory segment") << std::string{"../file.txt"} << c_ParentDirectory + "/file.txt" << true;
+    QTest::newRow("absolute path with parent directory segment") << c_CurrentDirectory + "/dir/../file.txt" << std::string{"./file.txt"} << true;
+    QTest::newRow("redundant separators") << std::string{"dir//file.txt"} << std::string{"dir/file.txt"} << true;
+    QTest::newRow("different files") << std::string{"file.txt"} << std::string{"other.txt"} << false;
+    QTest::newRow("different directories") << std::string{"dir/file.txt"} << std::string{"file.txt"} << false;
+    QTest::newRow("parent and current directory") << std::string{"../file.txt"} << std::string{"file.txt"} << false;
+}
+
+void ResultsCacheTests::testIsCacheFile_data()
+{
+    QTest::addColumn<std::string>("cacheFilePath");
+    QTest::addColumn<std::string>("filePath");
+    QTest::addColumn<bool>("isCacheFile");
+
+    const std::string c_CurrentDirectory{std::filesystem::current_path().lexically_normal().string()};
+
+    QTest::newRow("same path") << std::string{"results.cache"} << std::string{"results.cache"} << true;
+    QTest::newRow("temporary file") << std::string{"results.cache"} << std::string{"results.cache.tmp"} << true;
+    QTest::newRow("relative and absolute path") << std::string{"dir/results.cache"} << c_CurrentDirectory + "/dir/results.cache" << true;
+    QTest::newRow("absolute and relative path") << c_CurrentDirectory + "/results.cache" << std::string{"./results.cache"} << true;
+    QTest::newRow("temporary file with parent directory segment") << std::string{"results.cache"} << std::string{"dir/../results.cache.tmp"} << true;
+    QTest::newRow("other file") << std::string{"results.cache"} << std::string{"results.cache2"} << false;
+    QTest::newRow("other directory") << std::string{"dir/results.cache"} << std::string{"results.cache"} << false;
+    QTest::newRow("cache file of the temporary file") << std::string{"results.cache.tmp"} << std::string{"results.cache"} << false;
+}
+
+QTEST_APPLESS_MAIN(ResultsCacheTests)
+
+#include "tst_resultscachetests.moc"
+// clang-format on
@@ -1,21 +1,79 @@
+#include <iomanip>
 #include <iostream>
 #include <map>
+#include <sstream>
 
+#include "instrumentation.h"
 #include "parsingengine.h"
 
 static constexpr size_t c_MinRequiredDataParamsCount{3};
+static const std::string c_ResultsCacheOption{"-c"}; // optional, followed by the cache file path
 
 static const std::map<std::string, std::string> c_ParsingOptionsLabels{{"-d", "digits"},
                                                                        {"-l", "lower case"},
                                                                        {"-u", "upper case"},
                                                                        {"-lu", "lower and upper case"},
-                                                                       {"-ad", "alphanumeric and digits"}};
+                                                                       {"-ad", "alphanumeric and digits"},
+                                                                       {"-b", "all bytes"},
+                                                                       {"-U", "UTF-8 code points"}};
 
 static const std::map<std::string, std::string> c_AggregatingOptionsLabels{{"-t", "total occurrences"},
                                                                            {"-m", "minimum occurrences"},
                                                                            {"-a", "average occurrences"},
                                                                            {"-M", "maximum occurrences"}};
 
+// visible chars are displayed as they are, the other ones by their hexadecimal value
+static std::string getByteLabel(unsigned char byte)
+{
+    std::ostringstream label;
+
+    if (byte > 0x20 && byte < 0x7F)
+    {
+        label << byte;
+    }
+    else
+    {
+        label << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    }
+
+    return label.str();
+}
+
+// code point notation (U+XXXX) preceded by the UTF-8 encoded char if visible
+static std::string getCodePointLabel(char32_t codePoint)
+{
+    std::ostringstream label;
+
+    if (codePoint > 0x20 && codePoint != 0x7F && (codePoint < 0x80 || codePoint > 0x9F))
+    {
+        if (codePoint < 0x80)
+        {
+            label << static_cast<char>(codePoint);
+        }
+        else
+        {
+            // lead byte (prefix 110, 1110 or 11110) followed by continuation bytes (prefix 10) with 6 bits each
+            static constexpr unsigned char c_LeadBytePrefixes[]{0xC0, 0xE0, 0xF0};
+            const size_t c_ContinuationBytesCount{codePoint < 0x800 ? 1u : (codePoint < 0x10000 ? 2u : 3u)};
+
+            label << static_cast<char>(c_LeadBytePrefixes[c_ContinuationBytesCount - 1] |
+                                       (codePoint >> (6 * c_ContinuationBytesCount)));
+
+            for (size_t byteIndex{c_ContinuationBytesCount}; byteIndex > 0; --byteIndex)
+            {
+                label << static_cast<char>(0x80 | ((codePoint >> (6 * (byteIndex - 1))) & 0x3F));
+            }
+        }
+
+        label << " ";
+    }
+
+    label << "(U+" << std::hex << std::uppercase << std::setw(4) << std::setfill('0')
+          << static_cast<uint32_t>(codePoint) << ")";
+
+    return label.str();
+}
+
 bool checkArguments(int argc, char* argv[])
 {
     bool result{false};
@@ -38,6 +96,10 @@ bool checkArguments(int argc, char* argv[])
     {
         std::cerr << "Invalid aggregation option!\n";
     }
+    else if (c_ResultsCacheOption == argv[3] && c_DataParamsCount < c_MinRequiredDataParamsCount + 2)
+    {
+        std::cerr << "The results cache option should be followed by the cache file path and at least one file path!\n";
+    }
     else
     {
         result = true;
@@ -54,10 +116,12 @@ int main(int argc, char* argv[])
 
     if (c_AreArgumentsOk)
     {
-        const size_t c_NonFilePathArgumentsCount{3};
-        const size_t c_FilePathsCount{
-            static_cast<size_t>(argc) -
-            c_NonFilePathArgumentsCount}; // take out the application executable path, parsing and aggregation options
+        const bool c_IsResultsCacheUsed{c_ResultsCacheOption == argv[3]};
+        const std::string c_ResultsCacheFilePath{c_IsResultsCacheUsed ? argv[4] : ""};
+
+        // take out the application executable path, parsing and aggregation options (and results cache option/path)
+        const size_t c_NonFilePathArgumentsCount{c_IsResultsCacheUsed ? 5u : 3u};
+        const size_t c_FilePathsCount{static_cast<size_t>(argc) - c_NonFilePathArgumentsCount};
 
         FilePathsArray filePaths;
         for (size_t fileIndex{0}; fileIndex < c_FilePathsCount; ++fileIndex)
@@ -68,9 +132,11 @@ int main(int argc, char* argv[])
         const std::string c_ParsingOption{argv[1]};
         const std::string c_AggregatingOption{argv[2]};
 
-        ParsingEngine parsingEngine{c_ParsingOption, filePaths, c_AggregatingOption};
+        ParsingEngine parsingEngine{c_ParsingOption, filePaths, c_AggregatingOption, c_ResultsCacheFilePath};
         parsingEngine.run();
 
+        INSTRUMENT_DUMP("charcounter");
+
         const size_t c_TotalParsedDigitsCount{parsingEngine.getTotalParsedDigitsCount()};
         const size_t c_TotalMatchingDigitsCount{parsingEngine.getTotalMatchingDigitsCount()};
 
@@ -79,6 +145,11 @@ int main(int argc, char* argv[])
             std::cout << "Parsed characters: " << c_TotalParsedDigitsCount << "\n";
             std::cout << "Matching characters (" << c_ParsingOptionsLabels.at(c_ParsingOption)
                       << "): " << c_TotalMatchingDigitsCount << "\n";
+
+            if (c_IsResultsCacheUsed)
+            {
+                std::cout << "Files retrieved from cache: " << parsingEngine.getCachedFilesCount() << "\n";
+            }
         }
         else
         {
@@ -91,13 +162,23 @@ int main(int argc, char* argv[])
             std::cout << "\nFound chars distribution (" << c_AggregatingOptionsLabels.at(c_AggregatingOption) << "):\n";
         }
 
-        const CharOccurrencesArray& consolidatedCharOccurrences{parsingEngine.getCharOccurrences()};
-
-        for (unsigned char ch{0}; ch < consolidatedCharOccurrences.size(); ++ch)
+        if ("-U" == c_ParsingOption)
         {
-            if (consolidatedCharOccurrences[ch] > 0)
+            parsingEngine.getCodePointOccurrences().forEachOccurrence([](char32_t codePoint, size_t occurrences) {
+                std::cout << getCodePointLabel(codePoint) << " : " << occurrences << "\n";
+            });
+        }
+        else
+        {
+            const CharOccurrencesArray& consolidatedCharOccurrences{parsingEngine.getCharOccurrences()};
+
+            for (size_t byte{0}; byte < consolidatedCharOccurrences.size(); ++byte)
             {
-                std::cout << ch << " : " << consolidatedCharOccurrences[ch] << "\n";
+                if (consolidatedCharOccurrences[byte] > 0)
+                {
+                    std::cout << getByteLabel(static_cast<unsigned char>(byte)) << " : "
+                              << consolidatedCharOccurrences[byte] << "\n";
+                }
             }
         }
     }
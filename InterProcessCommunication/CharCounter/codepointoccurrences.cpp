@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "codepointoccurrences.h"
+
+void CodePointOccurrences::set(char32_t codePoint, size_t occurrences)
+{
+    if (codePoint < c_DenseCodePointsCount)
+    {
+        std::vector<size_t>& page{m_DensePages[codePoint / c_PageSize]};
+
+        if (page.empty() && occurrences > 0)
+        {
+            page.resize(c_PageSize, 0);
+        }
+
+        if (!page.empty())
+        {
+            page[codePoint % c_PageSize] = occurrences;
+        }
+    }
+    else if (occurrences > 0)
+    {
+        m_SparseOccurrences[codePoint] = occurrences;
+    }
+    else
+    {
+        m_SparseOccurrences.erase(codePoint);
+    }
+}
+
+size_t CodePointOccurrences::get(char32_t codePoint) const
+{
+    size_t occurrences{0};
+
+    if (codePoint < c_DenseCodePointsCount)
+    {
+        const std::vector<size_t>& c_Page{m_DensePages[codePoint / c_PageSize]};
+
+        if (!c_Page.empty())
+        {
+            occurrences = c_Page[codePoint % c_PageSize];
+        }
+    }
+    else if (auto it{m_SparseOccurrences.find(codePoint)}; it != m_SparseOccurrences.cend())
+    {
+        occurrences = it->second;
+    }
+
+    return occurrences;
+}
+
+void CodePointOccurrences::forEachOccurrence(const std::function<void(char32_t, size_t)>& visitor) const
+{
+    for (size_t pageIndex{0}; pageIndex < m_DensePages.size(); ++pageIndex)
+    {
+        const std::vector<size_t>& c_Page{m_DensePages[pageIndex]};
+
+        for (size_t index{0}; index < c_Page.size(); ++index)
+        {
+            if (c_Page[index] > 0)
+            {
+                visitor(static_cast<char32_t>(pageIndex * c_PageSize + index), c_Page[index]);
+            }
+        }
+    }
+
+    // hash map not ordered, sorting required
+    std::vector<std::pair<char32_t, size_t>> sparseOccurrences{m_SparseOccurrences.cbegin(),
+                                                                m_SparseOccurrences.cend()};
+    std::sort(sparseOccurrences.begin(), sparseOccurrences.end());
+
+    for (const auto& [codePoint, occurrences] : sparseOccurrences)
+    {
+        if (occurrences > 0)
+        {
+            visitor(codePoint, occurrences);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/* Occurrences of Unicode code points, stored in a two-level histogram:
+   - the Basic Multilingual Plane (U+0000 - U+FFFF) is split into pages of 256 code points, each page being allocated
+   on first access (typically only a few pages are used by a file, e.g. ASCII and one or two alphabets)
+   - the code points from the other planes (rare in practice) are stored in a hash map
+*/
+class CodePointOccurrences
+{
+public:
+    void add(char32_t codePoint, size_t occurrences = 1);
+    void set(char32_t codePoint, size_t occurrences);
+    size_t get(char32_t codePoint) const;
+
+    // only the code points with non-zero occurrences are visited (ascending order)
+    void forEachOccurrence(const std::function<void(char32_t, size_t)>& visitor) const;
+
+private:
+    static constexpr size_t c_PageSize{256};
+    static constexpr char32_t c_DenseCodePointsCount{0x10000};
+
+    std::array<std::vector<size_t>, c_DenseCodePointsCount / c_PageSize> m_DensePages;
+    std::unordered_map<char32_t, size_t> m_SparseOccurrences;
+};
+
+// inline as it gets called for each parsed char
+inline void CodePointOccurrences::add(char32_t codePoint, size_t occurrences)
+{
+    if (codePoint < c_DenseCodePointsCount)
+    {
+        std::vector<size_t>& page{m_DensePages[codePoint / c_PageSize]};
+
+        if (page.empty())
+        {
+            page.resize(c_PageSize, 0);
+        }
+
+        page[codePoint % c_PageSize] += occurrences;
+    }
+    else
+    {
+        m_SparseOccurrences[codePoint] += occurrences;
+    }
+}
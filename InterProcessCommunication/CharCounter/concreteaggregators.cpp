@@ -3,25 +3,48 @@
 #include "concreteaggregators.h"
 
 Aggregator::Aggregator()
+    : m_TotalCharOccurrences{}
 {
 }
 
 void Aggregator::aggregate(const CharOccurrencesArray& charOccurrences)
 {
     std::lock_guard<std::mutex> lock{m_AggregationMutex};
+    _addCharOccurrences(charOccurrences);
+}
+
+const CharOccurrencesArray& Aggregator::getCharOccurrences() const
+{
+    return m_TotalCharOccurrences;
+}
+
+void Aggregator::aggregate(const CodePointOccurrences& codePointOccurrences)
+{
+    std::lock_guard<std::mutex> lock{m_AggregationMutex};
+    _addCodePointOccurrences(codePointOccurrences);
+}
+
+const CodePointOccurrences& Aggregator::getCodePointOccurrences() const
+{
+    return m_TotalCodePointOccurrences;
+}
 
+void Aggregator::_addCharOccurrences(const CharOccurrencesArray& charOccurrences)
+{
     for (size_t index{0}; index < charOccurrences.size(); ++index)
     {
         m_TotalCharOccurrences[index] += charOccurrences[index];
     }
 }
 
-const CharOccurrencesArray& Aggregator::getCharOccurrences() const
+void Aggregator::_addCodePointOccurrences(const CodePointOccurrences& codePointOccurrences)
 {
-    return m_TotalCharOccurrences;
+    codePointOccurrences.forEachOccurrence(
+        [this](char32_t codePoint, size_t occurrences) { m_TotalCodePointOccurrences.add(codePoint, occurrences); });
 }
 
 MaxAggregator::MaxAggregator()
+    : m_MaxCharOccurrences{}
 {
 }
 
@@ -40,7 +63,22 @@ const CharOccurrencesArray& MaxAggregator::getCharOccurrences() const
     return m_MaxCharOccurrences;
 }
 
+void MaxAggregator::aggregate(const CodePointOccurrences& codePointOccurrences)
+{
+    std::lock_guard<std::mutex> lock{m_AggregationMutex};
+
+    codePointOccurrences.forEachOccurrence([this](char32_t codePoint, size_t occurrences) {
+        m_MaxCodePointOccurrences.set(codePoint, std::max(m_MaxCodePointOccurrences.get(codePoint), occurrences));
+    });
+}
+
+const CodePointOccurrences& MaxAggregator::getCodePointOccurrences() const
+{
+    return m_MaxCodePointOccurrences;
+}
+
 MinAggregator::MinAggregator()
+    : m_MinCharOccurrences{}
 {
 }
 
@@ -62,14 +100,36 @@ const CharOccurrencesArray& MinAggregator::getCharOccurrences() const
     return m_MinCharOccurrences;
 }
 
+void MinAggregator::aggregate(const CodePointOccurrences& codePointOccurrences)
+{
+    std::lock_guard<std::mutex> lock{m_AggregationMutex};
+
+    // only the code points contained in the file are visited (same rule as for chars: 0 occurrences excluded)
+    codePointOccurrences.forEachOccurrence([this](char32_t codePoint, size_t occurrences) {
+        const size_t c_MinOccurrences{m_MinCodePointOccurrences.get(codePoint)};
+        m_MinCodePointOccurrences.set(codePoint,
+                                      0 == c_MinOccurrences ? occurrences : std::min(c_MinOccurrences, occurrences));
+    });
+}
+
+const CodePointOccurrences& MinAggregator::getCodePointOccurrences() const
+{
+    return m_MinCodePointOccurrences;
+}
+
 AverageAggregator::AverageAggregator()
-    : m_AggregationsCount{0}
+    : m_AverageCharOccurrences{}
+    , m_AggregationsCount{0}
 {
 }
 
+// the total occurrences and the aggregations count are updated under the same lock as the averages (parsers running
+// concurrently)
 void AverageAggregator::aggregate(const CharOccurrencesArray& charOccurrences)
 {
-    Aggregator::aggregate(charOccurrences);
+    std::lock_guard<std::mutex> lock{m_AggregationMutex};
+
+    _addCharOccurrences(charOccurrences);
     ++m_AggregationsCount;
 
     const CharOccurrencesArray& c_TotalCharOccurrences{Aggregator::getCharOccurrences()};
@@ -89,3 +149,22 @@ const CharOccurrencesArray& AverageAggregator::getCharOccurrences() const
 {
     return m_AverageCharOccurrences;
 }
+
+void AverageAggregator::aggregate(const CodePointOccurrences& codePointOccurrences)
+{
+    std::lock_guard<std::mutex> lock{m_AggregationMutex};
+
+    _addCodePointOccurrences(codePointOccurrences);
+    ++m_AggregationsCount;
+
+    // up-rounding (ceiling) as for chars
+    Aggregator::getCodePointOccurrences().forEachOccurrence([this](char32_t codePoint, size_t totalOccurrences) {
+        const size_t c_AverageOccurrences{(totalOccurrences + m_AggregationsCount - 1) / m_AggregationsCount};
+        m_AverageCodePointOccurrences.set(codePoint, c_AverageOccurrences);
+    });
+}
+
+const CodePointOccurrences& AverageAggregator::getCodePointOccurrences() const
+{
+    return m_AverageCodePointOccurrences;
+}
@@ -9,9 +9,17 @@ public:
     Aggregator();
     void aggregate(const CharOccurrencesArray& charOccurrences) override;
     const CharOccurrencesArray& getCharOccurrences() const override;
+    void aggregate(const CodePointOccurrences& codePointOccurrences) override;
+    const CodePointOccurrences& getCodePointOccurrences() const override;
+
+protected:
+    // to be called with the aggregation mutex locked
+    void _addCharOccurrences(const CharOccurrencesArray& charOccurrences);
+    void _addCodePointOccurrences(const CodePointOccurrences& codePointOccurrences);
 
 private:
     CharOccurrencesArray m_TotalCharOccurrences;
+    CodePointOccurrences m_TotalCodePointOccurrences;
 };
 
 class MaxAggregator : public IAggregator
@@ -20,9 +28,12 @@ public:
     MaxAggregator();
     void aggregate(const CharOccurrencesArray& charOccurrences) override;
     const CharOccurrencesArray& getCharOccurrences() const override;
+    void aggregate(const CodePointOccurrences& codePointOccurrences) override;
+    const CodePointOccurrences& getCodePointOccurrences() const override;
 
 private:
     CharOccurrencesArray m_MaxCharOccurrences;
+    CodePointOccurrences m_MaxCodePointOccurrences;
 };
 
 class MinAggregator : public IAggregator
@@ -31,9 +42,12 @@ public:
     MinAggregator();
     void aggregate(const CharOccurrencesArray& charOccurrences) override;
     const CharOccurrencesArray& getCharOccurrences() const override;
+    void aggregate(const CodePointOccurrences& codePointOccurrences) override;
+    const CodePointOccurrences& getCodePointOccurrences() const override;
 
 private:
     CharOccurrencesArray m_MinCharOccurrences;
+    CodePointOccurrences m_MinCodePointOccurrences;
 };
 
 class AverageAggregator : public Aggregator
@@ -42,8 +56,11 @@ public:
     AverageAggregator();
     void aggregate(const CharOccurrencesArray& charOccurrences) override;
     const CharOccurrencesArray& getCharOccurrences() const override;
+    void aggregate(const CodePointOccurrences& codePointOccurrences) override;
+    const CodePointOccurrences& getCodePointOccurrences() const override;
 
 private:
     CharOccurrencesArray m_AverageCharOccurrences;
+    CodePointOccurrences m_AverageCodePointOccurrences;
     size_t m_AggregationsCount;
 };
@@ -1,4 +1,118 @@
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SSE2_UTF8_DECODING
+#endif
+
+#include "codepointoccurrences.h"
 #include "concreteparsers.h"
+#include "iaggregator.h"
+
+static constexpr char32_t c_ReplacementCodePoint{0xFFFD};
+
+/* Returns the number of ASCII chars (highest bit not set) at the beginning of the buffer, without checking them one by
+   one:
+   - with SSE2 the highest bits of 16 chars are gathered into a mask at once
+   - otherwise 8 chars are loaded into an integer and their highest bits are checked by using a bit mask
+*/
+size_t CodePointsParser::getAsciiPrefixSize(const char* chars, size_t charsCount)
+{
+    size_t charIndex{0};
+    bool isNonAsciiCharFound{false};
+
+#ifdef SSE2_UTF8_DECODING
+    for (; !isNonAsciiCharFound && charIndex + 16 <= charsCount; charIndex += 16)
+    {
+        const __m128i c_Chars{_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + charIndex))};
+
+        if (const int c_NonAsciiMask{_mm_movemask_epi8(c_Chars)}; c_NonAsciiMask != 0)
+        {
+            // the loop increment is subtracted as it gets added when exiting the loop
+            isNonAsciiCharFound = true;
+            charIndex += static_cast<size_t>(std::countr_zero(static_cast<unsigned>(c_NonAsciiMask))) - 16;
+        }
+    }
+#endif
+
+    for (; !isNonAsciiCharFound && charIndex + 8 <= charsCount; charIndex += 8)
+    {
+        uint64_t eightChars;
+        std::memcpy(&eightChars, chars + charIndex, sizeof(eightChars));
+
+        if (const uint64_t c_NonAsciiBits{eightChars & 0x8080808080808080u}; c_NonAsciiBits != 0)
+        {
+            // the first char in memory is the lowest byte on little endian systems and the highest one on big endian
+            const int c_FirstNonAsciiBit{std::endian::native == std::endian::little ? std::countr_zero(c_NonAsciiBits)
+                                                                                    : std::countl_zero(c_NonAsciiBits)};
+            isNonAsciiCharFound = true;
+            charIndex += static_cast<size_t>(c_FirstNonAsciiBit) / 8 - 8; // loop increment subtracted (see above)
+        }
+    }
+
+    while (!isNonAsciiCharFound && charIndex < charsCount && static_cast<unsigned char>(chars[charIndex]) < 0x80)
+    {
+        ++charIndex;
+    }
+
+    return charIndex;
+}
+
+/* Decodes the multi-byte sequence starting at the given (non-ASCII) char, returns the size of the sequence (0 if
+   invalid):
+   - the lead byte determines the sequence size, each following byte should be a continuation byte (10xxxxxx)
+   - overlong encodings, surrogates (U+D800 - U+DFFF) and code points beyond U+10FFFF are rejected
+*/
+size_t CodePointsParser::decodeMultiByteSequence(const unsigned char* chars, size_t charsCount, char32_t& codePoint)
+{
+    size_t sequenceSize{0};
+    char32_t minCodePoint{0};
+
+    if (chars[0] >= 0xC2 && chars[0] <= 0xDF)
+    {
+        sequenceSize = 2;
+        minCodePoint = 0x80;
+        codePoint = chars[0] & 0x1Fu;
+    }
+    else if (chars[0] >= 0xE0 && chars[0] <= 0xEF)
+    {
+        sequenceSize = 3;
+        minCodePoint = 0x800;
+        codePoint = chars[0] & 0x0Fu;
+    }
+    else if (chars[0] >= 0xF0 && chars[0] <= 0xF4)
+    {
+        sequenceSize = 4;
+        minCodePoint = 0x10000;
+        codePoint = chars[0] & 0x07u;
+    }
+
+    if (sequenceSize > charsCount)
+    {
+        sequenceSize = 0;
+    }
+
+    for (size_t charIndex{1}; charIndex < sequenceSize; ++charIndex)
+    {
+        if ((chars[charIndex] & 0xC0u) != 0x80u)
+        {
+            sequenceSize = 0;
+            break;
+        }
+
+        codePoint = (codePoint << 6) | (chars[charIndex] & 0x3Fu);
+    }
+
+    const bool c_IsSurrogate{codePoint >= 0xD800 && codePoint <= 0xDFFF};
+
+    if (sequenceSize > 0 && (codePoint < minCodePoint || codePoint > 0x10FFFF || c_IsSurrogate))
+    {
+        sequenceSize = 0;
+    }
+
+    return sequenceSize;
+}
 
 DigitsParser::DigitsParser(const std::string& filePath, IAggregator* pIAggregator)
     : Parser{filePath, pIAggregator}
@@ -55,3 +169,64 @@ bool AlphaAndDigitsParser::isValidChar(char c)
 {
     return LowerUpperCaseParser::isValidChar(c) || DigitsParser::isValidChar(c);
 }
+
+BytesParser::BytesParser(const std::string& filePath, IAggregator* pIAggregator)
+    : Parser{filePath, pIAggregator}
+{
+}
+
+bool BytesParser::isValidChar(char)
+{
+    return true;
+}
+
+CodePointsParser::CodePointsParser(const std::string& filePath, IAggregator* pIAggregator)
+    : Parser{filePath, pIAggregator}
+{
+}
+
+// not used, the code points are counted instead of bytes
+bool CodePointsParser::isValidChar(char)
+{
+    return true;
+}
+
+size_t CodePointsParser::countChars(std::string_view chars, IAggregator* pIAggregator)
+{
+    CodePointOccurrences codePointOccurrences;
+    size_t codePointsCount{0};
+    size_t charIndex{0};
+
+    while (charIndex < chars.size())
+    {
+        // ASCII runs are counted without decoding (as in the bytes parser)
+        const size_t c_AsciiCharsCount{getAsciiPrefixSize(chars.data() + charIndex, chars.size() - charIndex)};
+
+        for (size_t asciiCharIndex{charIndex}; asciiCharIndex < charIndex + c_AsciiCharsCount; ++asciiCharIndex)
+        {
+            codePointOccurrences.add(static_cast<char32_t>(chars[asciiCharIndex]));
+        }
+
+        codePointsCount += c_AsciiCharsCount;
+        charIndex += c_AsciiCharsCount;
+
+        if (charIndex < chars.size())
+        {
+            char32_t codePoint{0};
+            const size_t c_SequenceSize{
+                decodeMultiByteSequence(reinterpret_cast<const unsigned char*>(chars.data() + charIndex),
+                                        chars.size() - charIndex, codePoint)};
+
+            codePointOccurrences.add(c_SequenceSize > 0 ? codePoint : c_ReplacementCodePoint);
+            ++codePointsCount;
+            charIndex += c_SequenceSize > 0 ? c_SequenceSize : 1;
+        }
+    }
+
+    if (pIAggregator)
+    {
+        pIAggregator->aggregate(codePointOccurrences);
+    }
+
+    return codePointsCount;
+}
@@ -46,3 +46,34 @@ public:
 protected:
     bool isValidChar(char c) override;
 };
+
+// all byte values (including the non-ASCII ones, e.g. the bytes of UTF-8 multi-byte sequences)
+class BytesParser final : public Parser
+{
+public:
+    BytesParser(const std::string& filePath, IAggregator* pIAggregator);
+
+protected:
+    bool isValidChar(char c) override;
+};
+
+/* Unicode code points of UTF-8 encoded files:
+   - each invalid byte sequence is counted as a replacement character (U+FFFD), the decoding resuming with the next byte
+   - a sequence truncated by the maximum allowed chars count is considered invalid
+*/
+class CodePointsParser final : public Parser
+{
+public:
+    CodePointsParser(const std::string& filePath, IAggregator* pIAggregator);
+
+    // number of ASCII chars at the beginning of the buffer
+    static size_t getAsciiPrefixSize(const char* chars, size_t charsCount);
+
+    // size of the multi-byte sequence starting at the given (non-ASCII) char (0 if invalid), its code point is written
+    // into the last argument
+    static size_t decodeMultiByteSequence(const unsigned char* chars, size_t charsCount, char32_t& codePoint);
+
+protected:
+    bool isValidChar(char c) override;
+    size_t countChars(std::string_view chars, IAggregator* pIAggregator) override;
+};
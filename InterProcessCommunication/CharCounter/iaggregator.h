@@ -2,6 +2,7 @@
 
 #include <mutex>
 
+#include "codepointoccurrences.h"
 #include "utilities.h"
 
 class IAggregator
@@ -9,6 +10,11 @@ class IAggregator
 public:
     virtual void aggregate(const CharOccurrencesArray& charOccurrences) = 0;
     virtual const CharOccurrencesArray& getCharOccurrences() const = 0;
+
+    // Unicode code points (only used when parsing files as UTF-8)
+    virtual void aggregate(const CodePointOccurrences& codePointOccurrences) = 0;
+    virtual const CodePointOccurrences& getCodePointOccurrences() const = 0;
+
     virtual ~IAggregator(){};
 
 protected:
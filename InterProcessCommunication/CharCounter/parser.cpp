@@ -1,63 +1,69 @@
-#include <algorithm>
-
 #include "iaggregator.h"
+#include "instrumentation.h"
 #include "parser.h"
+#include "resultscache.h"
 
 static constexpr size_t c_CharCountThreshold{16 * 1024};
 
 Parser::Parser(const std::string& filePath, IAggregator* pIAggregator)
-    : m_pFile{nullptr}
-    , m_FilePath{filePath}
+    : m_FilePath{filePath}
     , m_pIAggregator{pIAggregator}
+    , m_pResultsCache{nullptr}
     , m_TotalFoundCharsCount{0}
     , m_TotalParsedCharsCount{0}
     , m_MaxCharsCountExceeded{false}
 {
-    std::fill(m_CharOccurrences.begin(), m_CharOccurrences.end(), 0);
-
-    if (!m_FilePath.empty())
-    {
-        m_pFile = fopen(m_FilePath.c_str(), "r");
-    }
 }
 
 Parser::~Parser()
 {
-    if (m_pFile)
-    {
-        fclose(m_pFile);
-        m_pFile = nullptr;
-    }
 }
 
 void Parser::parse()
 {
-    if (m_pFile)
+    INSTRUMENT_SCOPE("Parser::parseFile");
+
+    // the file status is retrieved before reading the file, so a file modified meanwhile is parsed again next time
+    const std::optional<ResultsCache::FileStatus> c_FileStatus{
+        m_pResultsCache ? ResultsCache::getFileStatus(m_FilePath) : std::nullopt};
+    const std::optional<ResultsCache::FileResult> c_CachedFileResult{
+        c_FileStatus ? m_pResultsCache->find(m_FilePath, *c_FileStatus) : std::nullopt};
+
+    if (c_CachedFileResult)
     {
-        while (!feof(m_pFile))
-        {
-            if (c_CharCountThreshold == m_TotalParsedCharsCount)
-            {
-                m_MaxCharsCountExceeded = true;
-                break;
-            }
+        m_MaxCharsCountExceeded = c_CachedFileResult->m_MaxCharsCountExceeded;
+        m_TotalParsedCharsCount = c_CachedFileResult->m_ParsedCharsCount;
+        m_TotalFoundCharsCount = _countValidChars(c_CachedFileResult->m_ByteOccurrences, m_pIAggregator);
+    }
+    else if (FILE* const pFile{m_FilePath.empty() ? nullptr : fopen(m_FilePath.c_str(), "r")}; pFile)
+    {
+        // the file is read at once (up to the maximum allowed chars count), so the chars can be counted in bulk
+        std::string chars(c_CharCountThreshold, '\0');
+        chars.resize(fread(chars.data(), 1, chars.size(), pFile));
 
-            const char c{static_cast<char>(fgetc(m_pFile))};
+        m_MaxCharsCountExceeded = c_CharCountThreshold == chars.size() && fgetc(pFile) != EOF;
+        fclose(pFile);
 
-            if (c >= 0 && isValidChar(c))
-            {
+        m_TotalParsedCharsCount = chars.size();
+
+        if (c_FileStatus)
+        {
+            ResultsCache::FileResult fileResult{{}, m_TotalParsedCharsCount, m_MaxCharsCountExceeded};
 
-                m_TotalFoundCharsCount = m_TotalFoundCharsCount + 1;
-                ++m_CharOccurrences[c];
+            for (const char c_Char : chars)
+            {
+                ++fileResult.m_ByteOccurrences[static_cast<unsigned char>(c_Char)];
             }
 
-            ++m_TotalParsedCharsCount;
+            m_pResultsCache->store(m_FilePath, *c_FileStatus, fileResult);
+            m_TotalFoundCharsCount = _countValidChars(fileResult.m_ByteOccurrences, m_pIAggregator);
         }
-
-        if (m_pIAggregator)
+        else
         {
-            m_pIAggregator->aggregate(m_CharOccurrences);
+            m_TotalFoundCharsCount = countChars(chars, m_pIAggregator);
         }
+
+        INSTRUMENT_COUNT("Parser::parsedChars", m_TotalParsedCharsCount);
     }
 }
 
@@ -80,3 +86,42 @@ const std::string& Parser::getFilePath() const
 {
     return m_FilePath;
 }
+
+void Parser::setResultsCache(ResultsCache* pResultsCache)
+{
+    m_pResultsCache = pResultsCache;
+}
+
+size_t Parser::countChars(std::string_view chars, IAggregator* pIAggregator)
+{
+    CharOccurrencesArray byteOccurrences{};
+
+    for (const char c_Char : chars)
+    {
+        ++byteOccurrences[static_cast<unsigned char>(c_Char)];
+    }
+
+    return _countValidChars(byteOccurrences, pIAggregator);
+}
+
+size_t Parser::_countValidChars(const CharOccurrencesArray& byteOccurrences, IAggregator* pIAggregator)
+{
+    CharOccurrencesArray charOccurrences{};
+    size_t foundCharsCount{0};
+
+    for (size_t byte{0}; byte < byteOccurrences.size(); ++byte)
+    {
+        if (byteOccurrences[byte] > 0 && isValidChar(static_cast<char>(byte)))
+        {
+            foundCharsCount += byteOccurrences[byte];
+            charOccurrences[byte] = byteOccurrences[byte];
+        }
+    }
+
+    if (pIAggregator)
+    {
+        pIAggregator->aggregate(charOccurrences);
+    }
+
+    return foundCharsCount;
+}
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstdio>
+#include <string_view>
 
 #include "utilities.h"
 
 class IAggregator;
+class ResultsCache;
 
 class Parser
 {
@@ -12,20 +14,34 @@ public:
     Parser(const std::string& filePath, IAggregator* pIAggregator);
     virtual ~Parser();
 
+    // the file is only opened while being parsed, so the number of open files is limited by the number of parsing
+    // threads (not by the number of parsers)
     void parse();
     size_t getTotalFoundCharsCount();
     size_t getTotalParsedCharsCount();
     bool maxCharsExceeeded() const;
     const std::string& getFilePath() const;
 
+    // the cache should only be set for parsers counting bytes (see countChars()), as it contains byte occurrences
+    void setResultsCache(ResultsCache* pResultsCache);
+
 protected:
     virtual bool isValidChar(char c) = 0;
 
+    /* Counts the chars and provides their occurrences to the aggregator (if any), returns the found chars count:
+       - the chars are counted as bytes by default (the occurrences of all bytes are counted first, then the ones for
+       which isValidChar() is true are selected)
+       - the occurrences are not kept by the parser, as a large number of parsers might exist at once (one per file)
+    */
+    virtual size_t countChars(std::string_view chars, IAggregator* pIAggregator);
+
 private:
-    FILE* m_pFile;
+    // the occurrences of the matching bytes are selected from the occurrences of all bytes
+    size_t _countValidChars(const CharOccurrencesArray& byteOccurrences, IAggregator* pIAggregator);
+
     std::string m_FilePath;
     IAggregator* m_pIAggregator;
-    CharOccurrencesArray m_CharOccurrences; // only the non-negative chars are taken into consideration
+    ResultsCache* m_pResultsCache;
     size_t m_TotalFoundCharsCount;
     size_t m_TotalParsedCharsCount;
     bool m_MaxCharsCountExceeded;
@@ -22,6 +22,12 @@ Parser* ParserFactory::createParser(ParserType parserType, const std::string& fi
     case ParserType::ALPHA_AND_DIGITS:
         pParser = new AlphaAndDigitsParser{filePath, pIAggregator};
         break;
+    case ParserType::BYTES:
+        pParser = new BytesParser{filePath, pIAggregator};
+        break;
+    case ParserType::CODE_POINTS:
+        pParser = new CodePointsParser{filePath, pIAggregator};
+        break;
     default:
         break;
     }
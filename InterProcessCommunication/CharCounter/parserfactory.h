@@ -14,7 +14,9 @@ public:
         LOWERCASE,
         UPPERCASE,
         LOWER_UPPER_CASE,
-        ALPHA_AND_DIGITS
+        ALPHA_AND_DIGITS,
+        BYTES,
+        CODE_POINTS
     };
 
     ParserFactory() = delete;
@@ -1,22 +1,195 @@
+#include <algorithm>
+#include <condition_variable>
+#include <filesystem>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <thread>
 
 #include "aggregatorfactory.h"
+#include "instrumentation.h"
 #include "parser.h"
 #include "parserfactory.h"
 #include "parsingengine.h"
 #include "parsingqueue.h"
+#include "resultscache.h"
 
 static constexpr size_t c_MinPoolingThreshold{4};
 
+static size_t getThreadsCount()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+static void reportDiscoveryError(const std::filesystem::path& path, const std::error_code& errorCode)
+{
+    std::cerr << "Unable to read " << path.string() << ": " << errorCode.message() << ", skipped\n";
+}
+
+/* Each input path is either a file or a directory, in which case the contained files are retrieved recursively:
+   - only regular files are retained, the symbolic links to directories are not followed and the entries that cannot
+   be accessed (permission denied) or no longer exist are skipped
+   - any other error is reported and only the affected entry is skipped (the remaining entries of a directory that
+   cannot be read any further), the traversal continuing with the other directories
+   - the directories to be traversed are kept in a queue shared by all threads, each thread adding the subdirectories
+   it finds, so the work is balanced no matter how the files are distributed within the directory trees
+   - the file paths are provided in the order of the input paths, the ones found within each input directory being
+   sorted (the traversal order depends on the threads)
+   - any other input path is considered a file path (an error occurs when parsing it if invalid)
+*/
+static FilePathsArray discoverFilePaths(const FilePathsArray& inputPaths, size_t threadsCount)
+{
+    INSTRUMENT_SCOPE("ParsingEngine::discoverFiles");
+
+    struct Directory
+    {
+        std::filesystem::path m_Path;
+        size_t m_InputPathIndex;
+    };
+
+    std::vector<FilePathsArray> inputFilePaths(inputPaths.size());
+    std::vector<bool> isInputDirectory(inputPaths.size(), false);
+    std::vector<Directory> directoriesQueue;
+
+    for (size_t inputPathIndex{0}; inputPathIndex < inputPaths.size(); ++inputPathIndex)
+    {
+        std::error_code errorCode;
+
+        if (std::filesystem::is_directory(inputPaths[inputPathIndex], errorCode))
+        {
+            isInputDirectory[inputPathIndex] = true;
+            directoriesQueue.push_back({inputPaths[inputPathIndex], inputPathIndex});
+        }
+        else
+        {
+            inputFilePaths[inputPathIndex].push_back(inputPaths[inputPathIndex]);
+        }
+    }
+
+    std::mutex discoveryMutex;
+    std::condition_variable discoveryCondition;
+    size_t traversedDirectoriesCount{0};
+
+    // the discovery is finished when the queue is empty and no directory is being traversed (no more subdirectories)
+    auto discover{[&directoriesQueue, &inputFilePaths, &discoveryMutex, &discoveryCondition,
+                   &traversedDirectoriesCount]() {
+        for (;;)
+        {
+            Directory directory;
+
+            {
+                std::unique_lock<std::mutex> lock{discoveryMutex};
+                discoveryCondition.wait(lock, [&directoriesQueue, &traversedDirectoriesCount]() {
+                    return !directoriesQueue.empty() || 0 == traversedDirectoriesCount;
+                });
+
+                if (directoriesQueue.empty())
+                {
+                    break;
+                }
+
+                directory = std::move(directoriesQueue.back());
+                directoriesQueue.pop_back();
+                ++traversedDirectoriesCount;
+            }
+
+            std::vector<std::filesystem::path> subdirectories;
+            FilePathsArray filePaths;
+            std::error_code errorCode;
+
+            for (std::filesystem::directory_iterator it{directory.m_Path,
+                                                        std::filesystem::directory_options::skip_permission_denied,
+                                                        errorCode},
+                 end;
+                 !errorCode && it != end; it.increment(errorCode))
+            {
+                std::error_code entryErrorCode;
+
+                if (it->is_directory(entryErrorCode) && !it->is_symlink(entryErrorCode))
+                {
+                    subdirectories.push_back(it->path());
+                }
+                else if (it->is_regular_file(entryErrorCode))
+                {
+                    filePaths.push_back(it->path().string());
+                }
+
+                // entries removed meanwhile (or dangling symbolic links) are not regular files, so no error to report
+                if (entryErrorCode && std::errc::permission_denied != entryErrorCode &&
+                    std::errc::no_such_file_or_directory != entryErrorCode)
+                {
+                    reportDiscoveryError(it->path(), entryErrorCode);
+                }
+            }
+
+            if (errorCode)
+            {
+                reportDiscoveryError(directory.m_Path, errorCode);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{discoveryMutex};
+                FilePathsArray& directoryFilePaths{inputFilePaths[directory.m_InputPathIndex]};
+
+                directoryFilePaths.insert(directoryFilePaths.end(), std::make_move_iterator(filePaths.begin()),
+                                          std::make_move_iterator(filePaths.end()));
+
+                for (auto& subdirectory : subdirectories)
+                {
+                    directoriesQueue.push_back({std::move(subdirectory), directory.m_InputPathIndex});
+                }
+
+                --traversedDirectoriesCount;
+            }
+
+            discoveryCondition.notify_all();
+        }
+    }};
+
+    std::vector<std::thread> threads;
+
+    for (size_t threadIndex{1}; !directoriesQueue.empty() && threadIndex < threadsCount; ++threadIndex)
+    {
+        threads.emplace_back(discover);
+    }
+
+    discover();
+
+    for (auto& currentThread : threads)
+    {
+        currentThread.join();
+    }
+
+    FilePathsArray filePaths;
+
+    for (size_t inputPathIndex{0}; inputPathIndex < inputPaths.size(); ++inputPathIndex)
+    {
+        FilePathsArray& currentFilePaths{inputFilePaths[inputPathIndex]};
+
+        if (isInputDirectory[inputPathIndex])
+        {
+            std::sort(currentFilePaths.begin(), currentFilePaths.end());
+        }
+
+        filePaths.insert(filePaths.end(), std::make_move_iterator(currentFilePaths.begin()),
+                         std::make_move_iterator(currentFilePaths.end()));
+    }
+
+    return filePaths;
+}
+
 ParsingEngine::ParsingEngine(const std::string& parsingOption, const FilePathsArray& filePaths,
-                             const std::string& aggregationOption)
+                             const std::string& aggregationOption, const std::string& resultsCacheFilePath)
     : m_pIAggregator{nullptr}
+    , m_pResultsCache{nullptr}
     , m_TotalParsedDigitsCount{0}
     , m_TotalMatchingDigitsCount{0}
+    , m_CharOccurrences{}
 {
-    _buildAggregator(aggregationOption); // required for creating parsers, so should be built first
+    // required for creating parsers, so should be built first
+    _buildAggregator(aggregationOption);
+    _buildResultsCache(resultsCacheFilePath);
+
     _buildParsers(parsingOption, filePaths);
 }
 
@@ -36,15 +209,23 @@ ParsingEngine::~ParsingEngine()
         delete m_pIAggregator;
         m_pIAggregator = nullptr;
     }
+
+    if (m_pResultsCache)
+    {
+        delete m_pResultsCache;
+        m_pResultsCache = nullptr;
+    }
 }
 
 void ParsingEngine::run()
 {
     // use thread pool only if number of files to be parsed reaches the threshold (otherwise use dedicated thread per
-    // parser)
+    // parser), the pool is sized to the hardware as the threads open one file at a time
     if (const size_t c_ParsersCount{m_Parsers.size()}; c_ParsersCount >= c_MinPoolingThreshold)
     {
-        ParsingQueue parsingQueue{c_MinPoolingThreshold};
+        INSTRUMENT_SCOPE("ParsingEngine::parse");
+
+        ParsingQueue parsingQueue{std::min(getThreadsCount(), c_ParsersCount)};
         const bool c_IsParsingActive{parsingQueue.addParsingTasks(m_Parsers)};
 
         if (c_IsParsingActive)
@@ -54,6 +235,7 @@ void ParsingEngine::run()
     }
     else
     {
+        INSTRUMENT_SCOPE("ParsingEngine::parse");
         std::vector<std::thread> threads;
         threads.reserve(c_ParsersCount);
 
@@ -68,6 +250,11 @@ void ParsingEngine::run()
         }
     }
 
+    if (m_pResultsCache && !m_pResultsCache->save())
+    {
+        std::clog << "The results cache could not be saved!\n\n";
+    }
+
     _computeStatistics();
 }
 
@@ -86,6 +273,16 @@ const CharOccurrencesArray& ParsingEngine::getCharOccurrences() const
     return m_CharOccurrences;
 }
 
+const CodePointOccurrences& ParsingEngine::getCodePointOccurrences() const
+{
+    return m_CodePointOccurrences;
+}
+
+size_t ParsingEngine::getCachedFilesCount() const
+{
+    return m_pResultsCache ? m_pResultsCache->getRetrievedResultsCount() : 0;
+}
+
 void ParsingEngine::_buildAggregator(const std::string& aggregationOption)
 {
     const std::map<std::string, AggregatorFactory::AggregatorType> c_AggregatingOptionsMap{
@@ -102,6 +299,19 @@ void ParsingEngine::_buildAggregator(const std::string& aggregationOption)
     }
 }
 
+void ParsingEngine::_buildResultsCache(const std::string& resultsCacheFilePath)
+{
+    if (!resultsCacheFilePath.empty())
+    {
+        m_pResultsCache = new ResultsCache{resultsCacheFilePath};
+
+        if (!m_pResultsCache->load())
+        {
+            std::clog << "Invalid results cache file " << resultsCacheFilePath << ", all files will be parsed.\n\n";
+        }
+    }
+}
+
 void ParsingEngine::_buildParsers(const std::string& parsingOption, const FilePathsArray& filePaths)
 {
     if (m_pIAggregator)
@@ -112,21 +322,34 @@ void ParsingEngine::_buildParsers(const std::string& parsingOption, const FilePa
             {"-u", ParserFactory::ParserType::UPPERCASE},
             {"-lu", ParserFactory::ParserType::LOWER_UPPER_CASE},
             {"-ad", ParserFactory::ParserType::ALPHA_AND_DIGITS},
+            {"-b", ParserFactory::ParserType::BYTES},
+            {"-U", ParserFactory::ParserType::CODE_POINTS},
         };
 
         auto parserTypeIt{c_ParsingOptionsMap.find(parsingOption)};
 
         if (c_ParsingOptionsMap.cend() != parserTypeIt)
         {
+            const FilePathsArray c_FilePaths{discoverFilePaths(filePaths, getThreadsCount())};
+
             m_Parsers.clear();
-            m_Parsers.reserve(filePaths.size());
+            m_Parsers.reserve(c_FilePaths.size());
 
-            for (const auto& path : filePaths)
+            for (const auto& path : c_FilePaths)
             {
-                Parser* const pParser{ParserFactory::createParser(parserTypeIt->second, path, m_pIAggregator)};
+                // the cache file might be located within a parsed directory (and it changes with each run)
+                const bool c_IsCacheFile{m_pResultsCache && m_pResultsCache->isCacheFile(path)};
+                Parser* const pParser{
+                    c_IsCacheFile ? nullptr : ParserFactory::createParser(parserTypeIt->second, path, m_pIAggregator)};
 
                 if (pParser)
                 {
+                    // the cache contains byte occurrences, so it cannot be used when counting code points
+                    if (ParserFactory::ParserType::CODE_POINTS != parserTypeIt->second)
+                    {
+                        pParser->setResultsCache(m_pResultsCache);
+                    }
+
                     m_Parsers.push_back(pParser);
                 }
             }
@@ -136,6 +359,8 @@ void ParsingEngine::_buildParsers(const std::string& parsingOption, const FilePa
 
 void ParsingEngine::_computeStatistics()
 {
+    INSTRUMENT_SCOPE("ParsingEngine::aggregate");
+
     for (auto pParser : m_Parsers)
     {
         if (pParser)
@@ -155,5 +380,6 @@ void ParsingEngine::_computeStatistics()
     if (m_pIAggregator)
     {
         m_CharOccurrences = m_pIAggregator->getCharOccurrences();
+        m_CodePointOccurrences = m_pIAggregator->getCodePointOccurrences();
     }
 }
@@ -1,15 +1,18 @@
 #pragma once
 
+#include "codepointoccurrences.h"
 #include "utilities.h"
 
 class Parser;
 class IAggregator;
+class ResultsCache;
 
 class ParsingEngine
 {
 public:
+    // the results cache (if a file path is provided) is loaded on construction and saved after running
     ParsingEngine(const std::string& parsingOption, const FilePathsArray& filePaths,
-                  const std::string& aggregationOption);
+                  const std::string& aggregationOption, const std::string& resultsCacheFilePath = "");
     ~ParsingEngine();
 
     void run();
@@ -17,15 +20,22 @@ public:
     size_t getTotalParsedDigitsCount() const;
     size_t getTotalMatchingDigitsCount() const;
     const CharOccurrencesArray& getCharOccurrences() const;
+    const CodePointOccurrences& getCodePointOccurrences() const;
+
+    // number of files whose results have been retrieved from cache (not parsed again)
+    size_t getCachedFilesCount() const;
 
 private:
     void _buildAggregator(const std::string& aggregationOption);
+    void _buildResultsCache(const std::string& resultsCacheFilePath);
     void _buildParsers(const std::string& parsingOption, const FilePathsArray& filePaths);
     void _computeStatistics();
 
     std::vector<Parser*> m_Parsers;
     IAggregator* m_pIAggregator;
+    ResultsCache* m_pResultsCache;
     size_t m_TotalParsedDigitsCount;
     size_t m_TotalMatchingDigitsCount;
     CharOccurrencesArray m_CharOccurrences;
+    CodePointOccurrences m_CodePointOccurrences;
 };
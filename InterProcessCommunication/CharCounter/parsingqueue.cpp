@@ -53,9 +53,18 @@ void ParsingQueue::finishParsingAndStop()
 {
     if (!m_ShouldStopParsing)
     {
-        while (!m_QueuedParsers.empty())
+        // the queue is accessed by the parsing threads as well, so it should be checked with the mutex locked
+        for (bool isQueueEmpty{false}; !isQueueEmpty;)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds{100});
+            {
+                std::unique_lock<std::mutex> lock{m_QueueMutex};
+                isQueueEmpty = m_QueuedParsers.empty();
+            }
+
+            if (!isQueueEmpty)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{100});
+            }
         }
 
         stop();
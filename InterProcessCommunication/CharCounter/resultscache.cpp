@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "instrumentation.h"
+#include "resultscache.h"
+
+static const std::string c_CacheHeader{"CharCounterCache 1"};
+
+ResultsCache::ResultsCache(const std::string& cacheFilePath)
+    : m_CacheFilePath{cacheFilePath}
+    , m_RetrievedResultsCount{0}
+    , m_IsModified{false}
+{
+    std::error_code errorCode;
+    const std::filesystem::path c_CurrentDirectory{std::filesystem::current_path(errorCode)};
+
+    // if the current directory cannot be retrieved, the relative paths get normalized individually
+    if (!errorCode)
+    {
+        m_CurrentDirectory = c_CurrentDirectory.lexically_normal().string();
+
+        if (!_isNormalPath(m_CurrentDirectory) || '/' != m_CurrentDirectory.front())
+        {
+            m_CurrentDirectory.clear();
+        }
+    }
+
+    m_CacheFileKey = _getKey(m_CacheFilePath);
+    m_TemporaryFileKey = _getKey(_getTemporaryFilePath());
+}
+
+bool ResultsCache::load()
+{
+    INSTRUMENT_SCOPE("ResultsCache::load");
+
+    std::ifstream in{m_CacheFilePath};
+    bool success{true};
+
+    m_Entries.clear();
+    m_IsModified = false;
+
+    if (in.is_open())
+    {
+        std::string line;
+        success = std::getline(in, line) && c_CacheHeader == line;
+
+        while (success && std::getline(in, line))
+        {
+            const char* pCurrent{line.data()};
+            const char* const c_pEnd{line.data() + line.size()};
+
+            // numbers separated by single spaces, each one followed by a space (the path being the last item)
+            auto readNumber{[&pCurrent, c_pEnd, &success](auto& number) {
+                const auto [pNext, errorCode]{std::from_chars(pCurrent, c_pEnd, number)};
+                success = success && std::errc{} == errorCode && pNext != c_pEnd && ' ' == *pNext;
+                pCurrent = success ? pNext + 1 : c_pEnd;
+            }};
+
+            Entry entry{{}, {{}, 0, false}, false};
+            int maxCharsCountExceeded{0};
+            size_t nonZeroOccurrencesCount{0};
+
+            readNumber(entry.m_FileStatus.m_Size);
+            readNumber(entry.m_FileStatus.m_ModificationTime);
+            readNumber(entry.m_FileStatus.m_Inode);
+            readNumber(entry.m_FileResult.m_ParsedCharsCount);
+            readNumber(maxCharsCountExceeded);
+            readNumber(nonZeroOccurrencesCount);
+
+            CharOccurrencesArray& byteOccurrences{entry.m_FileResult.m_ByteOccurrences};
+            success = success && nonZeroOccurrencesCount <= byteOccurrences.size();
+
+            // each byte value should occur at most once, with a non-zero occurrences count
+            for (size_t index{0}; success && index < nonZeroOccurrencesCount; ++index)
+            {
+                size_t byte{0};
+
+                readNumber(byte);
+                success = success && byte < byteOccurrences.size() && 0 == byteOccurrences[byte];
+
+                if (success)
+                {
+                    readNumber(byteOccurrences[byte]);
+                    success = success && byteOccurrences[byte] > 0;
+                }
+            }
+
+            // the path is the remaining part of the line (might contain spaces)
+            success = success && pCurrent != c_pEnd;
+
+            if (success)
+            {
+                entry.m_FileResult.m_MaxCharsCountExceeded = maxCharsCountExceeded != 0;
+                m_Entries.insert_or_assign(std::string{pCurrent, c_pEnd}, entry);
+            }
+        }
+
+        if (!success)
+        {
+            m_Entries.clear();
+        }
+    }
+
+    return success;
+}
+
+bool ResultsCache::save()
+{
+    INSTRUMENT_SCOPE("ResultsCache::save");
+
+    // written to a temporary file first, so an interrupted run doesn't leave a truncated cache
+    const std::string c_TemporaryFilePath{_getTemporaryFilePath()};
+    bool success{false};
+
+    do
+    {
+        // the unused entries of files that changed (or got removed) meanwhile are discarded
+        std::vector<const std::pair<const std::string, Entry>*> entriesToSave;
+        entriesToSave.reserve(m_Entries.size());
+
+        for (const auto& entry : m_Entries)
+        {
+            if (entry.second.m_IsUsed || getFileStatus(entry.first) == entry.second.m_FileStatus)
+            {
+                entriesToSave.push_back(&entry);
+            }
+        }
+
+        // no need to write the cache file if unchanged
+        if (!m_IsModified && entriesToSave.size() == m_Entries.size())
+        {
+            success = true;
+            break;
+        }
+
+        std::ofstream out{c_TemporaryFilePath};
+
+        if (!out.is_open())
+        {
+            break;
+        }
+
+        out << c_CacheHeader << "\n";
+
+        for (const auto* pEntry : entriesToSave)
+        {
+            const auto& [path, entry]{*pEntry};
+            const CharOccurrencesArray& c_ByteOccurrences{entry.m_FileResult.m_ByteOccurrences};
+            size_t nonZeroOccurrencesCount{0};
+
+            for (const size_t c_Occurrences : c_ByteOccurrences)
+            {
+                nonZeroOccurrencesCount += c_Occurrences > 0 ? 1 : 0;
+            }
+
+            out << entry.m_FileStatus.m_Size << " " << entry.m_FileStatus.m_ModificationTime << " "
+                << entry.m_FileStatus.m_Inode << " " << entry.m_FileResult.m_ParsedCharsCount << " "
+                << entry.m_FileResult.m_MaxCharsCountExceeded << " " << nonZeroOccurrencesCount;
+
+            for (size_t byte{0}; byte < c_ByteOccurrences.size(); ++byte)
+            {
+                if (c_ByteOccurrences[byte] > 0)
+                {
+                    out << " " << byte << " " << c_ByteOccurrences[byte];
+                }
+            }
+
+            out << " " << path << "\n";
+        }
+
+        out.close();
+
+        if (!out)
+        {
+            break;
+        }
+
+        std::error_code errorCode;
+        std::filesystem::rename(c_TemporaryFilePath, m_CacheFilePath, errorCode);
+        success = !errorCode;
+        m_IsModified = m_IsModified && !success;
+    } while (false);
+
+    return success;
+}
+
+// a single system call for retrieving all required data (as this is done for each file)
+std::optional<ResultsCache::FileStatus> ResultsCache::getFileStatus(const std::string& filePath)
+{
+    std::optional<FileStatus> fileStatus;
+    struct stat fileStat;
+
+    if (0 == stat(filePath.c_str(), &fileStat))
+    {
+#ifdef __APPLE__
+        const timespec& c_ModificationTime{fileStat.st_mtimespec};
+#else
+        const timespec& c_ModificationTime{fileStat.st_mtim};
+#endif
+
+        const int64_t c_ModificationTimeNs{static_cast<int64_t>(c_ModificationTime.tv_sec) * 1000000000 +
+                                           c_ModificationTime.tv_nsec};
+
+        fileStatus = FileStatus{static_cast<uintmax_t>(fileStat.st_size), c_ModificationTimeNs,
+                                static_cast<uint64_t>(fileStat.st_ino)};
+    }
+
+    return fileStatus;
+}
+
+std::optional<ResultsCache::FileResult> ResultsCache::find(const std::string& filePath, const FileStatus& fileStatus)
+{
+    std::optional<FileResult> fileResult;
+    const std::string c_Key{_getKey(filePath)};
+
+    std::lock_guard<std::mutex> lock{m_CacheMutex};
+
+    if (auto it{m_Entries.find(c_Key)}; it != m_Entries.end() && it->second.m_FileStatus == fileStatus)
+    {
+        it->second.m_IsUsed = true;
+        fileResult = it->second.m_FileResult;
+        ++m_RetrievedResultsCount;
+    }
+
+    return fileResult;
+}
+
+void ResultsCache::store(const std::string& filePath, const FileStatus& fileStatus, const FileResult& fileResult)
+{
+    const std::string c_Key{_getKey(filePath)};
+
+    // a path containing a line break cannot be stored in the cache file
+    if (c_Key.find('\n') == std::string::npos)
+    {
+        std::lock_guard<std::mutex> lock{m_CacheMutex};
+        m_Entries[c_Key] = Entry{fileStatus, fileResult, true};
+        m_IsModified = true;
+    }
+}
+
+bool ResultsCache::isCacheFile(const std::string& filePath) const
+{
+    const std::string c_Key{_getKey(filePath)};
+
+    return c_Key == m_CacheFileKey || c_Key == m_TemporaryFileKey;
+}
+
+size_t ResultsCache::getRetrievedResultsCount() const
+{
+    return m_RetrievedResultsCount;
+}
+
+std::string ResultsCache::_getTemporaryFilePath() const
+{
+    return m_CacheFilePath + ".tmp";
+}
+
+// the (costly) normalization is only performed for paths that require it (e.g. the ones containing "..")
+std::string ResultsCache::_getKey(const std::string& filePath) const
+{
+    std::string key;
+
+    if (_isNormalPath(filePath))
+    {
+        key = '/' == filePath.front() || m_CurrentDirectory.empty() ? filePath : m_CurrentDirectory + '/' + filePath;
+    }
+    else
+    {
+        std::error_code errorCode;
+        const std::filesystem::path c_AbsolutePath{std::filesystem::absolute(filePath, errorCode)};
+
+        key = errorCode ? filePath : c_AbsolutePath.lexically_normal().string();
+    }
+
+    return key;
+}
+
+bool ResultsCache::_isNormalPath(std::string_view path)
+{
+    bool isNormal{!path.empty() && '/' != path.back()};
+
+    for (size_t segmentBegin{isNormal && '/' == path.front() ? 1u : 0u}; isNormal && segmentBegin < path.size();)
+    {
+        const size_t c_SegmentEnd{std::min(path.find('/', segmentBegin), path.size())};
+        const std::string_view c_Segment{path.substr(segmentBegin, c_SegmentEnd - segmentBegin)};
+
+        isNormal = !c_Segment.empty() && "." != c_Segment && ".." != c_Segment;
+        segmentBegin = c_SegmentEnd + 1;
+    }
+
+    return isNormal;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include "utilities.h"
+
+/* Persistent cache of the per-file parsing results, so the unchanged files are not parsed again on the next runs:
+   - the occurrences of all byte values are stored, so a cached result can be reused by any parsing option counting
+   bytes (the matching chars are selected from the cached occurrences)
+   - each entry is identified by the absolute file path and remains valid as long as the size, modification time and
+   inode of the file do not change
+   - the entries of files not parsed in the current run are kept when saving, unless the files changed or no longer
+   exist (the cache file is not written if there are no changes)
+
+   Cache file format (text, one entry per line after the header line):
+   size modification_time inode parsed_chars_count max_chars_exceeded non_zero_count [byte occurrences]... path
+*/
+class ResultsCache
+{
+public:
+    struct FileStatus
+    {
+        bool operator==(const FileStatus& other) const = default;
+
+        uintmax_t m_Size;
+        int64_t m_ModificationTime;
+        uint64_t m_Inode;
+    };
+
+    struct FileResult
+    {
+        CharOccurrencesArray m_ByteOccurrences;
+        size_t m_ParsedCharsCount;
+        bool m_MaxCharsCountExceeded;
+    };
+
+    explicit ResultsCache(const std::string& cacheFilePath);
+
+    // a missing cache file is not an error (empty cache), an invalid one is ignored (false returned, empty cache)
+    bool load();
+    bool save();
+
+    // nullopt if the file cannot be accessed
+    static std::optional<FileStatus> getFileStatus(const std::string& filePath);
+
+    // can be called concurrently (e.g. by parsers running on multiple threads)
+    std::optional<FileResult> find(const std::string& filePath, const FileStatus& fileStatus);
+    void store(const std::string& filePath, const FileStatus& fileStatus, const FileResult& fileResult);
+
+    // true for the cache file and its temporary file (written when saving), which should not be parsed
+    bool isCacheFile(const std::string& filePath) const;
+
+    size_t getRetrievedResultsCount() const;
+
+private:
+    struct Entry
+    {
+        FileStatus m_FileStatus;
+        FileResult m_FileResult;
+        bool m_IsUsed;
+    };
+
+    std::string _getKey(const std::string& filePath) const;
+    std::string _getTemporaryFilePath() const;
+
+    // path (absolute or relative) containing no "." / ".." segments and no redundant separators
+    static bool _isNormalPath(std::string_view path);
+
+    std::string m_CacheFilePath;
+    std::string m_CurrentDirectory;
+    std::string m_CacheFileKey;
+    std::string m_TemporaryFileKey;
+    std::unordered_map<std::string, Entry> m_Entries;
+    std::mutex m_CacheMutex;
+    size_t m_RetrievedResultsCount;
+    bool m_IsModified; // entries stored since loading / saving
+};
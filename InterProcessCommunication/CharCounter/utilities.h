@@ -5,5 +5,6 @@
 #include <string>
 #include <vector>
 
-using CharOccurrencesArray = std::array<size_t, 128>;
+// occurrences of each byte value (indexed by the char converted to unsigned char)
+using CharOccurrencesArray = std::array<size_t, 256>;
 using FilePathsArray = std::vector<std::string>;
@@ -6,6 +6,7 @@
 #include "csvparser.h"
 #include "csvparsingqueue.h"
 #include "icsvaggregator.h"
+#include "instrumentation.h"
 
 CSVParsingQueue::CSVParsingQueue(ICSVAggregator& csvAggregator, size_t threadsCount)
     : m_CsvAggregator{csvAggregator}
@@ -135,7 +136,17 @@ void CSVParsingQueue::_parseCSVFile(const std::filesystem::path& inputCSVPath)
     if (Utils::isCsvFilePath(inputCSVPath))
     {
         CSVParser parser{inputCSVPath};
-        parser.parse();
-        m_CsvAggregator.storeHostData(parser.getOutput());
+
+        {
+            INSTRUMENT_SCOPE("CSVParsingQueue::parseFile");
+            parser.parse();
+        }
+
+        {
+            INSTRUMENT_SCOPE("CSVParsingQueue::aggregate");
+            m_CsvAggregator.storeHostData(parser.getOutput());
+        }
+
+        INSTRUMENT_COUNT("CSVParsingQueue::parsedFilesCount", 1);
     }
 }
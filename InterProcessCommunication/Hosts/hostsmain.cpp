@@ -3,6 +3,7 @@
 #include "apputils.h"
 #include "csvaggregator.h"
 #include "csvparsingqueue.h"
+#include "instrumentation.h"
 
 static constexpr size_t c_MaxCSVFilesCount{5};
 
@@ -55,6 +56,9 @@ int main(int argc, char* argv[])
                 {
                     parsingQueue.finishParsingAndStop();
 
+                    // written to the working directory (the input directory should only contain CSV files)
+                    INSTRUMENT_DUMP("hosts");
+
                     const bool c_Success{csvAggregator.writeDataToOutputCSV()};
 
                     if (c_Success)
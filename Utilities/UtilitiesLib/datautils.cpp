@@ -1,9 +1,107 @@
 #include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SSE2_BIT_STRING_PARSING
+#endif
+
 #include "datautils.h"
 
+static constexpr size_t c_BitsPerBlock{64};
+static constexpr size_t c_ReadChunkSize{1 << 16};
+
+/* Validates the chars and packs them into blocks (char i corresponds to bit i % 64 of block i / 64):
+   - with SSE2 16 chars are compared at once to '0' and '1', the comparison masks being converted into bits
+   - otherwise (or for the remaining chars) 8 chars are loaded into an integer and checked/converted by using bit
+   operations (little endian only)
+   - returns false if any char is neither '0' nor '1'
+*/
+static bool packBitChars(const char* chars, size_t charsCount, uint64_t* blocks)
+{
+    bool isValid{true};
+
+    for (size_t blockIndex{0}; isValid && blockIndex * c_BitsPerBlock < charsCount; ++blockIndex)
+    {
+        const char* const c_BlockChars{chars + blockIndex * c_BitsPerBlock};
+        const size_t c_BlockCharsCount{std::min(c_BitsPerBlock, charsCount - blockIndex * c_BitsPerBlock)};
+
+        uint64_t block{0};
+        size_t charIndex{0};
+
+#ifdef SSE2_BIT_STRING_PARSING
+        const __m128i c_Zeros{_mm_set1_epi8('0')};
+        const __m128i c_Ones{_mm_set1_epi8('1')};
+
+        for (; isValid && charIndex + 16 <= c_BlockCharsCount; charIndex += 16)
+        {
+            const __m128i c_Chars{_mm_loadu_si128(reinterpret_cast<const __m128i*>(c_BlockChars + charIndex))};
+            const __m128i c_AreOnes{_mm_cmpeq_epi8(c_Chars, c_Ones)};
+            const __m128i c_AreBits{_mm_or_si128(_mm_cmpeq_epi8(c_Chars, c_Zeros), c_AreOnes)};
+
+            isValid = _mm_movemask_epi8(c_AreBits) == 0xFFFF;
+            block |= static_cast<uint64_t>(_mm_movemask_epi8(c_AreOnes)) << charIndex;
+        }
+#endif
+
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            for (; isValid && charIndex + 8 <= c_BlockCharsCount; charIndex += 8)
+            {
+                uint64_t eightChars;
+                std::memcpy(&eightChars, c_BlockChars + charIndex, sizeof(eightChars));
+
+                // '0' is 0x30 and '1' is 0x31, the multiplication gathers the lowest bit of each byte into the top byte
+                isValid = (eightChars & 0xFEFEFEFEFEFEFEFEu) == 0x3030303030303030u;
+                block |= (((eightChars & 0x0101010101010101u) * 0x0102040810204080u) >> 56) << charIndex;
+            }
+        }
+
+        for (; isValid && charIndex < c_BlockCharsCount; ++charIndex)
+        {
+            const char c_Char{c_BlockChars[charIndex]};
+
+            isValid = c_Char == '0' || c_Char == '1';
+            block |= static_cast<uint64_t>(c_Char == '1') << charIndex;
+        }
+
+        blocks[blockIndex] = block;
+    }
+
+    return isValid;
+}
+
+/* Ensures the buffer contains at least the required number of unparsed chars (if the input allows it):
+   - the chars are read in chunks (the already parsed ones being discarded first), so an invalid header (e.g. huge word
+   size) does not cause an excessive allocation
+   - no more than the max number of unparsed chars is read
+*/
+static bool ensureChars(std::istream& in, size_t requiredCount, size_t maxCount, std::string& buffer, size_t& position)
+{
+    if (buffer.size() - position < requiredCount)
+    {
+        buffer.erase(0, position);
+        position = 0;
+
+        while (buffer.size() < requiredCount && in.good())
+        {
+            const size_t c_InitialSize{buffer.size()};
+            const size_t c_CharsCount{std::min(maxCount - c_InitialSize, c_ReadChunkSize)};
+
+            buffer.resize(c_InitialSize + c_CharsCount);
+            in.read(buffer.data() + c_InitialSize, static_cast<std::streamsize>(c_CharsCount));
+            buffer.resize(c_InitialSize + static_cast<size_t>(in.gcount()));
+        }
+    }
+
+    return buffer.size() - position >= requiredCount;
+}
+
 bool Utilities::convertBitStringToDataWord(const std::string& bitString, DataWord& word)
 {
     const bool c_IsInputValid{!bitString.empty() && std::all_of(bitString.cbegin(), bitString.cend(),
@@ -27,6 +125,139 @@ DataWord Utilities::invertDataWord(const DataWord& word)
     return result;
 }
 
+size_t Utilities::getSegmentBegin(size_t wordSize, size_t segmentsCount, size_t segmentIndex)
+{
+    assert(segmentsCount > 0 && segmentIndex <= segmentsCount);
+
+    return segmentIndex * wordSize / segmentsCount;
+}
+
+// the bit belongs to the last segment that begins before or at its index
+size_t Utilities::getSegmentIndex(size_t wordSize, size_t segmentsCount, size_t bitIndex)
+{
+    assert(segmentsCount > 0 && bitIndex < wordSize);
+
+    return ((bitIndex + 1) * segmentsCount - 1) / wordSize;
+}
+
+bool Utilities::parseBitStrings(std::istream& in, size_t wordsCount, size_t wordSize, PackedDataSet& packedDataSet)
+{
+    PackedDataSet result{wordSize, wordSize / c_BitsPerBlock + (wordSize % c_BitsPerBlock > 0 ? 1 : 0), {}};
+
+    // the minimum input size (words and separators) should be representable, so the remaining chars counts computed
+    // below cannot overflow
+    bool isValid{wordsCount > 0 && wordSize > 0 && wordSize < SIZE_MAX && wordsCount <= SIZE_MAX / (wordSize + 1)};
+
+    std::string buffer;
+    size_t position{0};
+
+    auto isWhiteSpace{[](char ch) { return std::isspace(static_cast<unsigned char>(ch)) != 0; }};
+
+    for (size_t wordIndex{0}; isValid && wordIndex < wordsCount; ++wordIndex)
+    {
+        /* Each remaining word (except the current one) is preceded by at least one separator, so the remaining input
+           (starting with the current word) cannot be shorter than this. Reading at most this number of chars ensures
+           that no chars located after the last word are consumed.
+        */
+        const size_t c_MinRemainingCharsCount{(wordsCount - wordIndex) * (wordSize + 1) - 1};
+
+        // skip separators
+        do
+        {
+            position = static_cast<size_t>(
+                std::find_if_not(buffer.cbegin() + static_cast<std::ptrdiff_t>(position), buffer.cend(), isWhiteSpace) -
+                buffer.cbegin());
+        } while (position == buffer.size() && ensureChars(in, 1, c_MinRemainingCharsCount, buffer, position));
+
+        // the blocks are allocated only after the word chars have actually been read (so a header requiring more input
+        // than available cannot cause a huge allocation)
+        if (!ensureChars(in, wordSize, c_MinRemainingCharsCount, buffer, position))
+        {
+            isValid = false;
+            break;
+        }
+
+        result.m_Blocks.resize(result.m_Blocks.size() + result.m_BlocksPerWord);
+
+        if (!packBitChars(buffer.data() + position, wordSize,
+                          result.m_Blocks.data() + wordIndex * result.m_BlocksPerWord))
+        {
+            isValid = false;
+            break;
+        }
+
+        position += wordSize;
+
+        // the word should be followed by a separator or by the end of input (otherwise it is longer than required)
+        if (position < buffer.size())
+        {
+            isValid = isWhiteSpace(buffer[position]);
+        }
+        else
+        {
+            const auto c_NextChar{in.peek()};
+            isValid = c_NextChar == std::char_traits<char>::eof() || isWhiteSpace(static_cast<char>(c_NextChar));
+        }
+    }
+
+    if (isValid)
+    {
+        packedDataSet = std::move(result);
+    }
+
+    return isValid;
+}
+
+DataSet Utilities::unpackDataSet(const PackedDataSet& packedDataSet)
+{
+    const size_t c_WordsCount{packedDataSet.m_BlocksPerWord > 0
+                                  ? packedDataSet.m_Blocks.size() / packedDataSet.m_BlocksPerWord
+                                  : 0};
+    DataSet dataSet(c_WordsCount, DataWord(packedDataSet.m_WordSize, false));
+
+    for (size_t wordIndex{0}; wordIndex < c_WordsCount; ++wordIndex)
+    {
+        const uint64_t* const c_WordBlocks{packedDataSet.m_Blocks.data() + wordIndex * packedDataSet.m_BlocksPerWord};
+        DataWord& word{dataSet[wordIndex]};
+
+        for (size_t bitIndex{0}; bitIndex < packedDataSet.m_WordSize; ++bitIndex)
+        {
+            word[bitIndex] = (c_WordBlocks[bitIndex / c_BitsPerBlock] >> (bitIndex % c_BitsPerBlock)) & 1u;
+        }
+    }
+
+    return dataSet;
+}
+
+PackedDataSet Utilities::packDataSet(const DataSet& dataSet)
+{
+    PackedDataSet packedDataSet;
+
+    const size_t c_WordSize{dataSet.empty() ? 0 : dataSet.front().size()};
+
+    if (c_WordSize > 0 && std::all_of(dataSet.cbegin(), dataSet.cend(),
+                                      [c_WordSize](const DataWord& word) { return c_WordSize == word.size(); }))
+    {
+        packedDataSet.m_WordSize = c_WordSize;
+        packedDataSet.m_BlocksPerWord = (c_WordSize + c_BitsPerBlock - 1) / c_BitsPerBlock;
+        packedDataSet.m_Blocks.resize(dataSet.size() * packedDataSet.m_BlocksPerWord, 0);
+
+        for (size_t wordIndex{0}; wordIndex < dataSet.size(); ++wordIndex)
+        {
+            uint64_t* const c_WordBlocks{packedDataSet.m_Blocks.data() + wordIndex * packedDataSet.m_BlocksPerWord};
+            const DataWord& c_Word{dataSet[wordIndex]};
+
+            for (size_t bitIndex{0}; bitIndex < c_WordSize; ++bitIndex)
+            {
+                c_WordBlocks[bitIndex / c_BitsPerBlock] |= static_cast<uint64_t>(c_Word[bitIndex])
+                                                           << (bitIndex % c_BitsPerBlock);
+            }
+        }
+    }
+
+    return packedDataSet;
+}
+
 void Utilities::leftTrimWhiteSpace(std::string& str)
 {
     const auto it{std::find_if(str.cbegin(), str.cend(), [](char ch) { return !std::isspace(ch); })};
@@ -48,10 +279,22 @@ void Utilities::trimWhiteSpace(std::string& str)
 }
 
 std::istream& operator>>(std::istream& in, DataSet& dataSet)
+{
+    PackedDataSet packedDataSet;
+
+    if (in >> packedDataSet)
+    {
+        dataSet = Utilities::unpackDataSet(packedDataSet);
+    }
+
+    return in;
+}
+
+std::istream& operator>>(std::istream& in, PackedDataSet& packedDataSet)
 {
     size_t wordsCount{0};
     size_t wordSize{0};
-    DataSet tempDataSet;
+    bool isValid{false};
 
     do
     {
@@ -66,40 +309,13 @@ std::istream& operator>>(std::istream& in, DataSet& dataSet)
 
         if (in.fail() || wordSize == 0)
         {
-            wordsCount = 0;
             break;
         }
 
-        tempDataSet.reserve(wordsCount);
+        isValid = Utilities::parseBitStrings(in, wordsCount, wordSize, packedDataSet);
     } while (false);
 
-    for (size_t currentWordNr{0}; currentWordNr < wordsCount; ++currentWordNr)
-    {
-        std::string currentBitString;
-        in >> currentBitString;
-
-        if (in.fail())
-        {
-            break;
-        }
-
-        DataWord currentWord;
-        const bool c_IsValidBinary{Utilities::convertBitStringToDataWord(currentBitString, currentWord)};
-
-        if (c_IsValidBinary && wordSize == currentWord.size())
-        {
-            tempDataSet.emplace_back(std::move(currentWord));
-            continue;
-        }
-
-        break;
-    }
-
-    if (!tempDataSet.empty() && wordsCount == tempDataSet.size())
-    {
-        dataSet = std::move(tempDataSet);
-    }
-    else
+    if (!isValid)
     {
         in.setstate(std::ios::failbit);
     }
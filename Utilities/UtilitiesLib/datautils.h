@@ -1,6 +1,7 @@
 /* General purpose data type(def)s and conversion functions*/
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <list>
 #include <string>
@@ -24,11 +25,41 @@ using SizeVector = std::vector<size_t>;
 using DataWord = std::vector<bool>;
 using DataSet = std::vector<DataWord>;
 
+/* Data set with the bits of each word packed into 64 bit blocks:
+   - bit i of a word is stored as bit (i % 64) of block (i / 64) of the word
+   - all words occupy the same number of blocks, the unused bits of the last block of each word being 0
+*/
+struct PackedDataSet
+{
+    size_t m_WordSize{0};
+    size_t m_BlocksPerWord{0};
+    std::vector<uint64_t> m_Blocks;
+};
+
 namespace Utilities
 {
 bool convertBitStringToDataWord(const std::string& bitString, DataWord& word);
 DataWord invertDataWord(const DataWord& word);
 
+/* Split of a word into segments of (almost) equal size (e.g. for inverting each segment separately): segment i contains
+   the bits starting with getSegmentBegin(i) and ending before getSegmentBegin(i + 1)
+*/
+size_t getSegmentBegin(size_t wordSize, size_t segmentsCount, size_t segmentIndex);
+size_t getSegmentIndex(size_t wordSize, size_t segmentsCount, size_t bitIndex);
+
+/* Bulk parsing of bit strings (words) separated by whitespace:
+   - the input is read in large chunks instead of word by word, however never beyond the last word (so further data
+   can be read from the same stream)
+   - the chars are validated and packed multiple at a time (16 with SSE2, 8 by using 64 bit arithmetic otherwise)
+   - returns false (packed data set unchanged) if the input is invalid: less words than required, different word size,
+   chars other than '0' and '1'
+   - memory is allocated only for the words actually found in the input, whatever the requested words count and size
+*/
+bool parseBitStrings(std::istream& in, size_t wordsCount, size_t wordSize, PackedDataSet& packedDataSet);
+DataSet unpackDataSet(const PackedDataSet& packedDataSet);
+// the words should have the same size, otherwise an empty packed data set is returned
+PackedDataSet packDataSet(const DataSet& dataSet);
+
 /* Convenience function for getting a std::list<DataType>::iterator based on a "virtual index", i.e. number of hops from
  * the starting element */
 template <typename DataType>
@@ -50,7 +81,9 @@ void rightTrimWhiteSpace(std::string& str);
 void trimWhiteSpace(std::string& str);
 } // namespace Utilities
 
+// same input format for both: header (words count, word size) followed by the words
 std::istream& operator>>(std::istream& in, DataSet& dataSet);
+std::istream& operator>>(std::istream& in, PackedDataSet& packedDataSet);
 std::ostream& operator<<(std::ostream& out, const DataSet& dataSet);
 std::ostream& operator<<(std::ostream& out, const DataWord& word);
 std::ostream& operator<<(std::ostream& out, const SizeVector& indexes);
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "instrumentation.h"
+#include "utils.h"
+
+static constexpr size_t c_MaxEventsPerThread{1 << 20};
+
+struct TraceEvent
+{
+    const char* m_Name;
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::chrono::nanoseconds m_Duration;
+};
+
+struct TimerAggregate
+{
+    const char* m_Name;
+    uint64_t m_CallsCount;
+    std::chrono::nanoseconds m_TotalDuration;
+    std::chrono::nanoseconds m_MinDuration;
+    std::chrono::nanoseconds m_MaxDuration;
+};
+
+struct Counter
+{
+    const char* m_Name;
+    uint64_t m_Value;
+};
+
+/* Data recorded by a single thread:
+   - only accessed by the owning thread while recording, so no synchronization is required
+   - never deallocated (the thread might finish before the results are written)
+   - a few different names are expected per thread, so the aggregates are searched linearly
+*/
+struct ThreadRecorder
+{
+    size_t m_ThreadId;
+    std::vector<TraceEvent> m_Events;
+    std::vector<TimerAggregate> m_Timers;
+    std::vector<Counter> m_Counters;
+    uint64_t m_DroppedEventsCount;
+    ThreadRecorder* m_pNext;
+};
+
+static std::atomic<ThreadRecorder*> recordersListHead{nullptr};
+static std::atomic<size_t> nextThreadId{1};
+static const std::chrono::steady_clock::time_point c_StartTime{std::chrono::steady_clock::now()};
+
+static ThreadRecorder& getThreadRecorder()
+{
+    thread_local ThreadRecorder* pRecorder{nullptr};
+
+    if (!pRecorder)
+    {
+        pRecorder = new ThreadRecorder{nextThreadId.fetch_add(1, std::memory_order_relaxed), {}, {}, {}, 0, nullptr};
+        pRecorder->m_pNext = recordersListHead.load(std::memory_order_relaxed);
+
+        // lock-free insertion at the beginning of the list
+        while (!recordersListHead.compare_exchange_weak(pRecorder->m_pNext, pRecorder, std::memory_order_release,
+                                                        std::memory_order_relaxed))
+        {
+        }
+    }
+
+    return *pRecorder;
+}
+
+static double toMicroseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::micro>{duration}.count();
+}
+
+Utilities::Instrumentation::ScopedTimer::ScopedTimer(const char* name)
+    : m_Name{name}
+    , m_StartTime{std::chrono::steady_clock::now()}
+{
+}
+
+Utilities::Instrumentation::ScopedTimer::~ScopedTimer()
+{
+    recordEvent(m_Name, m_StartTime, std::chrono::steady_clock::now());
+}
+
+void Utilities::Instrumentation::recordEvent(const char* name, std::chrono::steady_clock::time_point startTime,
+                                             std::chrono::steady_clock::time_point endTime)
+{
+    ThreadRecorder& recorder{getThreadRecorder()};
+    const std::chrono::nanoseconds c_Duration{endTime - startTime};
+
+    auto timerIt{std::find_if(recorder.m_Timers.begin(), recorder.m_Timers.end(),
+                              [name](const TimerAggregate& timer) { return timer.m_Name == name; })};
+
+    if (timerIt == recorder.m_Timers.end())
+    {
+        recorder.m_Timers.push_back(TimerAggregate{name, 1, c_Duration, c_Duration, c_Duration});
+    }
+    else
+    {
+        ++timerIt->m_CallsCount;
+        timerIt->m_TotalDuration += c_Duration;
+        timerIt->m_MinDuration = std::min(timerIt->m_MinDuration, c_Duration);
+        timerIt->m_MaxDuration = std::max(timerIt->m_MaxDuration, c_Duration);
+    }
+
+    if (recorder.m_Events.size() < c_MaxEventsPerThread)
+    {
+        recorder.m_Events.push_back(TraceEvent{name, startTime, c_Duration});
+    }
+    else
+    {
+        ++recorder.m_DroppedEventsCount;
+    }
+}
+
+void Utilities::Instrumentation::addToCounter(const char* name, uint64_t value)
+{
+    ThreadRecorder& recorder{getThreadRecorder()};
+
+    auto counterIt{std::find_if(recorder.m_Counters.begin(), recorder.m_Counters.end(),
+                                [name](const Counter& counter) { return counter.m_Name == name; })};
+
+    if (counterIt == recorder.m_Counters.end())
+    {
+        recorder.m_Counters.push_back(Counter{name, value});
+    }
+    else
+    {
+        counterIt->m_Value += value;
+    }
+}
+
+// the same name might be stored at different addresses (e.g. different libraries), so the results are merged by content
+void Utilities::Instrumentation::writeSummary(std::ostream& out)
+{
+    std::map<std::string, TimerAggregate> timers;
+    std::map<std::string, uint64_t> counters;
+    uint64_t droppedEventsCount{0};
+
+    for (ThreadRecorder* pRecorder{recordersListHead.load(std::memory_order_acquire)}; pRecorder;
+         pRecorder = pRecorder->m_pNext)
+    {
+        for (const TimerAggregate& timer : pRecorder->m_Timers)
+        {
+            auto [timerIt, isInserted]{timers.emplace(timer.m_Name, timer)};
+
+            if (!isInserted)
+            {
+                timerIt->second.m_CallsCount += timer.m_CallsCount;
+                timerIt->second.m_TotalDuration += timer.m_TotalDuration;
+                timerIt->second.m_MinDuration = std::min(timerIt->second.m_MinDuration, timer.m_MinDuration);
+                timerIt->second.m_MaxDuration = std::max(timerIt->second.m_MaxDuration, timer.m_MaxDuration);
+            }
+        }
+
+        for (const Counter& counter : pRecorder->m_Counters)
+        {
+            counters[counter.m_Name] += counter.m_Value;
+        }
+
+        droppedEventsCount += pRecorder->m_DroppedEventsCount;
+    }
+
+    out << "{\n    \"timers\": [";
+
+    for (auto timerIt{timers.cbegin()}; timerIt != timers.cend(); ++timerIt)
+    {
+        const TimerAggregate& c_Timer{timerIt->second};
+
+        out << (timerIt != timers.cbegin() ? ",\n" : "\n");
+        out << "        {\"name\": \"" << escapeJsonString(timerIt->first) << "\", \"calls\": " << c_Timer.m_CallsCount
+            << ", \"total_ns\": " << c_Timer.m_TotalDuration.count()
+            << ", \"min_ns\": " << c_Timer.m_MinDuration.count() << ", \"max_ns\": " << c_Timer.m_MaxDuration.count()
+            << "}";
+    }
+
+    out << (timers.empty() ? "],\n" : "\n    ],\n") << "    \"counters\": [";
+
+    for (auto counterIt{counters.cbegin()}; counterIt != counters.cend(); ++counterIt)
+    {
+        out << (counterIt != counters.cbegin() ? ",\n" : "\n");
+        out << "        {\"name\": \"" << escapeJsonString(counterIt->first) << "\", \"value\": " << counterIt->second
+            << "}";
+    }
+
+    out << (counters.empty() ? "],\n" : "\n    ],\n");
+    out << "    \"dropped_trace_events\": " << droppedEventsCount << "\n}\n";
+}
+
+void Utilities::Instrumentation::writeChromeTrace(std::ostream& out)
+{
+    bool isFirstEvent{true};
+
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+    for (ThreadRecorder* pRecorder{recordersListHead.load(std::memory_order_acquire)}; pRecorder;
+         pRecorder = pRecorder->m_pNext)
+    {
+        for (const TraceEvent& event : pRecorder->m_Events)
+        {
+            out << (isFirstEvent ? "\n" : ",\n");
+            out << "{\"name\": \"" << escapeJsonString(event.m_Name) << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": "
+                << pRecorder->m_ThreadId << ", \"ts\": " << toMicroseconds(event.m_StartTime - c_StartTime)
+                << ", \"dur\": " << toMicroseconds(event.m_Duration) << "}";
+
+            isFirstEvent = false;
+        }
+
+        // counters are displayed as final values (recorded at the end of the trace)
+        for (const Counter& counter : pRecorder->m_Counters)
+        {
+            out << (isFirstEvent ? "\n" : ",\n");
+            out << "{\"name\": \"" << escapeJsonString(counter.m_Name) << "\", \"ph\": \"C\", \"pid\": 1, \"tid\": "
+                << pRecorder->m_ThreadId
+                << ", \"ts\": " << toMicroseconds(std::chrono::steady_clock::now() - c_StartTime)
+                << ", \"args\": {\"value\": " << counter.m_Value << "}}";
+
+            isFirstEvent = false;
+        }
+    }
+
+    out << "\n]}\n";
+}
+
+bool Utilities::Instrumentation::writeResultsToFiles(const std::string& filePathPrefix)
+{
+    std::ofstream summaryOut{filePathPrefix + "_instrumentation.json"};
+    std::ofstream traceOut{filePathPrefix + "_trace.json"};
+
+    if (summaryOut.is_open())
+    {
+        writeSummary(summaryOut);
+    }
+
+    if (traceOut.is_open())
+    {
+        traceOut << std::fixed;
+        writeChromeTrace(traceOut);
+    }
+
+    return summaryOut.is_open() && summaryOut.good() && traceOut.is_open() && traceOut.good();
+}
+
+void Utilities::Instrumentation::reset()
+{
+    for (ThreadRecorder* pRecorder{recordersListHead.load(std::memory_order_acquire)}; pRecorder;
+         pRecorder = pRecorder->m_pNext)
+    {
+        pRecorder->m_Events.clear();
+        pRecorder->m_Timers.clear();
+        pRecorder->m_Counters.clear();
+        pRecorder->m_DroppedEventsCount = 0;
+    }
+}
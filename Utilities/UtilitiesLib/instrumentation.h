@@ -0,0 +1,69 @@
+/* Lightweight instrumentation of hot code paths (timers and counters) */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/* The instrumentation is enabled at compile time (ENABLE_INSTRUMENTATION CMake option, which defines
+   INSTRUMENTATION_ENABLED). When disabled the macros expand to nothing, so there is no runtime cost.
+
+   - INSTRUMENT_SCOPE(name): measures the time spent in the enclosing scope (RAII timer)
+   - INSTRUMENT_COUNT(name, value): adds the value to the counter with the given name
+   - INSTRUMENT_DUMP(filePathPrefix): writes the aggregated results (<prefix>_instrumentation.json) and the recorded
+   events in Chrome trace format (<prefix>_trace.json, to be opened with chrome://tracing or Perfetto)
+
+   The names should be string literals (only their addresses are stored when recording).
+*/
+#ifdef INSTRUMENTATION_ENABLED
+#define INSTRUMENTATION_CONCATENATE_IMPL(first, second) first##second
+#define INSTRUMENTATION_CONCATENATE(first, second) INSTRUMENTATION_CONCATENATE_IMPL(first, second)
+#define INSTRUMENT_SCOPE(name)                                                                                         \
+    const Utilities::Instrumentation::ScopedTimer INSTRUMENTATION_CONCATENATE(c_ScopedTimer, __LINE__)(name)
+#define INSTRUMENT_COUNT(name, value) Utilities::Instrumentation::addToCounter(name, static_cast<uint64_t>(value))
+#define INSTRUMENT_DUMP(filePathPrefix) Utilities::Instrumentation::writeResultsToFiles(filePathPrefix)
+#else
+#define INSTRUMENT_SCOPE(name)
+#define INSTRUMENT_COUNT(name, value)
+#define INSTRUMENT_DUMP(filePathPrefix)
+#endif
+
+/* Recording and aggregation:
+   - each thread records into its own buffer (allocated on first use and registered in a lock-free list), so recording
+   requires no synchronization
+   - the events (start time, duration) are kept for the trace up to a maximum count per thread, while the per-name
+   aggregates (calls count, total/min/max duration) and the counters are always updated
+   - the results are merged from all thread buffers when being written, which should happen after the instrumented
+   threads have finished (e.g. joined), otherwise the results might be incomplete
+*/
+namespace Utilities::Instrumentation
+{
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const char* name);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    const char* m_Name;
+    std::chrono::steady_clock::time_point m_StartTime;
+};
+
+void recordEvent(const char* name, std::chrono::steady_clock::time_point startTime,
+                 std::chrono::steady_clock::time_point endTime);
+void addToCounter(const char* name, uint64_t value);
+
+// JSON object containing the aggregated timers (per name) and counters
+void writeSummary(std::ostream& out);
+// JSON object in Chrome trace event format (complete events for timers, one thread id per recording thread)
+void writeChromeTrace(std::ostream& out);
+// returns false if any of the files could not be written
+bool writeResultsToFiles(const std::string& filePathPrefix);
+
+// discards all recorded data (should not be called while other threads are recording)
+void reset();
+} // namespace Utilities::Instrumentation
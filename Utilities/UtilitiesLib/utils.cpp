@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <cstdlib>
 
 #include "utils.h"
@@ -10,3 +11,45 @@ void Utilities::clearScreen()
     system("cls"); // Windows
 #endif
 }
+
+std::string Utilities::escapeJsonString(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+
+    for (const char ch : str)
+    {
+        switch (ch)
+        {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            // the other control characters are written as hexadecimal code points
+            if (static_cast<unsigned char>(ch) < 0x20)
+            {
+                char escapedChar[7];
+                std::snprintf(escapedChar, sizeof(escapedChar), "\\u%04x", static_cast<unsigned int>(ch));
+                result += escapedChar;
+            }
+            else
+            {
+                result += ch;
+            }
+        }
+    }
+
+    return result;
+}
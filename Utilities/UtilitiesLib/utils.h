@@ -17,4 +17,7 @@ static const std::string c_InputOutputDir{"/tmp/InputOutputFiles/"};
 #endif
 
 void clearScreen();
+
+// escapes the quotes, backslashes and control characters, so the string can be written into a JSON file
+std::string escapeJsonString(const std::string& str);
 } // namespace Utilities
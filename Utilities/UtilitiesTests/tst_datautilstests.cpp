@@ -1,6 +1,9 @@
 // clang-format off
 #include <QTest>
 
+#include <cstdint>
+#include <sstream>
+
 #include "datautils.h"
 
 enum class TrimOperation
@@ -18,10 +21,16 @@ private slots:
     void testWhiteSpaceTrimming();
     void testConvertBitStringToDataWord();
     void testInvertDataWord();
+    void testParseBitStrings();
+    void testReadDataSet();
+    void testWordSegments();
 
     void testWhiteSpaceTrimming_data();
     void testConvertBitStringToDataWord_data();
     void testInvertDataWord_data();
+    void testParseBitStrings_data();
+    void testReadDataSet_data();
+    void testWordSegments_data();
 };
 
 void DataUtilsTests::testWhiteSpaceTrimming()
@@ -75,6 +84,77 @@ void DataUtilsTests::testInvertDataWord()
     QVERIFY(c_InvertedDataWord == expectedDataWord);
 }
 
+void DataUtilsTests::testParseBitStrings()
+{
+    QFETCH(std::string, input);
+    QFETCH(size_t, wordsCount);
+    QFETCH(size_t, wordSize);
+    QFETCH(bool, expectedResult);
+    QFETCH(DataSet, expectedDataSet);
+    QFETCH(std::string, expectedRemainingInput);
+
+    std::istringstream in{input};
+    PackedDataSet packedDataSet;
+    const bool c_Result{Utilities::parseBitStrings(in, wordsCount, wordSize, packedDataSet)};
+
+    QVERIFY(c_Result == expectedResult);
+
+    if (c_Result)
+    {
+        QVERIFY(Utilities::unpackDataSet(packedDataSet) == expectedDataSet);
+
+        // packing the words back should result in the same blocks
+        const PackedDataSet c_RepackedDataSet{Utilities::packDataSet(expectedDataSet)};
+
+        QVERIFY(c_RepackedDataSet.m_WordSize == packedDataSet.m_WordSize);
+        QVERIFY(c_RepackedDataSet.m_BlocksPerWord == packedDataSet.m_BlocksPerWord);
+        QVERIFY(c_RepackedDataSet.m_Blocks == packedDataSet.m_Blocks);
+
+        // the chars following the last word should not be consumed
+        const std::string c_RemainingInput{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        QVERIFY(c_RemainingInput == expectedRemainingInput);
+    }
+}
+
+// an invalid header or content should set the failbit and leave the data set unchanged
+void DataUtilsTests::testReadDataSet()
+{
+    QFETCH(std::string, input);
+    QFETCH(bool, isValid);
+    QFETCH(DataSet, expectedDataSet);
+
+    const DataSet c_InitialDataSet{{1, 1}, {0, 0}};
+
+    std::istringstream in{input};
+    DataSet dataSet{c_InitialDataSet};
+    in >> dataSet;
+
+    QVERIFY(isValid == !in.fail());
+    QVERIFY(dataSet == (isValid ? expectedDataSet : c_InitialDataSet));
+}
+
+void DataUtilsTests::testWordSegments()
+{
+    QFETCH(size_t, wordSize);
+    QFETCH(size_t, segmentsCount);
+    QFETCH(SizeVector, expectedSegmentBegins);
+
+    QVERIFY(expectedSegmentBegins.size() == segmentsCount + 1);
+
+    for (size_t segmentIndex{0}; segmentIndex <= segmentsCount; ++segmentIndex)
+    {
+        QVERIFY(Utilities::getSegmentBegin(wordSize, segmentsCount, segmentIndex) == expectedSegmentBegins[segmentIndex]);
+    }
+
+    for (size_t segmentIndex{0}; segmentIndex < segmentsCount; ++segmentIndex)
+    {
+        for (size_t bitIndex{expectedSegmentBegins[segmentIndex]}; bitIndex < expectedSegmentBegins[segmentIndex + 1]; ++bitIndex)
+        {
+            QVERIFY(Utilities::getSegmentIndex(wordSize, segmentsCount, bitIndex) == segmentIndex);
+        }
+    }
+}
+
 void DataUtilsTests::testWhiteSpaceTrimming_data()
 {
     QTest::addColumn<std::string>("stringToTrim");
@@ -187,6 +267,74 @@ void DataUtilsTests::testInvertDataWord_data()
     QTest::newRow("invert data word: 15") << DataWord{} << DataWord{};
 }
 
+void DataUtilsTests::testParseBitStrings_data()
+{
+    QTest::addColumn<std::string>("input");
+    QTest::addColumn<size_t>("wordsCount");
+    QTest::addColumn<size_t>("wordSize");
+    QTest::addColumn<bool>("expectedResult");
+    QTest::addColumn<DataSet>("expectedDataSet");
+    QTest::addColumn<std::string>("expectedRemainingInput");
+
+    QTest::newRow("valid input: 1") << std::string{"0010 1101 0101"} << size_t{3} << size_t{4} << true << DataSet{{0, 0, 1, 0}, {1, 1, 0, 1}, {0, 1, 0, 1}} << std::string{};
+    QTest::newRow("valid input: 2") << std::string{"\n0010\n1101\n0101\n"} << size_t{3} << size_t{4} << true << DataSet{{0, 0, 1, 0}, {1, 1, 0, 1}, {0, 1, 0, 1}} << std::string{"\n"};
+    QTest::newRow("valid input: 3") << std::string{"  0010\r\n\t1101 \n\n0101 3 4\n"} << size_t{3} << size_t{4} << true << DataSet{{0, 0, 1, 0}, {1, 1, 0, 1}, {0, 1, 0, 1}} << std::string{" 3 4\n"};
+    QTest::newRow("valid input: 4") << std::string{"0010110101011010 1101001010100101"} << size_t{2} << size_t{16} << true << DataSet{{0, 0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0}, {1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1}} << std::string{};
+    QTest::newRow("valid input: 5") << std::string{"1 0 1 1"} << size_t{3} << size_t{1} << true << DataSet{{1}, {0}, {1}} << std::string{" 1"};
+    QTest::newRow("valid input: 6") << std::string{"0000000000000000000000000000001111111111111111111111111111111111111111010101010101010101010101010101010101010101010101010101010101\n1111111111111111111111111111111111111111111111111111111111111111000000000000000000000000000000000000000000000000000000000000000010\n"} << size_t{2} << size_t{130} << true << DataSet{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}} << std::string{"\n"};
+    QTest::newRow("invalid input: 1") << std::string{"0010 1101"} << size_t{3} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 2") << std::string{"0010 1101 010"} << size_t{3} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 3") << std::string{"0010 1101 01010"} << size_t{3} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 4") << std::string{"0010 1201 0101"} << size_t{3} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 5") << std::string{"0010 110 10101"} << size_t{3} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 6") << std::string{"00101101010110a0"} << size_t{1} << size_t{16} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 7") << std::string{"0010"} << size_t{1} << size_t{0} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 8") << std::string{"0010"} << size_t{0} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 9") << std::string{} << size_t{1} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 10") << std::string{"0101"} << size_t{1} << size_t{1000000000000000000} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 11") << std::string{"0101"} << size_t{1000000000000000000} << size_t{4} << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 12") << std::string{"0101"} << size_t{1} << SIZE_MAX << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 13") << std::string{"0101"} << SIZE_MAX << SIZE_MAX << false << DataSet{} << std::string{};
+    QTest::newRow("invalid input: 14") << std::string{"0101 1"} << size_t{2} << SIZE_MAX / 2 << false << DataSet{} << std::string{};
+}
+
+void DataUtilsTests::testReadDataSet_data()
+{
+    QTest::addColumn<std::string>("input");
+    QTest::addColumn<bool>("isValid");
+    QTest::addColumn<DataSet>("expectedDataSet");
+
+    QTest::newRow("valid input: 1") << std::string{"3 4\n0010\n1101\n0101\n"} << true << DataSet{{0, 0, 1, 0}, {1, 1, 0, 1}, {0, 1, 0, 1}};
+    QTest::newRow("valid input: 2") << std::string{"1 1 1"} << true << DataSet{{1}};
+    QTest::newRow("bad header: missing words count") << std::string{""} << false << DataSet{};
+    QTest::newRow("bad header: non-numeric words count") << std::string{"x 4\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: zero words count") << std::string{"0 4\n"} << false << DataSet{};
+    QTest::newRow("bad header: missing word size") << std::string{"1"} << false << DataSet{};
+    QTest::newRow("bad header: zero word size") << std::string{"1 0\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: huge word size") << std::string{"1 1000000000000000000\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: huge words count") << std::string{"1000000000000000000 4\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: max word size") << std::string{"1 18446744073709551615\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: max words count and word size") << std::string{"18446744073709551615 18446744073709551615\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: overflowing input size") << std::string{"4 4611686018427387904\n0010"} << false << DataSet{};
+    QTest::newRow("bad header: word size out of range") << std::string{"1 100000000000000000000\n0010"} << false << DataSet{};
+    QTest::newRow("too few words") << std::string{"3 4\n0010\n1101\n"} << false << DataSet{};
+    QTest::newRow("too short word") << std::string{"2 4\n0010\n110\n"} << false << DataSet{};
+}
+
+void DataUtilsTests::testWordSegments_data()
+{
+    QTest::addColumn<size_t>("wordSize");
+    QTest::addColumn<size_t>("segmentsCount");
+    QTest::addColumn<SizeVector>("expectedSegmentBegins");
+
+    QTest::newRow("1 segment") << size_t{8} << size_t{1} << SizeVector{0, 8};
+    QTest::newRow("equal segments") << size_t{256} << size_t{4} << SizeVector{0, 64, 128, 192, 256};
+    QTest::newRow("unequal segments: 1") << size_t{10} << size_t{3} << SizeVector{0, 3, 6, 10};
+    QTest::newRow("unequal segments: 2") << size_t{15} << size_t{2} << SizeVector{0, 7, 15};
+    QTest::newRow("unequal segments: 3") << size_t{100} << size_t{7} << SizeVector{0, 14, 28, 42, 57, 71, 85, 100};
+    QTest::newRow("1 bit segments") << size_t{3} << size_t{3} << SizeVector{0, 1, 2, 3};
+}
+
 QTEST_APPLESS_MAIN(DataUtilsTests)
 
 #include "tst_datautilstests.moc"